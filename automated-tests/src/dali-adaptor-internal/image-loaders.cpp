@@ -18,6 +18,7 @@
 #include "image-loaders.h"
 #include <dali-test-suite-utils.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/system/common/mapped-file.h>
 
 AutoCloseFile::AutoCloseFile(FILE* fp)
 : filePtr(fp)
@@ -126,6 +127,40 @@ void TestImageLoading(const ImageDetails& image, const LoadFunctions& functions,
   }
 }
 
+void TestMappedImageLoading(const ImageDetails& image, const LoadFunctions& functions)
+{
+  FILE*         fp = fopen(image.name.c_str(), "rb");
+  AutoCloseFile autoClose(fp);
+  DALI_TEST_CHECK(fp != NULL);
+
+  const Dali::Internal::Platform::MappedFile mappedFile(fp);
+  DALI_TEST_CHECK(mappedFile.IsMapped());
+
+  Dali::ImageLoader::Input input(fp);
+  input.data     = mappedFile.GetData();
+  input.dataSize = mappedFile.GetSize();
+
+  Dali::Devel::PixelBuffer bitmap;
+
+  // Load Bitmap and check its return values.
+  DALI_TEST_CHECK(functions.loader(input, bitmap));
+  DALI_TEST_EQUALS(image.width, bitmap.GetWidth(), TEST_LOCATION);
+  DALI_TEST_EQUALS(image.height, bitmap.GetHeight(), TEST_LOCATION);
+
+  // The image decoded from the mapping must be identical to the reference buffer.
+  Dali::Integration::PixelBuffer* bufferPtr(bitmap.GetBuffer());
+  Dali::Integration::PixelBuffer* refBufferPtr(image.refBuffer);
+  for(unsigned int i = 0; i < image.refBufferSize; ++i, ++bufferPtr, ++refBufferPtr)
+  {
+    if(*bufferPtr != *refBufferPtr)
+    {
+      tet_result(TET_FAIL);
+      tet_printf("%s Failed in %s at line %d\n", __PRETTY_FUNCTION__, __FILE__, __LINE__);
+      break;
+    }
+  }
+}
+
 void CompareLoadedImageData(const ImageDetails& image, const LoadFunctions& functions, const uint32_t* master)
 {
   FILE*         filePointer = fopen(image.name.c_str(), "rb");
@@ -100,6 +100,15 @@ struct LoadFunctions
  */
 void TestImageLoading(const ImageDetails& image, const LoadFunctions& functions, Dali::Integration::Bitmap::Profile bitmapProfile = Dali::Integration::Bitmap::BITMAP_2D_PACKED_PIXELS);
 
+/**
+ * Use this method to test the loading of an image from the file mapped in memory.
+ * The loaded bitmap is then checked with the reference bitmap in ImageDetails.
+ *
+ * @param[in]  image      The image details.
+ * @param[in]  functions  The loader functions that need to be called.
+ */
+void TestMappedImageLoading(const ImageDetails& image, const LoadFunctions& functions);
+
 /**
  * Helper method to compare the resultant loaded image data of the specified image with a golden master data.
  *
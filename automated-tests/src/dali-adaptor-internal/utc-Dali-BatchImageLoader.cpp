@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/batch-image-loader.h>
+#include <dali/internal/imaging/common/batch-image-loader-impl.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_batch_image_loader_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_batch_image_loader_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* IMAGE_PNG_720x1280 = TEST_IMAGE_DIR "/frac.png";
+const char* IMAGE_JPG_720x1280 = TEST_IMAGE_DIR "/frac.jpg";
+const char* IMAGE_BMP_32x32    = TEST_IMAGE_DIR "/flag-24bpp.bmp";
+const char* IMAGE_MISSING      = TEST_IMAGE_DIR "/missing.png";
+
+const unsigned int MAXIMUM_WAIT_MILLISECONDS = 10000u;
+
+struct LoadCompletedTracker : public ConnectionTracker
+{
+  void OnLoadCompleted(uint32_t loadId, Devel::PixelBuffer pixelBuffer)
+  {
+    loadIds.push_back(loadId);
+    pixelBuffers.push_back(pixelBuffer);
+
+    if(releaseLoader)
+    {
+      releaseLoader->Reset();
+      releaseLoader = nullptr;
+    }
+  }
+
+  std::vector<uint32_t>           loadIds;
+  std::vector<Devel::PixelBuffer> pixelBuffers;
+  BatchImageLoader*               releaseLoader{nullptr};
+};
+
+/**
+ * @brief Emits the signal of the completed requests as the event thread callback would, until count requests have completed.
+ */
+void ProcessCompletedTasks(Internal::Adaptor::BatchImageLoader& loaderImpl, LoadCompletedTracker& tracker, size_t count)
+{
+  for(unsigned int waited = 0u; tracker.loadIds.size() < count && waited < MAXIMUM_WAIT_MILLISECONDS; waited += 10u)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    loaderImpl.ProcessCompletedTasks();
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliBatchImageLoaderSignalOrderAndIds(void)
+{
+  TestApplication application;
+
+  // A single worker decodes the requests one at a time, by priority then in the order they were added
+  BatchImageLoader loader = BatchImageLoader::New(1u);
+
+  LoadCompletedTracker tracker;
+  loader.LoadCompletedSignal().Connect(&tracker, &LoadCompletedTracker::OnLoadCompleted);
+
+  std::vector<BatchImageLoader::Request> requests;
+  requests.push_back(BatchImageLoader::Request(IMAGE_PNG_720x1280));
+  requests.push_back(BatchImageLoader::Request(IMAGE_BMP_32x32, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true, 5));
+  requests.push_back(BatchImageLoader::Request(IMAGE_MISSING, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true, 1));
+  requests.push_back(BatchImageLoader::Request(IMAGE_JPG_720x1280, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true, 5));
+
+  std::vector<uint32_t> loadIds = loader.Load(requests);
+  DALI_TEST_EQUALS(loadIds.size(), requests.size(), TEST_LOCATION);
+  for(size_t i = 1u; i < loadIds.size(); ++i)
+  {
+    DALI_TEST_CHECK(loadIds[i] > loadIds[i - 1u]);
+  }
+
+  ProcessCompletedTasks(GetImplementation(loader), tracker, requests.size());
+
+  DALI_TEST_EQUALS(tracker.loadIds.size(), requests.size(), TEST_LOCATION);
+  DALI_TEST_EQUALS(tracker.loadIds[0], loadIds[1], TEST_LOCATION);
+  DALI_TEST_EQUALS(tracker.loadIds[1], loadIds[3], TEST_LOCATION);
+  DALI_TEST_EQUALS(tracker.loadIds[2], loadIds[2], TEST_LOCATION);
+  DALI_TEST_EQUALS(tracker.loadIds[3], loadIds[0], TEST_LOCATION);
+
+  DALI_TEST_CHECK(tracker.pixelBuffers[0]);
+  DALI_TEST_EQUALS(tracker.pixelBuffers[0].GetWidth(), 32u, TEST_LOCATION);
+  DALI_TEST_CHECK(tracker.pixelBuffers[1]);
+  DALI_TEST_EQUALS(tracker.pixelBuffers[1].GetWidth(), 720u, TEST_LOCATION);
+  DALI_TEST_CHECK(!tracker.pixelBuffers[2]);
+  DALI_TEST_CHECK(tracker.pixelBuffers[3]);
+  DALI_TEST_EQUALS(tracker.pixelBuffers[3].GetHeight(), 1280u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliBatchImageLoaderReleaseInSignal(void)
+{
+  TestApplication application;
+
+  // The signal releases the last handle while the other request may still be decoded
+  BatchImageLoader loader = BatchImageLoader::New(2u);
+
+  LoadCompletedTracker tracker;
+  tracker.releaseLoader = &loader;
+  loader.LoadCompletedSignal().Connect(&tracker, &LoadCompletedTracker::OnLoadCompleted);
+
+  std::vector<BatchImageLoader::Request> requests;
+  requests.push_back(BatchImageLoader::Request(IMAGE_BMP_32x32, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true, 1));
+  requests.push_back(BatchImageLoader::Request(IMAGE_PNG_720x1280));
+  loader.Load(requests);
+
+  // The loader outlives the emission which released it, so the loop stops once it has been released
+  ProcessCompletedTasks(GetImplementation(loader), tracker, 1u);
+
+  DALI_TEST_CHECK(!tracker.loadIds.empty());
+  DALI_TEST_CHECK(!loader);
+
+  END_TEST;
+}
+
+int UtcDaliBatchImageLoaderDestroyWhileDecoding(void)
+{
+  TestApplication application;
+
+  BatchImageLoader     loader = BatchImageLoader::New(2u);
+  LoadCompletedTracker tracker;
+  loader.LoadCompletedSignal().Connect(&tracker, &LoadCompletedTracker::OnLoadCompleted);
+
+  std::vector<BatchImageLoader::Request> requests;
+  for(int i = 0; i < 4; ++i)
+  {
+    requests.push_back(BatchImageLoader::Request(IMAGE_PNG_720x1280));
+    requests.push_back(BatchImageLoader::Request(IMAGE_JPG_720x1280));
+  }
+  loader.Load(requests);
+
+  // Let the workers start decoding, then destroy the loader: it joins the workers, which discard their images
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  loader.Reset();
+
+  DALI_TEST_CHECK(!loader);
+  DALI_TEST_CHECK(tracker.loadIds.empty());
+
+  END_TEST;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/internal/system/common/capture-impl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::Capture;
+
+void utc_dali_capture_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_capture_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const PNG_FILE_NAME = "/tmp/utc-dali-capture.png";
+const char* const JPG_FILE_NAME = "/tmp/utc-dali-capture.jpg";
+
+// The pixels read back from a native image are RGBA8888
+std::vector<unsigned char> CreatePixels(uint32_t width, uint32_t height)
+{
+  std::vector<unsigned char> pixels(width * height * 4u);
+  for(size_t index = 0u; index < pixels.size(); ++index)
+  {
+    pixels[index] = static_cast<unsigned char>((index * 13u) ^ (index >> 5u));
+  }
+  return pixels;
+}
+
+off_t GetFileSize(const std::string& path)
+{
+  struct stat fileStat;
+  return stat(path.c_str(), &fileStat) == 0 ? fileStat.st_size : -1;
+}
+
+} // namespace
+
+int UtcDaliCaptureSavePixelsPngOptions(void)
+{
+  const uint32_t                   width  = 64u;
+  const uint32_t                   height = 48u;
+  const std::vector<unsigned char> pixels = CreatePixels(width, height);
+
+  // Without compression the file is larger than with the highest compression
+  EncodingOptions options;
+  options.pngCompressionLevel = 0;
+  options.pngFilter           = EncodingOptions::PngFilter::NONE;
+  DALI_TEST_CHECK(Capture::SavePixels(pixels, width, height, Pixel::RGBA8888, PNG_FILE_NAME, options));
+  const off_t storedSize = GetFileSize(PNG_FILE_NAME);
+
+  options.pngCompressionLevel = 9;
+  DALI_TEST_CHECK(Capture::SavePixels(pixels, width, height, Pixel::RGBA8888, PNG_FILE_NAME, options));
+  const off_t compressedSize = GetFileSize(PNG_FILE_NAME);
+
+  DALI_TEST_CHECK(compressedSize > 0);
+  DALI_TEST_CHECK(storedSize > compressedSize);
+
+  // Either way the pixels are read back as they were captured
+  Devel::PixelBuffer pixelBuffer = LoadImageFromFile(PNG_FILE_NAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+  DALI_TEST_CHECK(std::equal(pixels.begin(), pixels.end(), pixelBuffer.GetBuffer()));
+
+  // The file is written atomically: no temporary file is left behind
+  DALI_TEST_CHECK(GetFileSize(std::string(PNG_FILE_NAME) + '.' + std::to_string(getpid())) < 0);
+  unlink(PNG_FILE_NAME);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureSavePixelsJpegOptions(void)
+{
+  const uint32_t                   width  = 32u;
+  const uint32_t                   height = 32u;
+  const std::vector<unsigned char> pixels = CreatePixels(width, height);
+
+  // A lower quality gives a smaller file
+  EncodingOptions options;
+  options.quality = 100u;
+  DALI_TEST_CHECK(Capture::SavePixels(pixels, width, height, Pixel::RGBA8888, JPG_FILE_NAME, options));
+  const off_t highQualitySize = GetFileSize(JPG_FILE_NAME);
+
+  options.quality = 10u;
+  DALI_TEST_CHECK(Capture::SavePixels(pixels, width, height, Pixel::RGBA8888, JPG_FILE_NAME, options));
+  DALI_TEST_CHECK(GetFileSize(JPG_FILE_NAME) < highQualitySize);
+
+  // The subsampling is honoured too: a grayscale file is read back as L8
+  options.jpegSubsampling = EncodingOptions::JpegSubsampling::GRAYSCALE;
+  DALI_TEST_CHECK(Capture::SavePixels(pixels, width, height, Pixel::RGBA8888, JPG_FILE_NAME, options));
+
+  Devel::PixelBuffer pixelBuffer = LoadImageFromFile(JPG_FILE_NAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::L8, TEST_LOCATION);
+
+  unlink(JPG_FILE_NAME);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureSavePixelsNoPixels(void)
+{
+  // A native image which could not be read back gives no file
+  unlink(PNG_FILE_NAME);
+  DALI_TEST_CHECK(!Capture::SavePixels(std::vector<unsigned char>(), 16u, 16u, Pixel::RGBA8888, PNG_FILE_NAME, EncodingOptions()));
+  DALI_TEST_CHECK(GetFileSize(PNG_FILE_NAME) < 0);
+
+  END_TEST;
+}
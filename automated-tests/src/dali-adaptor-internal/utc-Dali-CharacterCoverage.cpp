@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/text/text-abstraction/character-coverage.h>
+#include <fontconfig/fontconfig.h>
+#include <stdlib.h>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+using namespace Dali::TextAbstraction::Internal;
+
+void utc_dali_character_coverage_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_character_coverage_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const Character LAST_CHARACTER = 0x10ffff;
+
+void AddRange(FcCharSet* characterSet, Character first, Character last, Character step)
+{
+  for(Character character = first; character <= last; character += step)
+  {
+    FcCharSetAddChar(characterSet, character);
+  }
+}
+
+} // namespace
+
+int UtcDaliCharacterCoverageEmpty(void)
+{
+  CharacterCoverage coverage;
+  DALI_TEST_CHECK(!coverage.Contains(0u));
+  DALI_TEST_CHECK(!coverage.Contains('A'));
+  DALI_TEST_CHECK(!coverage.Contains(LAST_CHARACTER));
+
+  CharacterCoverage nullCoverage(nullptr);
+  DALI_TEST_CHECK(!nullCoverage.Contains('A'));
+
+  FcCharSet*        characterSet = FcCharSetCreate();
+  CharacterCoverage emptyCoverage(characterSet);
+  DALI_TEST_CHECK(!emptyCoverage.Contains('A'));
+  FcCharSetDestroy(characterSet);
+
+  END_TEST;
+}
+
+int UtcDaliCharacterCoverageMatchesCharacterSet(void)
+{
+  // Latin, CJK, emoji, a plane 2 ideograph range and the last character.
+  FcCharSet* characterSet = FcCharSetCreate();
+  AddRange(characterSet, 0x20, 0x7e, 1u);
+  AddRange(characterSet, 0xa0, 0x17f, 1u);
+  AddRange(characterSet, 0x3041, 0x3096, 1u);
+  AddRange(characterSet, 0x4e00, 0x9fff, 3u);
+  AddRange(characterSet, 0xac00, 0xd7a3, 1u);
+  AddRange(characterSet, 0x1f300, 0x1f64f, 2u);
+  AddRange(characterSet, 0x20000, 0x2a6df, 5u);
+  FcCharSetAddChar(characterSet, LAST_CHARACTER);
+
+  CharacterCoverage coverage(characterSet);
+
+  bool matches = true;
+  for(Character character = 0u; character <= LAST_CHARACTER; ++character)
+  {
+    matches = matches && ((FcCharSetHasChar(characterSet, character) == FcTrue) == coverage.Contains(character));
+  }
+  DALI_TEST_CHECK(matches);
+
+  DALI_TEST_CHECK(coverage.Contains('A'));
+  DALI_TEST_CHECK(coverage.Contains(0x1f300));
+  DALI_TEST_CHECK(!coverage.Contains(0x1f301));
+  DALI_TEST_CHECK(coverage.Contains(0x20005));
+  DALI_TEST_CHECK(!coverage.Contains(0x110000));
+  DALI_TEST_CHECK(coverage.GetMemoryUsed() > 0u);
+
+  FcCharSetDestroy(characterSet);
+
+  END_TEST;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/chrome-trace-writer.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+const char* const TRACE_FILE = "/tmp/utc-dali-chrome-trace-writer.json";
+
+std::string ReadTraceFile()
+{
+  std::ifstream     file(TRACE_FILE);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+PerformanceMarker CreateMarker(PerformanceInterface::MarkerType type, uint64_t microseconds)
+{
+  return PerformanceMarker(type, FrameTimeStamp(0, microseconds));
+}
+
+} // unnamed namespace
+
+void utc_dali_chrome_trace_writer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_chrome_trace_writer_cleanup(void)
+{
+  remove(TRACE_FILE);
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliChromeTraceWriterEvents(void)
+{
+  ChromeTraceWriter writer;
+  DALI_TEST_CHECK(writer.Open(TRACE_FILE));
+
+  writer.AddThreadName(12, "Update\"Render");
+  writer.AddMarker(CreateMarker(PerformanceInterface::VSYNC, 100u), "V_SYNC", 12);
+  writer.AddMarker(CreateMarker(PerformanceInterface::UPDATE_START, 110u), "UPDATE_START", 12);
+  writer.AddMarker(CreateMarker(PerformanceInterface::UPDATE_END, 150u), "UPDATE_END", 12);
+  writer.AddMarker(CreateMarker(PerformanceInterface::START, 160u), "DALI_RENDER_START", 13);
+  writer.AddMarker(CreateMarker(PerformanceInterface::END, 170u), "DALI_RENDER_END", 13);
+  writer.AddMarker(CreateMarker(PerformanceInterface::PAUSED, 180u), "PAUSED", 1);
+
+  // Nothing is written until a second has passed or the buffer is full.
+  writer.Flush(false);
+  DALI_TEST_CHECK(ReadTraceFile().empty());
+
+  writer.Close();
+  const std::string trace = ReadTraceFile();
+
+  DALI_TEST_EQUALS(trace.compare(0u, 2u, "[\n"), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(trace.compare(trace.size() - 3u, 3u, "\n]\n"), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(trace.find("{\"name\":\"thread_name\",\"cat\":\"dali\",\"ph\":\"M\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("\"tid\":12,\"args\":{\"name\":\"Update\\\"Render\"}}") != std::string::npos);
+
+  // V_SYNC marks the frame boundaries globally.
+  DALI_TEST_CHECK(trace.find("{\"name\":\"V_SYNC\",\"cat\":\"dali\",\"ph\":\"i\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("\"tid\":12,\"s\":\"g\",\"ts\":100}") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("{\"name\":\"PAUSED\",\"cat\":\"dali\",\"ph\":\"i\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("\"tid\":1,\"s\":\"t\",\"ts\":180}") != std::string::npos);
+
+  // The timed events are named without their postfix.
+  DALI_TEST_CHECK(trace.find("{\"name\":\"UPDATE\",\"cat\":\"dali\",\"ph\":\"B\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("{\"name\":\"UPDATE\",\"cat\":\"dali\",\"ph\":\"E\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("{\"name\":\"DALI_RENDER\",\"cat\":\"dali\",\"ph\":\"B\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("\"tid\":13,\"ts\":170}") != std::string::npos);
+  DALI_TEST_CHECK(trace.find("UPDATE_START") == std::string::npos);
+
+  // The events are separated, without a trailing comma.
+  DALI_TEST_CHECK(trace.find("},\n{\"name\":\"PAUSED\"") != std::string::npos);
+  DALI_TEST_CHECK(trace.find(",\n]") == std::string::npos);
+
+  END_TEST;
+}
+
+int UtcDaliChromeTraceWriterBufferBounded(void)
+{
+  ChromeTraceWriter writer;
+  DALI_TEST_CHECK(writer.Open(TRACE_FILE));
+
+  // The buffer is written out once full, without waiting for a flush.
+  for(uint64_t time = 0u; time < 2000u; ++time)
+  {
+    writer.AddMarker(CreateMarker(PerformanceInterface::UPDATE_START, time), "UPDATE_START", 12);
+  }
+  const size_t writtenSize = ReadTraceFile().size();
+  DALI_TEST_CHECK(writtenSize > 0u);
+
+  // Less than a full buffer is left for the end of the trace.
+  writer.Close();
+  const size_t traceSize = ReadTraceFile().size();
+  DALI_TEST_CHECK(traceSize > writtenSize);
+  DALI_TEST_CHECK(traceSize - writtenSize < 64u * 1024u + 3u);
+
+  END_TEST;
+}
+
+int UtcDaliChromeTraceWriterOpenFailure(void)
+{
+  ChromeTraceWriter writer;
+  DALI_TEST_CHECK(!writer.Open("/non-existent-directory/trace.json"));
+
+  // Ignored when not open.
+  writer.AddMarker(CreateMarker(PerformanceInterface::VSYNC, 100u), "V_SYNC", 12);
+  writer.Flush(true);
+  writer.Close();
+
+  END_TEST;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/window-system/common/damage-region.h>
+#include <stdlib.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_damage_region_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_damage_region_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliDamageRegionDistantRects(void)
+{
+  DamageRegion region(4u, 1024u);
+  DALI_TEST_CHECK(region.IsEmpty());
+
+  tet_infoline("Test that two small rects in opposite corners are not merged into their bounding box");
+  region.Add(Rect<int>(0, 0, 20, 20));
+  region.Add(Rect<int>(700, 460, 20, 20));
+  DALI_TEST_EQUALS(region.GetRects().size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetArea(), static_cast<uint64_t>(800u), TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBoundingBox(), Rect<int>(0, 0, 720, 480), TEST_LOCATION);
+
+  tet_infoline("Test that empty rects are ignored");
+  region.Add(Rect<int>(100, 100, 0, 10));
+  DALI_TEST_EQUALS(region.GetRects().size(), 2u, TEST_LOCATION);
+
+  region.Clear();
+  DALI_TEST_CHECK(region.IsEmpty());
+  DALI_TEST_EQUALS(region.GetBoundingBox(), Rect<int>(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionMerge(void)
+{
+  DamageRegion region(4u, 1024u);
+
+  tet_infoline("Test that contained rects are absorbed");
+  region.Add(Rect<int>(0, 0, 100, 100));
+  region.Add(Rect<int>(10, 10, 20, 20));
+  DALI_TEST_EQUALS(region.GetRects().size(), 1u, TEST_LOCATION);
+  region.Add(Rect<int>(-10, -10, 200, 200));
+  DALI_TEST_EQUALS(region.GetRects().size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetRects()[0], Rect<int>(-10, -10, 200, 200), TEST_LOCATION);
+
+  tet_infoline("Test that adjacent rects whose bounding box adds fewer pixels than the rect cost are merged");
+  region.Clear();
+  region.Add(Rect<int>(0, 0, 100, 10));
+  region.Add(Rect<int>(0, 10, 100, 10));
+  DALI_TEST_EQUALS(region.GetRects().size(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetRects()[0], Rect<int>(0, 0, 100, 20), TEST_LOCATION);
+
+  tet_infoline("Test that the number of rects is capped by merging the closest ones");
+  region.Clear();
+  for(int i = 0; i < 10; ++i)
+  {
+    region.Add(Rect<int>(i * 200, 0, 10, 10));
+  }
+  DALI_TEST_CHECK(region.GetRects().size() <= 4u);
+  DALI_TEST_EQUALS(region.GetBoundingBox(), Rect<int>(0, 0, 1810, 10), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionClip(void)
+{
+  DamageRegion region(4u, 0u);
+  region.Add(Rect<int>(-10, -10, 20, 20));
+  region.Add(Rect<int>(500, 500, 20, 20));
+  region.Add(Rect<int>(2000, 2000, 20, 20));
+
+  tet_infoline("Test that clipping trims the rects and removes the ones outside");
+  region.Clip(Rect<int>(0, 0, 720, 1280));
+  DALI_TEST_EQUALS(region.GetRects().size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetArea(), static_cast<uint64_t>(500u), TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBoundingBox(), Rect<int>(0, 0, 520, 520), TEST_LOCATION);
+
+  END_TEST;
+}
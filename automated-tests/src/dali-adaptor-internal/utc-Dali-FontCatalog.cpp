@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/text/text-abstraction/font-catalog.h>
+#include <fontconfig/fontconfig.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cstdio>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+using namespace Dali::TextAbstraction::Internal;
+
+void utc_dali_font_catalog_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_font_catalog_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const CATALOG_PATH = "/tmp/utc-dali-font-catalog";
+
+FontDescription CreateDescription(const char* path, const char* family, FontWeight::Type weight)
+{
+  FontDescription description;
+  description.path   = path;
+  description.family = family;
+  description.width  = FontWidth::NORMAL;
+  description.weight = weight;
+  description.slant  = FontSlant::NORMAL;
+  return description;
+}
+
+FcCharSet* CreateCharacterSet(FcChar32 first, FcChar32 last)
+{
+  FcCharSet* characterSet = FcCharSetCreate();
+  for(FcChar32 character = first; character <= last; ++character)
+  {
+    FcCharSetAddChar(characterSet, character);
+  }
+  return characterSet;
+}
+
+bool DescriptionsAreEqual(const FontDescription& lhs, const FontDescription& rhs)
+{
+  return (lhs.path == rhs.path) && (lhs.family == rhs.family) && (lhs.width == rhs.width) && (lhs.weight == rhs.weight) && (lhs.slant == rhs.slant) && (lhs.type == rhs.type);
+}
+
+void DestroyCharacterSets(CharacterSetList& characterSets)
+{
+  for(auto characterSet : characterSets)
+  {
+    FcCharSetDestroy(characterSet);
+  }
+  characterSets.Clear();
+}
+
+} // namespace
+
+int UtcDaliFontCatalogSaveAndLoad(void)
+{
+  const FontDescription latin    = CreateDescription("/fonts/latin.ttf", "Latin", FontWeight::NORMAL);
+  const FontDescription hangul   = CreateDescription("/fonts/hangul.ttf", "Hangul", FontWeight::BOLD);
+  const FontDescription request  = CreateDescription("", "Tizen", FontWeight::NORMAL);
+  const FontList        fontList = {latin, hangul};
+
+  FcCharSet* latinCharacters  = CreateCharacterSet(0x20, 0x7e);
+  FcCharSet* hangulCharacters = CreateCharacterSet(0xac00, 0xd7a3);
+
+  CharacterSetList characterSets;
+  characterSets.PushBack(latinCharacters);
+  characterSets.PushBack(hangulCharacters);
+
+  {
+    FontCatalog catalog;
+    DALI_TEST_CHECK(!catalog.IsModified());
+
+    catalog.SetSystemFonts(fontList);
+    catalog.AddFontList(request, fontList, characterSets);
+    catalog.AddMatch(request, hangul, hangulCharacters);
+    DALI_TEST_CHECK(catalog.IsModified());
+
+    DALI_TEST_CHECK(catalog.Save(CATALOG_PATH));
+    DALI_TEST_CHECK(!catalog.IsModified());
+  }
+
+  FontCatalog catalog;
+  DALI_TEST_CHECK(catalog.Load(CATALOG_PATH));
+
+  FontList systemFonts;
+  DALI_TEST_CHECK(catalog.GetSystemFonts(systemFonts));
+  DALI_TEST_EQUALS(systemFonts.size(), 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(DescriptionsAreEqual(systemFonts[0], latin));
+  DALI_TEST_CHECK(DescriptionsAreEqual(systemFonts[1], hangul));
+
+  FontList         loadedList;
+  CharacterSetList loadedCharacterSets;
+  DALI_TEST_CHECK(catalog.GetFontList(request, loadedList, loadedCharacterSets));
+  DALI_TEST_EQUALS(loadedList.size(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(loadedCharacterSets.Count(), 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(DescriptionsAreEqual(loadedList[1], hangul));
+  DALI_TEST_CHECK(FcCharSetEqual(loadedCharacterSets[0], latinCharacters));
+  DALI_TEST_CHECK(FcCharSetEqual(loadedCharacterSets[1], hangulCharacters));
+
+  FontDescription match;
+  FcCharSet*      matchCharacters = nullptr;
+  DALI_TEST_CHECK(catalog.GetMatch(request, match, &matchCharacters));
+  DALI_TEST_CHECK(DescriptionsAreEqual(match, hangul));
+  DALI_TEST_CHECK(FcCharSetEqual(matchCharacters, hangulCharacters));
+
+  // Nothing is returned for other descriptions.
+  const FontDescription otherRequest = CreateDescription("", "Tizen", FontWeight::BOLD);
+  DALI_TEST_CHECK(!catalog.GetFontList(otherRequest, loadedList, loadedCharacterSets));
+  DALI_TEST_CHECK(!catalog.GetMatch(otherRequest, match, &matchCharacters));
+  DALI_TEST_EQUALS(loadedCharacterSets.Count(), 2u, TEST_LOCATION);
+
+  FcCharSetDestroy(matchCharacters);
+  DestroyCharacterSets(loadedCharacterSets);
+  DestroyCharacterSets(characterSets);
+  unlink(CATALOG_PATH);
+
+  END_TEST;
+}
+
+int UtcDaliFontCatalogLoadInvalidFile(void)
+{
+  unlink(CATALOG_PATH);
+
+  FontCatalog catalog;
+  DALI_TEST_CHECK(!catalog.Load(CATALOG_PATH));
+
+  FontList systemFonts;
+  DALI_TEST_CHECK(!catalog.GetSystemFonts(systemFonts));
+
+  // Save a catalog and check every truncation of it is rejected.
+  catalog.SetSystemFonts({CreateDescription("/fonts/latin.ttf", "Latin", FontWeight::NORMAL)});
+  DALI_TEST_CHECK(catalog.Save(CATALOG_PATH));
+
+  FILE* file = fopen(CATALOG_PATH, "rb");
+  DALI_TEST_CHECK(file);
+  std::vector<char> contents;
+  for(int character = fgetc(file); character != EOF; character = fgetc(file))
+  {
+    contents.push_back(static_cast<char>(character));
+  }
+  fclose(file);
+
+  bool allRejected = true;
+  for(size_t size = 0u; size < contents.size(); ++size)
+  {
+    file = fopen(CATALOG_PATH, "wb");
+    fwrite(contents.data(), 1u, size, file);
+    fclose(file);
+
+    FontCatalog truncatedCatalog;
+    allRejected = allRejected && !truncatedCatalog.Load(CATALOG_PATH) && !truncatedCatalog.GetSystemFonts(systemFonts);
+  }
+  DALI_TEST_CHECK(allRejected);
+
+  unlink(CATALOG_PATH);
+
+  END_TEST;
+}
+
+int UtcDaliFontCatalogGetDefaultPath(void)
+{
+  setenv("DALI_FONT_CATALOG_PATH", CATALOG_PATH, 1);
+  DALI_TEST_EQUALS(FontCatalog::GetDefaultPath(), std::string(CATALOG_PATH), TEST_LOCATION);
+
+  setenv("DALI_FONT_CATALOG_PATH", "/tmp/cache/", 1);
+  DALI_TEST_EQUALS(FontCatalog::GetDefaultPath(), std::string("/tmp/cache/dali-font-catalog"), TEST_LOCATION);
+
+  // The catalog is opt-in.
+  setenv("DALI_FONT_CATALOG_PATH", "", 1);
+  DALI_TEST_CHECK(FontCatalog::GetDefaultPath().empty());
+
+  unsetenv("DALI_FONT_CATALOG_PATH");
+  setenv("XDG_CACHE_HOME", "/tmp/cache", 1);
+  DALI_TEST_CHECK(FontCatalog::GetDefaultPath().empty());
+  unsetenv("XDG_CACHE_HOME");
+
+  END_TEST;
+}
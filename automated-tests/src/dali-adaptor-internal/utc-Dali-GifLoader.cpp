@@ -64,3 +64,13 @@ int UtcDaliGifLoaderTransparency(void)
   TestImageLoading(transparency, GifLoaders);
   END_TEST;
 }
+
+int UtcDaliGifLoaderMappedFile(void)
+{
+  ImageDetails interlaced(TEST_IMAGE_DIR "/interlaced.gif", 365u, 227u);
+  TestMappedImageLoading(interlaced, GifLoaders);
+
+  ImageDetails pattern(TEST_IMAGE_DIR "/pattern.gif", 600u, 600u);
+  TestMappedImageLoading(pattern, GifLoaders);
+  END_TEST;
+}
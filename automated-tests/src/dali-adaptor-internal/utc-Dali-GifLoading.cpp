@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/gif-loading.h>
+#include <cstring>
+#include <vector>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::AnimatedImageLoadingPtr;
+using Dali::Internal::Adaptor::GifLoading;
+
+namespace
+{
+// resolution: 64*64, 40 frames, disposal methods: none, background and previous mixed,
+// previous on the frames 16 and 32 which fall on the composed keyframes
+static const char* gGifMixed = TEST_IMAGE_DIR "/../resources/canvas-mixed.gif";
+
+} // namespace
+
+void utc_dali_gif_loading_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_gif_loading_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliGifLoadingMemoryBudgetEviction(void)
+{
+  // The frames composed in order, within the default budgets
+  AnimatedImageLoadingPtr expectedLoading = GifLoading::New(gGifMixed, true);
+  const uint32_t          frameCount      = expectedLoading->GetImageCount();
+  DALI_TEST_EQUALS(frameCount, 40u, TEST_LOCATION);
+
+  std::vector<Dali::Devel::PixelBuffer> expectedFrames;
+  for(uint32_t frameIndex = 0u; frameIndex < frameCount; ++frameIndex)
+  {
+    expectedFrames.push_back(expectedLoading->LoadFrame(frameIndex));
+    DALI_TEST_CHECK(expectedFrames.back());
+  }
+
+  const uint32_t width  = expectedLoading->GetImageSize().GetWidth();
+  const uint32_t height = expectedLoading->GetImageSize().GetHeight();
+
+  // With one byte budgets every decoded frame is evicted after each load and only one keyframe is kept,
+  // so each frame out of order is decoded again from the file and composed from the start or that keyframe.
+  AnimatedImageLoadingPtr animatedImageLoading = GifLoading::New(gGifMixed, true);
+  static_cast<GifLoading&>(*animatedImageLoading).SetMemoryBudget(1u, 1u);
+
+  std::vector<uint32_t> frameIndices;
+  for(uint32_t step = 0u; step < frameCount; ++step)
+  {
+    frameIndices.push_back((step * 13u + 5u) % frameCount);
+  }
+  for(uint32_t frameIndex = frameCount; frameIndex > 0u; --frameIndex)
+  {
+    frameIndices.push_back(frameIndex - 1u);
+  }
+
+  for(uint32_t frameIndex : frameIndices)
+  {
+    Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading->LoadFrame(frameIndex);
+    DALI_TEST_CHECK(pixelBuffer);
+    DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expectedFrames[frameIndex].GetBuffer(), width * height * 4u), 0, TEST_LOCATION);
+  }
+
+  // Raising the budgets again keeps the frames, which give the same pixels.
+  static_cast<GifLoading&>(*animatedImageLoading).SetMemoryBudget(16u * 1024u * 1024u, 4u * 1024u * 1024u);
+  for(uint32_t frameIndex : frameIndices)
+  {
+    Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading->LoadFrame(frameIndex);
+    DALI_TEST_CHECK(pixelBuffer);
+    DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expectedFrames[frameIndex].GetBuffer(), width * height * 4u), 0, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/text/text-abstraction/glyph-bitmap-cache.h>
+#include <stdlib.h>
+#include <cstring>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+using namespace Dali::TextAbstraction::Internal;
+
+void utc_dali_glyph_bitmap_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_glyph_bitmap_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+typedef TextAbstraction::FontClient::GlyphBufferData GlyphBufferData;
+
+/**
+ * Creates a glyph like bitmap: a transparent border around an opaque square with anti-aliased edges.
+ */
+void CreateGlyph(GlyphBufferData& data, unsigned int size, Pixel::Format format)
+{
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel(format);
+
+  data.width  = size;
+  data.height = size;
+  data.format = format;
+  data.buffer = new unsigned char[size * size * bytesPerPixel];
+  memset(data.buffer, 0, size * size * bytesPerPixel);
+
+  for(unsigned int y = size / 4u; y < size - size / 4u; ++y)
+  {
+    for(unsigned int x = size / 4u; x < size - size / 4u; ++x)
+    {
+      const bool          isEdge = (x == size / 4u) || (y == size / 4u);
+      const unsigned char value  = isEdge ? static_cast<unsigned char>(x * 7u + y * 13u) : 0xffu;
+      memset(data.buffer + (y * size + x) * bytesPerPixel, value, bytesPerPixel);
+    }
+  }
+}
+
+bool BitmapsAreEqual(const GlyphBufferData& lhs, const GlyphBufferData& rhs)
+{
+  return (lhs.width == rhs.width) &&
+         (lhs.height == rhs.height) &&
+         (lhs.format == rhs.format) &&
+         (lhs.outlineOffsetX == rhs.outlineOffsetX) &&
+         (lhs.outlineOffsetY == rhs.outlineOffsetY) &&
+         (lhs.isColorEmoji == rhs.isColorEmoji) &&
+         (0 == memcmp(lhs.buffer, rhs.buffer, lhs.width * lhs.height * Pixel::GetBytesPerPixel(lhs.format)));
+}
+
+} // namespace
+
+int UtcDaliGlyphBitmapCacheFindAdd(void)
+{
+  GlyphBitmapCache cache(1024u * 1024u);
+
+  GlyphBufferData glyph;
+  CreateGlyph(glyph, 32u, Pixel::L8);
+  glyph.outlineOffsetX = 1;
+  glyph.outlineOffsetY = -2;
+
+  GlyphBufferData emoji;
+  CreateGlyph(emoji, 16u, Pixel::BGRA8888);
+  emoji.isColorEmoji = true;
+
+  GlyphBufferData found;
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 2, false, false, ImageDimensions(), found));
+
+  cache.Add(1u, 10u, 2, false, false, ImageDimensions(), glyph);
+  cache.Add(2u, 10u, 0, false, false, ImageDimensions(), emoji);
+
+  DALI_TEST_CHECK(cache.Find(1u, 10u, 2, false, false, ImageDimensions(), found));
+  DALI_TEST_CHECK(BitmapsAreEqual(found, glyph));
+  delete[] found.buffer;
+
+  DALI_TEST_CHECK(cache.Find(2u, 10u, 0, false, false, ImageDimensions(), found));
+  DALI_TEST_CHECK(BitmapsAreEqual(found, emoji));
+  delete[] found.buffer;
+
+  // The outline and the software styles are part of the key.
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 0, false, false, ImageDimensions(), found));
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 2, true, false, ImageDimensions(), found));
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 2, false, true, ImageDimensions(), found));
+  DALI_TEST_CHECK(!cache.Find(1u, 11u, 2, false, false, ImageDimensions(), found));
+
+  GlyphBitmapCache::Statistics statistics;
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.hits, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.misses, 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.entries, 2u, TEST_LOCATION);
+
+  // The coverage bitmap is encoded, the color one is not.
+  DALI_TEST_CHECK(statistics.bytes < statistics.uncompressedBytes);
+  DALI_TEST_CHECK(statistics.uncompressedBytes - statistics.bytes < 32u * 32u);
+
+  cache.Clear();
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 2, false, false, ImageDimensions(), found));
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.entries, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.bytes, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.uncompressedBytes, 0u, TEST_LOCATION);
+
+  delete[] glyph.buffer;
+  delete[] emoji.buffer;
+
+  END_TEST;
+}
+
+int UtcDaliGlyphBitmapCacheRequestedSize(void)
+{
+  GlyphBitmapCache cache(1024u * 1024u);
+
+  // The emojis of a fixed size font are downscaled to the size requested by the caller.
+  GlyphBufferData emoji16;
+  CreateGlyph(emoji16, 16u, Pixel::BGRA8888);
+  emoji16.isColorEmoji = true;
+
+  GlyphBufferData emoji24;
+  CreateGlyph(emoji24, 24u, Pixel::BGRA8888);
+  emoji24.isColorEmoji = true;
+
+  cache.Add(1u, 10u, 0, false, false, ImageDimensions(16u, 16u), emoji16);
+
+  GlyphBufferData found;
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 0, false, false, ImageDimensions(24u, 24u), found));
+  DALI_TEST_CHECK(!cache.Find(1u, 10u, 0, false, false, ImageDimensions(), found));
+
+  cache.Add(1u, 10u, 0, false, false, ImageDimensions(24u, 24u), emoji24);
+
+  DALI_TEST_CHECK(cache.Find(1u, 10u, 0, false, false, ImageDimensions(16u, 16u), found));
+  DALI_TEST_CHECK(BitmapsAreEqual(found, emoji16));
+  delete[] found.buffer;
+
+  DALI_TEST_CHECK(cache.Find(1u, 10u, 0, false, false, ImageDimensions(24u, 24u), found));
+  DALI_TEST_CHECK(BitmapsAreEqual(found, emoji24));
+  delete[] found.buffer;
+
+  GlyphBitmapCache::Statistics statistics;
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.entries, 2u, TEST_LOCATION);
+
+  delete[] emoji16.buffer;
+  delete[] emoji24.buffer;
+
+  END_TEST;
+}
+
+int UtcDaliGlyphBitmapCacheEviction(void)
+{
+  // Room for four 32x32 color glyphs only.
+  GlyphBitmapCache cache(17000u);
+
+  GlyphBufferData glyph;
+  CreateGlyph(glyph, 32u, Pixel::RGBA8888);
+
+  GlyphBufferData found;
+  for(GlyphIndex index = 1u; index <= 6u; ++index)
+  {
+    cache.Add(1u, index, 0, false, false, ImageDimensions(), glyph);
+
+    // Keeps the first glyph recently used.
+    DALI_TEST_CHECK(cache.Find(1u, 1u, 0, false, false, ImageDimensions(), found));
+    delete[] found.buffer;
+  }
+
+  DALI_TEST_CHECK(cache.Find(1u, 6u, 0, false, false, ImageDimensions(), found));
+  delete[] found.buffer;
+  DALI_TEST_CHECK(!cache.Find(1u, 2u, 0, false, false, ImageDimensions(), found));
+  DALI_TEST_CHECK(!cache.Find(1u, 3u, 0, false, false, ImageDimensions(), found));
+
+  GlyphBitmapCache::Statistics statistics;
+  cache.GetStatistics(statistics);
+  DALI_TEST_CHECK(statistics.evictions > 0u);
+  DALI_TEST_CHECK(statistics.bytes <= cache.GetMemoryBudget());
+
+  cache.ResetStatistics();
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.hits, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.evictions, 0u, TEST_LOCATION);
+
+  // A zero budget disables the cache.
+  cache.SetMemoryBudget(0u);
+  cache.Add(1u, 1u, 0, false, false, ImageDimensions(), glyph);
+  DALI_TEST_CHECK(!cache.Find(1u, 1u, 0, false, false, ImageDimensions(), found));
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.entries, 0u, TEST_LOCATION);
+
+  delete[] glyph.buffer;
+
+  END_TEST;
+}
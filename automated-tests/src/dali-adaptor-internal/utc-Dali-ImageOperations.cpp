@@ -21,6 +21,11 @@
 
 #include <sys/mman.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 using namespace Dali::Internal::Platform;
 
@@ -1097,6 +1102,202 @@ int UtcDaliImageOperationsAverageScanlinesRGB565(void)
   END_TEST;
 }
 
+namespace
+{
+/**
+ * @brief Reference for the scanline halving functions, averaging each pair of pixels one component at a time.
+ */
+void HalveScanlineReference(const uint8_t* input, unsigned int width, unsigned int bytesPerPixel, uint8_t* output)
+{
+  for(unsigned int pixel = 0; pixel + 1 < width; pixel += 2)
+  {
+    for(unsigned int component = 0; component < bytesPerPixel; ++component)
+    {
+      output[(pixel / 2) * bytesPerPixel + component] = AverageComponent(input[pixel * bytesPerPixel + component], input[(pixel + 1) * bytesPerPixel + component]);
+    }
+  }
+}
+
+/**
+ * @brief Reference for HalveScanlineInPlaceRGB565.
+ */
+void HalveScanlineReferenceRGB565(const uint16_t* input, unsigned int width, uint16_t* output)
+{
+  for(unsigned int pixel = 0; pixel + 1 < width; pixel += 2)
+  {
+    output[pixel / 2] = AveragePixelRGB565(input[pixel], input[pixel + 1]);
+  }
+}
+
+/**
+ * @brief Random bytes with a guard area after them to catch writes beyond the end of a scanline.
+ */
+void SetupRandomScanline(unsigned int numBytes, Dali::Vector<uint8_t>& scanline)
+{
+  scanline.Resize(numBytes + 32u);
+  for(unsigned int i = 0; i < numBytes; ++i)
+  {
+    scanline[i] = RandomComponent8();
+  }
+  for(unsigned int i = numBytes; i < scanline.Count(); ++i)
+  {
+    scanline[i] = 0xEE;
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Test the byte averaging of the scanline functions for every pair of inputs.
+ */
+int UtcDaliImageOperationsAverageScanlines1AllPairs(void)
+{
+  const unsigned int    numPairs = 256u * 256u;
+  Dali::Vector<uint8_t> scanline1;
+  Dali::Vector<uint8_t> scanline2;
+  Dali::Vector<uint8_t> output;
+  scanline1.Resize(numPairs);
+  scanline2.Resize(numPairs);
+  output.Resize(numPairs);
+  for(unsigned int i = 0; i < numPairs; ++i)
+  {
+    scanline1[i] = i & 0xffu;
+    scanline2[i] = i >> 8u;
+  }
+
+  AverageScanlines1(&scanline1[0], &scanline2[0], &output[0], numPairs);
+
+  unsigned int numMatches = 0;
+  for(unsigned int i = 0; i < numPairs; ++i)
+  {
+    numMatches += output[i] == AverageComponent(scanline1[i], scanline2[i]);
+  }
+  DALI_TEST_EQUALS(numMatches, numPairs, TEST_LOCATION);
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that the scanline halving functions match the pixel averaging functions for every width, so the
+ * vectorised parts and the remainders left to the per-pixel loops are all checked.
+ */
+int UtcDaliImageOperationsHalveScanlineInPlaceAllWidths(void)
+{
+  srand48(53 * 59);
+  for(unsigned int width = 2u; width < 160u; ++width)
+  {
+    for(unsigned int bytesPerPixel = 1u; bytesPerPixel <= 4u; ++bytesPerPixel)
+    {
+      Dali::Vector<uint8_t> scanline;
+      SetupRandomScanline(width * bytesPerPixel, scanline);
+      Dali::Vector<uint8_t> reference(scanline);
+      HalveScanlineReference(&scanline[0], width, bytesPerPixel, &reference[0]);
+
+      switch(bytesPerPixel)
+      {
+        case 1u:
+          HalveScanlineInPlace1Byte(&scanline[0], width);
+          break;
+        case 2u:
+          HalveScanlineInPlace2Bytes(&scanline[0], width);
+          break;
+        case 3u:
+          HalveScanlineInPlaceRGB888(&scanline[0], width);
+          break;
+        default:
+          HalveScanlineInPlaceRGBA8888(&scanline[0], width);
+          break;
+      }
+
+      const unsigned int numBytes = (width / 2u) * bytesPerPixel;
+      DALI_TEST_CHECK(memcmp(&scanline[0], &reference[0], numBytes) == 0);
+      DALI_TEST_CHECK(memcmp(&scanline[width * bytesPerPixel], &reference[width * bytesPerPixel], 32u) == 0);
+    }
+
+    Dali::Vector<uint8_t> scanline;
+    SetupRandomScanline(width * 2u, scanline);
+    Dali::Vector<uint8_t> reference(scanline);
+    HalveScanlineReferenceRGB565(reinterpret_cast<const uint16_t*>(&scanline[0]), width, reinterpret_cast<uint16_t*>(&reference[0]));
+    HalveScanlineInPlaceRGB565(&scanline[0], width);
+    DALI_TEST_CHECK(memcmp(&scanline[0], &reference[0], (width / 2u) * 2u) == 0);
+    DALI_TEST_CHECK(memcmp(&scanline[width * 2u], &reference[width * 2u], 32u) == 0);
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that the functions averaging two scanlines match the pixel averaging functions for every width,
+ * both into a separate output and in place over the first scanline.
+ */
+int UtcDaliImageOperationsAverageScanlinesAllWidths(void)
+{
+  srand48(61 * 67);
+  for(unsigned int width = 1u; width < 160u; ++width)
+  {
+    for(unsigned int bytesPerPixel = 1u; bytesPerPixel <= 5u; ++bytesPerPixel)
+    {
+      // Five bytes per pixel stands for RGB565:
+      const unsigned int    numBytes = width * (bytesPerPixel == 5u ? 2u : bytesPerPixel);
+      Dali::Vector<uint8_t> scanline1;
+      Dali::Vector<uint8_t> scanline2;
+      Dali::Vector<uint8_t> output;
+      SetupRandomScanline(numBytes, scanline1);
+      SetupRandomScanline(numBytes, scanline2);
+      output.Resize(numBytes + 32u, 0xEE);
+
+      Dali::Vector<uint8_t> reference;
+      reference.Resize(numBytes + 32u, 0xEE);
+      if(bytesPerPixel == 5u)
+      {
+        const uint16_t* pixels1 = reinterpret_cast<const uint16_t*>(&scanline1[0]);
+        const uint16_t* pixels2 = reinterpret_cast<const uint16_t*>(&scanline2[0]);
+        uint16_t*       pixels  = reinterpret_cast<uint16_t*>(&reference[0]);
+        for(unsigned int pixel = 0; pixel < width; ++pixel)
+        {
+          pixels[pixel] = AveragePixelRGB565(pixels1[pixel], pixels2[pixel]);
+        }
+      }
+      else
+      {
+        for(unsigned int component = 0; component < numBytes; ++component)
+        {
+          reference[component] = AverageComponent(scanline1[component], scanline2[component]);
+        }
+      }
+
+      void (*averageScanlines)(const unsigned char* const, const unsigned char* const, unsigned char* const, const unsigned int);
+      switch(bytesPerPixel)
+      {
+        case 1u:
+          averageScanlines = AverageScanlines1;
+          break;
+        case 2u:
+          averageScanlines = AverageScanlines2;
+          break;
+        case 3u:
+          averageScanlines = AverageScanlines3;
+          break;
+        case 4u:
+          averageScanlines = AverageScanlinesRGBA8888;
+          break;
+        default:
+          averageScanlines = AverageScanlinesRGB565;
+          break;
+      }
+
+      averageScanlines(&scanline1[0], &scanline2[0], &output[0], width);
+      DALI_TEST_CHECK(memcmp(&output[0], &reference[0], numBytes + 32u) == 0);
+
+      // The downscaler writes the average over the first scanline:
+      averageScanlines(&scanline1[0], &scanline2[0], &scanline1[0], width);
+      DALI_TEST_CHECK(memcmp(&scanline1[0], &reference[0], numBytes + 32u) == 0);
+    }
+  }
+
+  END_TEST;
+}
+
 namespace
 {
 void MakeSingleColorImageRGBA8888(unsigned int width, unsigned int height, uint32_t* inputImage)
@@ -1431,3 +1632,256 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+/**
+ * @brief Reference for the linear sampling functions, filtering each channel on its own with BilinearFilter1Component().
+ *
+ * A channel is a byte, or a bit field of a 16 bit pixel when fieldWidths is given.
+ */
+void LinearSampleReference(const uint8_t* inPixels, unsigned int inputWidth, unsigned int inputHeight, unsigned int bytesPerPixel, const unsigned int* fieldWidths, uint8_t* outPixels, unsigned int desiredWidth, unsigned int desiredHeight)
+{
+  const unsigned int deltaX = (inputWidth << 16u) / desiredWidth;
+  const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
+
+  for(unsigned int outY = 0, inY = 0; outY < desiredHeight; ++outY, inY += deltaY)
+  {
+    const unsigned int y1 = inY >> 16u;
+    const unsigned int y2 = y1 >= inputHeight ? y1 : y1 + 1;
+    for(unsigned int outX = 0, inX = 0; outX < desiredWidth; ++outX, inX += deltaX)
+    {
+      const unsigned int x1         = inX >> 16u;
+      const unsigned int x2         = x1 >= inputWidth ? x1 : x1 + 1;
+      const uint8_t*     tl         = &inPixels[(y1 * inputWidth + x1) * bytesPerPixel];
+      const uint8_t*     tr         = &inPixels[(y1 * inputWidth + x2) * bytesPerPixel];
+      const uint8_t*     bl         = &inPixels[(y2 * inputWidth + x1) * bytesPerPixel];
+      const uint8_t*     br         = &inPixels[(y2 * inputWidth + x2) * bytesPerPixel];
+      uint8_t*           out        = &outPixels[(outY * desiredWidth + outX) * bytesPerPixel];
+      const unsigned int fractX     = inX & 65535u;
+      const unsigned int fractY     = inY & 65535u;
+
+      if(fieldWidths)
+      {
+        uint16_t tlPixel, trPixel, blPixel, brPixel;
+        memcpy(&tlPixel, tl, 2u);
+        memcpy(&trPixel, tr, 2u);
+        memcpy(&blPixel, bl, 2u);
+        memcpy(&brPixel, br, 2u);
+        uint16_t outPixel = 0;
+        for(unsigned int field = 0, shift = 0; field < 3u; shift += fieldWidths[field], ++field)
+        {
+          const unsigned int mask = (1u << fieldWidths[field]) - 1u;
+          outPixel |= BilinearFilter1Component((tlPixel >> shift) & mask, (trPixel >> shift) & mask, (blPixel >> shift) & mask, (brPixel >> shift) & mask, fractX, fractY) << shift;
+        }
+        memcpy(out, &outPixel, 2u);
+      }
+      else
+      {
+        for(unsigned int component = 0; component < bytesPerPixel; ++component)
+        {
+          out[component] = BilinearFilter1Component(tl[component], tr[component], bl[component], br[component], fractX, fractY);
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Test that the linear sampling functions for each pixel size match filtering their channels one at a time.
+ */
+int UtcDaliImageOperationsLinearSampleMatchesBilinearFilter1Component(void)
+{
+  const unsigned int fieldWidthsRGB565[] = {5u, 6u, 5u};
+  const unsigned int sizes[][4]           = {{61u, 43u, 37u, 19u}, {128u, 128u, 50u, 50u}, {17u, 5u, 3u, 2u}, {40u, 30u, 39u, 29u}};
+
+  srand48(71 * 73);
+  for(auto&& size : sizes)
+  {
+    const unsigned int inputWidth    = size[0];
+    const unsigned int inputHeight   = size[1];
+    const unsigned int desiredWidth  = size[2];
+    const unsigned int desiredHeight = size[3];
+
+    for(unsigned int bytesPerPixel = 1u; bytesPerPixel <= 5u; ++bytesPerPixel)
+    {
+      // Five bytes per pixel stands for RGB565:
+      const unsigned int    pixelSize = bytesPerPixel == 5u ? 2u : bytesPerPixel;
+      Dali::Vector<uint8_t> input;
+      SetupRandomScanline(inputWidth * inputHeight * pixelSize, input);
+      Dali::Vector<uint8_t> output;
+      output.Resize(desiredWidth * desiredHeight * pixelSize, 0u);
+      Dali::Vector<uint8_t> reference;
+      reference.Resize(desiredWidth * desiredHeight * pixelSize, 0u);
+
+      const Dali::ImageDimensions inputDimensions(inputWidth, inputHeight);
+      const Dali::ImageDimensions desiredDimensions(desiredWidth, desiredHeight);
+      switch(bytesPerPixel)
+      {
+        case 1u:
+          LinearSample1BPP(&input[0], inputDimensions, &output[0], desiredDimensions);
+          break;
+        case 2u:
+          LinearSample2BPP(&input[0], inputDimensions, &output[0], desiredDimensions);
+          break;
+        case 3u:
+          LinearSample3BPP(&input[0], inputDimensions, &output[0], desiredDimensions);
+          break;
+        case 4u:
+          LinearSample4BPP(&input[0], inputDimensions, &output[0], desiredDimensions);
+          break;
+        default:
+          LinearSampleRGB565(&input[0], inputDimensions, &output[0], desiredDimensions);
+          break;
+      }
+      LinearSampleReference(&input[0], inputWidth, inputHeight, pixelSize, bytesPerPixel == 5u ? fieldWidthsRGB565 : NULL, &reference[0], desiredWidth, desiredHeight);
+
+      DALI_TEST_CHECK(memcmp(&output[0], &reference[0], output.Count()) == 0);
+    }
+  }
+
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * @brief Resamples an image the way Resample() did before it was split into bands: one Resampler per channel,
+ * fed a whole source row at a time.
+ */
+void ResampleReference(const uint8_t* inPixels, int srcWidth, int srcHeight, uint8_t* outPixels, int dstWidth, int dstHeight, Resampler::Filter filterType, int numChannels, bool hasAlpha)
+{
+  const float ONE_DIV_255               = 1.0f / 255.0f;
+  const int   LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+  const float SOURCE_GAMMA              = 1.75f;
+  const float FILTER_SCALE              = 1.f;
+  const int   ALPHA_CHANNEL             = hasAlpha ? (numChannels - 1) : -1;
+
+  float   srgbToLinear[256];
+  uint8_t linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE];
+  for(int i = 0; i <= 255; ++i)
+  {
+    srgbToLinear[i] = pow(static_cast<float>(i) * ONE_DIV_255, SOURCE_GAMMA);
+  }
+  for(int i = 0; i < LINEAR_TO_SRGB_TABLE_SIZE; ++i)
+  {
+    const int k     = static_cast<int>(255.0f * pow(static_cast<float>(i) * (1.0f / LINEAR_TO_SRGB_TABLE_SIZE), 1.0f / SOURCE_GAMMA) + 0.5f);
+    linearToSrgb[i] = static_cast<uint8_t>(std::min(std::max(k, 0), 255));
+  }
+
+  std::vector<std::unique_ptr<Resampler>> resamplers(numChannels);
+  std::vector<std::vector<float>>         samples(numChannels, std::vector<float>(srcWidth));
+  for(int c = 0; c < numChannels; ++c)
+  {
+    resamplers[c].reset(new Resampler(srcWidth, srcHeight, dstWidth, dstHeight, Resampler::BOUNDARY_CLAMP, 0.0f, 1.0f, filterType, c ? resamplers[0]->get_clist_x() : NULL, c ? resamplers[0]->get_clist_y() : NULL, FILTER_SCALE, FILTER_SCALE));
+  }
+
+  int dstY = 0;
+  for(int srcY = 0; srcY < srcHeight; ++srcY)
+  {
+    const uint8_t* src = &inPixels[srcY * srcWidth * numChannels];
+    for(int x = 0; x < srcWidth; ++x)
+    {
+      for(int c = 0; c < numChannels; ++c)
+      {
+        samples[c][x] = c == ALPHA_CHANNEL ? *src++ * ONE_DIV_255 : srgbToLinear[*src++];
+      }
+    }
+    for(int c = 0; c < numChannels; ++c)
+    {
+      resamplers[c]->put_line(&samples[c][0]);
+    }
+
+    for(;;)
+    {
+      int c = 0;
+      for(; c < numChannels; ++c)
+      {
+        const float* outputSamples = resamplers[c]->get_line();
+        if(!outputSamples)
+        {
+          break;
+        }
+
+        uint8_t* dst = &outPixels[dstY * dstWidth * numChannels + c];
+        for(int x = 0; x < dstWidth; ++x, dst += numChannels)
+        {
+          if(c == ALPHA_CHANNEL)
+          {
+            *dst = static_cast<uint8_t>(std::min(std::max(static_cast<int>(255.0f * outputSamples[x] + 0.5f), 0), 255));
+          }
+          else
+          {
+            *dst = linearToSrgb[std::min(std::max(static_cast<int>(LINEAR_TO_SRGB_TABLE_SIZE * outputSamples[x] + 0.5f), 0), LINEAR_TO_SRGB_TABLE_SIZE - 1)];
+          }
+        }
+      }
+      if(c < numChannels)
+      {
+        break;
+      }
+      ++dstY;
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * @brief Resample an image big enough to be split into bands processed on several threads, and check the result
+ * matches the one of a single Resampler per channel byte for byte.
+ */
+int UtcDaliImageOperationsLanczosSample4BPPLargeImage(void)
+{
+  // Downscaling and upscaling by ratios which don't divide the image, so the bands don't line up with the source rows
+  const unsigned int sizes[][4] = {{640u, 960u, 301u, 457u}, {200u, 300u, 317u, 419u}};
+
+  for(auto&& size : sizes)
+  {
+    const unsigned int inputWidth    = size[0];
+    const unsigned int inputHeight   = size[1];
+    const unsigned int desiredWidth  = size[2];
+    const unsigned int desiredHeight = size[3];
+
+    // Noise with a varying alpha, over smooth gradients so the filter ringing is exercised too:
+    Dali::Vector<uint8_t> input;
+    SetupRandomScanline(inputWidth * inputHeight * 4u, input);
+    for(unsigned int y = 0; y < inputHeight; ++y)
+    {
+      for(unsigned int x = 0; x < inputWidth; ++x)
+      {
+        uint8_t* pixel = &input[(y * inputWidth + x) * 4u];
+        if((x / 16u + y / 16u) % 2u == 0u)
+        {
+          pixel[0] = static_cast<uint8_t>((y * 255u) / (inputHeight - 1u));
+          pixel[1] = static_cast<uint8_t>((x * 255u) / (inputWidth - 1u));
+        }
+      }
+    }
+
+    Dali::Vector<uint8_t> output;
+    output.Resize(desiredWidth * desiredHeight * 4u, 0u);
+    LanczosSample4BPP(&input[0], ImageDimensions(inputWidth, inputHeight), &output[0], ImageDimensions(desiredWidth, desiredHeight));
+
+    Dali::Vector<uint8_t> reference;
+    reference.Resize(desiredWidth * desiredHeight * 4u, 0u);
+    ResampleReference(&input[0], inputWidth, inputHeight, &reference[0], desiredWidth, desiredHeight, Resampler::LANCZOS4, 4, true);
+
+    DALI_TEST_CHECK(memcmp(&output[0], &reference[0], output.Count()) == 0);
+
+    // The single channel path, whose first channel isn't an alpha channel
+    Dali::Vector<uint8_t> output1BPP;
+    output1BPP.Resize(desiredWidth * desiredHeight, 0u);
+    LanczosSample1BPP(&input[0], ImageDimensions(inputWidth, inputHeight), &output1BPP[0], ImageDimensions(desiredWidth, desiredHeight));
+
+    Dali::Vector<uint8_t> reference1BPP;
+    reference1BPP.Resize(desiredWidth * desiredHeight, 0u);
+    ResampleReference(&input[0], inputWidth, inputHeight, &reference1BPP[0], desiredWidth, desiredHeight, Resampler::LANCZOS4, 1, false);
+
+    DALI_TEST_CHECK(memcmp(&output1BPP[0], &reference1BPP[0], output1BPP.Count()) == 0);
+  }
+
+  END_TEST;
+}
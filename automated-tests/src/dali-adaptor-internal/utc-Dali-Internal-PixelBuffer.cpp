@@ -19,11 +19,14 @@
 
 #include <dali/public-api/dali-core.h>
 #include <stdlib.h>
+#include <cstring>
 
 #include <dali-test-suite-utils.h>
 
 // Internal headers are allowed here
 
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 
 using namespace Dali;
@@ -199,3 +202,67 @@ int UtcDaliPixelManipulation03N(void)
 
   END_TEST;
 }
+
+int UtcDaliPixelBufferConvertPixelFormat(void)
+{
+  tet_infoline("Testing that the fused conversion gives the same output as the generic one");
+
+  const Dali::Pixel::Format sourceFormats[] = {Dali::Pixel::RGBA8888, Dali::Pixel::BGRA8888};
+  const Dali::Pixel::Format targetFormats[] = {Dali::Pixel::A8, Dali::Pixel::RGB888, Dali::Pixel::RGB8888, Dali::Pixel::BGR8888, Dali::Pixel::RGBA8888, Dali::Pixel::BGRA8888};
+
+  for(Dali::Pixel::Format sourceFormat : sourceFormats)
+  {
+    for(Dali::Pixel::Format targetFormat : targetFormats)
+    {
+      for(int multiply = 0; multiply < 2; ++multiply)
+      {
+        Devel::PixelBuffer expected = Devel::PixelBuffer::New(17, 9, sourceFormat);
+        Devel::PixelBuffer actual   = Devel::PixelBuffer::New(17, 9, sourceFormat);
+        for(unsigned int i = 0; i < 17u * 9u * 4u; ++i)
+        {
+          expected.GetBuffer()[i] = actual.GetBuffer()[i] = static_cast<unsigned char>(i * 29u);
+        }
+
+        if(multiply)
+        {
+          expected.MultiplyColorByAlpha();
+        }
+        GetImplementation(expected).ConvertPixelFormat(targetFormat);
+
+        Devel::PixelBuffer::Operations operations;
+        operations.multiplyColorByAlpha = multiply;
+        operations.pixelFormat          = targetFormat;
+        actual.ApplyOperations(operations);
+
+        tet_printf("Testing the conversion from %s to %s\n", FormatToString(sourceFormat), FormatToString(targetFormat));
+        DALI_TEST_EQUALS(actual.GetPixelFormat(), targetFormat, TEST_LOCATION);
+        DALI_TEST_EQUALS(memcmp(expected.GetBuffer(), actual.GetBuffer(), 17u * 9u * Dali::Pixel::GetBytesPerPixel(targetFormat)), 0, TEST_LOCATION);
+      }
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferConvertPixelFormatLuminance(void)
+{
+  tet_infoline("Testing the conversion of a buffer without color channels");
+
+  Devel::PixelBuffer imageData = Devel::PixelBuffer::New(4, 4, Dali::Pixel::LA88);
+  for(unsigned int i = 0; i < 4u * 4u; ++i)
+  {
+    imageData.GetBuffer()[i * 2]     = 0x80;
+    imageData.GetBuffer()[i * 2 + 1] = 0x20;
+  }
+
+  GetImplementation(imageData).ConvertPixelFormat(Dali::Pixel::RGBA8888);
+  DALI_TEST_EQUALS(imageData.GetPixelFormat(), Dali::Pixel::RGBA8888, TEST_LOCATION);
+
+  const unsigned char* pixel = imageData.GetBuffer();
+  DALI_TEST_EQUALS(pixel[0], 0x80, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixel[1], 0x80, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixel[2], 0x80, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixel[3], 0x20, TEST_LOCATION);
+
+  END_TEST;
+}
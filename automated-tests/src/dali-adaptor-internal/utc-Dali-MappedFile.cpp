@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/file-reader.h>
+#include <dali/internal/system/common/mapped-file.h>
+#include <stdlib.h>
+#include <cstring>
+#include <utility>
+
+#include "image-loaders.h"
+
+using namespace Dali;
+using Dali::Internal::Platform::MappedFile;
+
+void utc_dali_mapped_file_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_mapped_file_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliMappedFileRegularFile(void)
+{
+  FILE*         fp = fopen(TEST_IMAGE_DIR "/pattern.gif", "rb");
+  AutoCloseFile autoClose(fp);
+  DALI_TEST_CHECK(fp != NULL);
+
+  fseek(fp, 0, SEEK_END);
+  const long fileSize = ftell(fp);
+  fseek(fp, 3, SEEK_SET);
+
+  tet_infoline("Test that a regular file is mapped whole, without moving the stream");
+  MappedFile mappedFile(fp);
+  DALI_TEST_CHECK(mappedFile.IsMapped());
+  DALI_TEST_EQUALS(mappedFile.GetSize(), static_cast<size_t>(fileSize), TEST_LOCATION);
+  DALI_TEST_EQUALS(ftell(fp), 3L, TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(mappedFile.GetData(), "GIF", 3u) == 0);
+
+  tet_infoline("Test that the mapping can be moved");
+  const uint8_t* data = mappedFile.GetData();
+  MappedFile     movedFile(std::move(mappedFile));
+  DALI_TEST_CHECK(!mappedFile.IsMapped());
+  DALI_TEST_CHECK(movedFile.IsMapped());
+  DALI_TEST_CHECK(movedFile.GetData() == data);
+
+  END_TEST;
+}
+
+int UtcDaliMappedFileMemoryStream(void)
+{
+  Dali::Vector<uint8_t> buffer;
+  buffer.Resize(16u, 0u);
+  Internal::Platform::FileReader fileReader(buffer);
+  DALI_TEST_CHECK(fileReader.GetFile() != NULL);
+
+  tet_infoline("Test that a stream without a file is not mapped");
+  MappedFile mappedFile(fileReader.GetFile());
+  DALI_TEST_CHECK(!mappedFile.IsMapped());
+  DALI_TEST_CHECK(mappedFile.GetData() == NULL);
+  DALI_TEST_EQUALS(mappedFile.GetSize(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  MappedFile nullFile(NULL);
+  DALI_TEST_CHECK(!nullFile.IsMapped());
+
+  END_TEST;
+}
+
+int UtcDaliMappedFileMinimumSize(void)
+{
+  FILE*         fp = fopen(TEST_IMAGE_DIR "/pattern.gif", "rb");
+  AutoCloseFile autoClose(fp);
+  DALI_TEST_CHECK(fp != NULL);
+
+  fseek(fp, 0, SEEK_END);
+  const size_t fileSize = static_cast<size_t>(ftell(fp));
+  fseek(fp, 0, SEEK_SET);
+
+  tet_infoline("Test that a file smaller than the minimum size is not mapped");
+  DALI_TEST_CHECK(fileSize < MappedFile::MINIMUM_IMAGE_SIZE);
+  DALI_TEST_CHECK(!MappedFile(fp, MappedFile::MINIMUM_IMAGE_SIZE).IsMapped());
+  DALI_TEST_CHECK(!MappedFile(fp, fileSize + 1u).IsMapped());
+  DALI_TEST_CHECK(MappedFile(fp, fileSize).IsMapped());
+
+  tet_infoline("Test that a large image file is mapped");
+  FILE*         largeFp = fopen(TEST_IMAGE_DIR "/error-bits.gif", "rb");
+  AutoCloseFile autoCloseLarge(largeFp);
+  DALI_TEST_CHECK(largeFp != NULL);
+  DALI_TEST_CHECK(MappedFile(largeFp, MappedFile::MINIMUM_IMAGE_SIZE).IsMapped());
+
+  END_TEST;
+}
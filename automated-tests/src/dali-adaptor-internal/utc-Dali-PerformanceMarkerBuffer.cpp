@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/performance-marker-buffer.h>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+PerformanceMarkerBuffer::Record CreateRecord(uint64_t microseconds)
+{
+  PerformanceMarkerBuffer::Record record;
+  record.microseconds = microseconds;
+  record.type         = PerformanceInterface::UPDATE_START;
+  return record;
+}
+
+} // unnamed namespace
+
+void utc_dali_performance_marker_buffer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_performance_marker_buffer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliPerformanceMarkerBufferPushPop(void)
+{
+  // The capacity is rounded up to 4.
+  PerformanceMarkerBuffer buffer(3u, 42);
+
+  std::vector<PerformanceMarkerBuffer::Record> records;
+  DALI_TEST_EQUALS(buffer.Pop(records), 0u, TEST_LOCATION);
+
+  for(uint64_t time = 0u; time < 4u; ++time)
+  {
+    DALI_TEST_CHECK(buffer.Push(CreateRecord(time)));
+  }
+
+  // Full: the record is dropped rather than waited for.
+  DALI_TEST_CHECK(!buffer.Push(CreateRecord(4u)));
+  DALI_TEST_EQUALS(buffer.TakeDroppedCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer.TakeDroppedCount(), 0u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(buffer.Pop(records), 4u, TEST_LOCATION);
+  for(uint64_t time = 0u; time < 4u; ++time)
+  {
+    DALI_TEST_EQUALS(records[time].microseconds, time, TEST_LOCATION);
+    DALI_TEST_EQUALS(records[time].threadId, 42, TEST_LOCATION);
+  }
+
+  // The slots are reused once popped, across the end of the ring.
+  DALI_TEST_CHECK(buffer.Push(CreateRecord(5u)));
+  DALI_TEST_CHECK(buffer.Push(CreateRecord(6u)));
+  DALI_TEST_EQUALS(buffer.Pop(records), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(records.size(), 6u, TEST_LOCATION);
+  DALI_TEST_EQUALS(records[5].microseconds, static_cast<uint64_t>(6u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMarkerBufferConcurrent(void)
+{
+  // Every record pushed by the writer is either popped once, in order, or counted as dropped.
+  const uint64_t          recordCount = 200000u;
+  PerformanceMarkerBuffer buffer(64u, 42);
+
+  std::thread writer([&buffer, recordCount]() {
+    for(uint64_t time = 0u; time < recordCount; ++time)
+    {
+      buffer.Push(CreateRecord(time));
+    }
+  });
+
+  std::vector<PerformanceMarkerBuffer::Record> records;
+  uint64_t                                     dropped = 0u;
+  bool                                         ordered = true;
+  while(records.size() + dropped < recordCount)
+  {
+    const size_t first = records.size();
+    buffer.Pop(records);
+    dropped += buffer.TakeDroppedCount();
+    for(size_t index = std::max<size_t>(first, 1u); index < records.size(); ++index)
+    {
+      ordered = ordered && records[index - 1u].microseconds < records[index].microseconds;
+    }
+  }
+  writer.join();
+
+  DALI_TEST_CHECK(ordered);
+  DALI_TEST_EQUALS(records.size() + dropped, static_cast<size_t>(recordCount), TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer.Pop(records), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
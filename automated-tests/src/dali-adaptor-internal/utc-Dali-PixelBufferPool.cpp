@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/pixel-buffer-pool.h>
+#include <stdlib.h>
+#include <cstring>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_pixel_buffer_pool_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_pixel_buffer_pool_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliPixelBufferPoolReuse(void)
+{
+  PixelBufferPool pool(1024u * 1024u);
+
+  // Small buffers are not pooled.
+  unsigned char* smallBuffer = pool.Allocate(1000u);
+  DALI_TEST_CHECK(smallBuffer);
+  pool.Release(smallBuffer, 1000u);
+  DALI_TEST_EQUALS(pool.GetStatistics().allocations, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pool.GetStatistics().cachedBuffers, 0u, TEST_LOCATION);
+
+  unsigned char* buffer = pool.Allocate(100000u);
+  DALI_TEST_CHECK(buffer);
+  memset(buffer, 1, 100000u);
+  pool.Release(buffer, 100000u);
+  DALI_TEST_EQUALS(pool.GetStatistics().cachedBuffers, 1u, TEST_LOCATION);
+
+  // A size of the same class reuses the buffer.
+  unsigned char* reusedBuffer = pool.Allocate(110000u);
+  DALI_TEST_CHECK(reusedBuffer == buffer);
+  memset(reusedBuffer, 2, 110000u);
+
+  // A size of another class doesn't.
+  unsigned char* otherBuffer = pool.Allocate(90000u);
+  DALI_TEST_CHECK(otherBuffer != reusedBuffer);
+
+  PixelBufferPool::Statistics statistics = pool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.allocations, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.reuses, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.cachedBuffers, 0u, TEST_LOCATION);
+
+  // The pooled buffers may be freed instead of released.
+  free(otherBuffer);
+  pool.Release(reusedBuffer, 110000u);
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferPoolBudgetAndTrim(void)
+{
+  PixelBufferPool pool(200000u);
+
+  unsigned char* firstBuffer  = pool.Allocate(100000u);
+  unsigned char* secondBuffer = pool.Allocate(100000u);
+  pool.Release(firstBuffer, 100000u);
+  pool.Release(secondBuffer, 100000u);
+
+  // Only one buffer fits the budget.
+  PixelBufferPool::Statistics statistics = pool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.cachedBuffers, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.cachedSize >= 100000u);
+  DALI_TEST_CHECK(statistics.cachedSize <= 200000u);
+
+  pool.Trim();
+  statistics = pool.GetStatistics();
+  DALI_TEST_EQUALS(statistics.cachedBuffers, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.cachedSize, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferPoolPixelBufferOperations(void)
+{
+  PixelBufferPool& pool = PixelBufferPool::Get();
+  pool.Trim();
+  const uint32_t reuses = pool.GetStatistics().reuses;
+
+  // Resizing and cropping release their intermediate buffers to the pool.
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New(400u, 300u, Pixel::RGBA8888);
+  memset(pixelBuffer.GetBuffer(), 0xff, 400u * 300u * 4u);
+  pixelBuffer.Resize(200u, 150u);
+  pixelBuffer.Crop(0u, 0u, 200u, 100u);
+  pixelBuffer.Reset();
+  DALI_TEST_CHECK(pool.GetStatistics().cachedBuffers > 0u);
+
+  Devel::PixelBuffer otherPixelBuffer = Devel::PixelBuffer::New(400u, 300u, Pixel::RGBA8888);
+  DALI_TEST_CHECK(otherPixelBuffer.GetBuffer());
+  DALI_TEST_CHECK(pool.GetStatistics().reuses > reuses);
+
+  // The buffer handed over to a PixelData is freed by it.
+  PixelData pixelData = Devel::PixelBuffer::Convert(otherPixelBuffer);
+  DALI_TEST_EQUALS(pixelData.GetWidth(), 400u, TEST_LOCATION);
+
+  END_TEST;
+}
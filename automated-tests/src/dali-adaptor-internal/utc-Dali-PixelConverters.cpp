@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/imaging/common/pixel-converters.h>
+#include <cstring>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+/**
+ * Fills a buffer so every channel of the pixels takes every byte value, in a different order per channel.
+ * With 65536 pixels of 2 bytes, every 16 bit value appears.
+ */
+std::vector<uint8_t> CreateInput(Pixel::Format format, unsigned int width)
+{
+  const unsigned int   bytesPerPixel = Pixel::GetBytesPerPixel(format);
+  std::vector<uint8_t> input(width * bytesPerPixel);
+  for(unsigned int x = 0u; x < width; ++x)
+  {
+    for(unsigned int byte = 0u; byte < bytesPerPixel; ++byte)
+    {
+      input[x * bytesPerPixel + byte] = static_cast<uint8_t>(byte == 1u && bytesPerPixel == 2u ? x >> 8u : x * (2u * byte + 1u) + byte * 85u);
+    }
+  }
+  return input;
+}
+
+/**
+ * Checks a specialized converter gives the same output as the generic one, for all the byte values and for
+ * widths that end the SIMD loops at every position.
+ */
+bool CheckConverter(Pixel::Format inFormat, Pixel::Format outFormat)
+{
+  ConvertRowFunction convertRow = GetConvertRowFunction(inFormat, outFormat);
+  if(!convertRow)
+  {
+    tet_printf("No converter from %d to %d\n", inFormat, outFormat);
+    return false;
+  }
+
+  const unsigned int outBytesPerPixel = Pixel::GetBytesPerPixel(outFormat);
+  const unsigned int widths[]         = {1u, 3u, 7u, 8u, 15u, 16u, 17u, 31u, 33u, 65536u, 65539u};
+  for(unsigned int width : widths)
+  {
+    const std::vector<uint8_t> input = CreateInput(inFormat, width);
+
+    std::vector<uint8_t> expected(width * outBytesPerPixel);
+    ConvertRow(input.data(), inFormat, expected.data(), outFormat, width);
+
+    // One more pixel, which must not be written.
+    std::vector<uint8_t> output((width + 1u) * outBytesPerPixel, 0x5Au);
+    convertRow(input.data(), output.data(), width);
+
+    if(memcmp(expected.data(), output.data(), expected.size()) != 0 || output[width * outBytesPerPixel] != 0x5Au)
+    {
+      tet_printf("Converter from %d to %d differs for a width of %u\n", inFormat, outFormat, width);
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Creates pixels with every pair of a channel value and an alpha or factor value.
+ */
+std::vector<uint8_t> CreatePairs(unsigned int bytesPerPixel, unsigned int secondByte)
+{
+  std::vector<uint8_t> pixels(65536u * bytesPerPixel);
+  for(unsigned int x = 0u; x < 65536u; ++x)
+  {
+    for(unsigned int byte = 0u; byte < bytesPerPixel; ++byte)
+    {
+      pixels[x * bytesPerPixel + byte] = static_cast<uint8_t>(byte == secondByte ? x >> 8u : x + byte * 85u);
+    }
+  }
+  return pixels;
+}
+
+} // unnamed namespace
+
+void utc_dali_pixel_converters_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_pixel_converters_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliPixelConvertersToRgba(void)
+{
+  const Pixel::Format formats[] = {Pixel::RGB888, Pixel::BGRA8888, Pixel::L8, Pixel::A8, Pixel::LA88, Pixel::RGB565, Pixel::BGR565, Pixel::RGB8888, Pixel::BGR8888};
+  for(Pixel::Format format : formats)
+  {
+    DALI_TEST_CHECK(CheckConverter(format, Pixel::RGBA8888));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelConvertersFromRgba(void)
+{
+  DALI_TEST_CHECK(CheckConverter(Pixel::RGBA8888, Pixel::RGB888));
+  DALI_TEST_CHECK(CheckConverter(Pixel::RGBA8888, Pixel::BGRA8888));
+
+  // The X pixmaps of depth 24 and 32 are read as BGR8888 and BGRA8888.
+  DALI_TEST_CHECK(CheckConverter(Pixel::BGRA8888, Pixel::RGB888));
+  DALI_TEST_CHECK(CheckConverter(Pixel::BGR8888, Pixel::RGB888));
+
+  // The other pairs are left to the generic converter.
+  DALI_TEST_CHECK(!GetConvertRowFunction(Pixel::RGB888, Pixel::BGRA8888));
+  DALI_TEST_CHECK(!GetConvertRowFunction(Pixel::RGBA4444, Pixel::RGBA8888));
+
+  END_TEST;
+}
+
+int UtcDaliPixelConvertersMultiplyColorByAlpha(void)
+{
+  const Pixel::Format formats[] = {Pixel::RGBA8888, Pixel::BGRA8888, Pixel::LA88};
+  for(Pixel::Format format : formats)
+  {
+    MultiplyColorByAlphaRowFunction multiplyRow = GetMultiplyColorByAlphaRowFunction(format);
+    DALI_TEST_CHECK(multiplyRow);
+
+    // Every color value with every alpha value, which is the last byte.
+    const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel(format);
+    for(unsigned int width : {65536u, 65533u, 3u})
+    {
+      std::vector<uint8_t> expected = CreatePairs(bytesPerPixel, bytesPerPixel - 1u);
+      std::vector<uint8_t> output   = expected;
+      MultiplyColorByAlphaRow(expected.data(), format, width);
+      multiplyRow(output.data(), width);
+      DALI_TEST_CHECK(expected == output);
+    }
+  }
+
+  DALI_TEST_CHECK(!GetMultiplyColorByAlphaRowFunction(Pixel::RGBA4444));
+
+  END_TEST;
+}
+
+int UtcDaliPixelConvertersMultiply(void)
+{
+  const Pixel::Format formats[] = {Pixel::A8, Pixel::L8, Pixel::LA88, Pixel::RGB888, Pixel::RGBA8888, Pixel::BGRA8888};
+  for(Pixel::Format format : formats)
+  {
+    MultiplyRowFunction multiplyRow = GetMultiplyRowFunction(format);
+    DALI_TEST_CHECK(multiplyRow);
+
+    // Every channel value with every factor, taken from the second byte of a 2 byte mask.
+    const std::vector<uint8_t> factors       = CreatePairs(2u, 1u);
+    const unsigned int         bytesPerPixel = Pixel::GetBytesPerPixel(format);
+    std::vector<uint8_t>       expected      = CreatePairs(bytesPerPixel, bytesPerPixel);
+    for(unsigned int x = 0u; x < 65536u; ++x)
+    {
+      expected[x * bytesPerPixel] = factors[x * 2u];
+    }
+    std::vector<uint8_t> output = expected;
+
+    MultiplyRow(expected.data(), format, factors.data() + 1u, 2u, 65536u);
+    multiplyRow(output.data(), factors.data() + 1u, 2u, 65536u);
+    DALI_TEST_CHECK(expected == output);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelConvertersRgbaToI420(void)
+{
+  // 3x3 pixels, so the last chroma row and column average fewer pixels.
+  const uint8_t white[] = {255u, 255u, 255u, 255u};
+  const uint8_t red[]   = {255u, 0u, 0u, 255u};
+  const uint8_t blue[]  = {0u, 0u, 255u, 0u};
+
+  std::vector<uint8_t> rgba;
+  for(const uint8_t* pixel : {white, white, red, white, white, red, blue, blue, blue})
+  {
+    rgba.insert(rgba.end(), pixel, pixel + 4u);
+  }
+
+  std::vector<uint8_t> y(9u), u(4u), v(4u);
+  ConvertRgbaToI420(rgba.data(), 3u, 3u, y.data(), u.data(), v.data());
+
+  // JFIF: Y = 0.299 R + 0.587 G + 0.114 B, Cb = 128 - 0.1687 R - 0.3313 G + 0.5 B, Cr = 128 + 0.5 R - 0.4187 G - 0.0813 B
+  DALI_TEST_CHECK(y == std::vector<uint8_t>({255u, 255u, 77u, 255u, 255u, 77u, 29u, 29u, 29u}));
+  DALI_TEST_CHECK(u == std::vector<uint8_t>({128u, 85u, 255u, 255u}));
+  DALI_TEST_CHECK(v == std::vector<uint8_t>({128u, 255u, 107u, 107u}));
+
+  END_TEST;
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/internal/legacy/common/shader-binary-cache.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::TizenPlatform;
+
+void utc_dali_shader_binary_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_shader_binary_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const CACHE_DIRECTORY = "/tmp/utc-dali-shader-binary-cache/";
+const char* const DRIVER          = "Vendor\nRenderer\nOpenGL ES 3.2\n";
+
+std::string GetCacheDirectory()
+{
+  mkdir(CACHE_DIRECTORY, 0700);
+  return CACHE_DIRECTORY;
+}
+
+void RemoveCache(const std::vector<std::string>& names)
+{
+  for(const auto& name : names)
+  {
+    unlink((std::string(CACHE_DIRECTORY) + name).c_str());
+  }
+  unlink((std::string(CACHE_DIRECTORY) + "dali-shader-binaries.idx").c_str());
+}
+
+std::vector<unsigned char> CreateBinary(unsigned char seed, size_t size)
+{
+  std::vector<unsigned char> binary(size);
+  for(size_t index = 0u; index < size; ++index)
+  {
+    binary[index] = static_cast<unsigned char>(seed + index * 7u);
+  }
+  return binary;
+}
+
+bool LoadsBinary(ShaderBinaryCache& cache, const std::string& name, const std::vector<unsigned char>& binary)
+{
+  Dali::Vector<unsigned char> buffer;
+  return cache.Load(name, buffer) && (buffer.Count() == binary.size()) && std::equal(binary.begin(), binary.end(), buffer.Begin());
+}
+
+} // namespace
+
+int UtcDaliShaderBinaryCacheSaveAndLoad(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin", "shader-b.bin"};
+  RemoveCache(names);
+
+  const std::vector<unsigned char> binaryA = CreateBinary(1u, 1000u);
+  const std::vector<unsigned char> binaryB = CreateBinary(2u, 3000u);
+  {
+    ShaderBinaryCache cache;
+    cache.SetDirectory(GetCacheDirectory());
+    cache.SetDriver(DRIVER);
+    DALI_TEST_CHECK(cache.Save(names[0], binaryA.data(), binaryA.size()));
+    DALI_TEST_CHECK(cache.Save(names[1], binaryB.data(), binaryB.size()));
+    DALI_TEST_CHECK(LoadsBinary(cache, names[0], binaryA));
+  }
+
+  // The binaries are found by another cache reading the index.
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+  cache.SetDriver(DRIVER);
+  DALI_TEST_CHECK(LoadsBinary(cache, names[0], binaryA));
+  DALI_TEST_CHECK(LoadsBinary(cache, names[1], binaryB));
+
+  Dali::Vector<unsigned char> buffer;
+  DALI_TEST_CHECK(!cache.Load("shader-c.bin", buffer));
+
+  ShaderBinaryCache::Statistics statistics = cache.GetStatistics();
+  DALI_TEST_EQUALS(statistics.fileHits, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.misses, 1u, TEST_LOCATION);
+
+  RemoveCache(names);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheCorruptedBinary(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin"};
+  RemoveCache(names);
+
+  const std::vector<unsigned char> binary = CreateBinary(3u, 500u);
+  {
+    ShaderBinaryCache cache;
+    cache.SetDirectory(GetCacheDirectory());
+    DALI_TEST_CHECK(cache.Save(names[0], binary.data(), binary.size()));
+  }
+
+  // Overwrites a byte of the binary.
+  FILE* file = fopen((std::string(CACHE_DIRECTORY) + names[0]).c_str(), "r+b");
+  DALI_TEST_CHECK(file);
+  fseek(file, 100, SEEK_SET);
+  fputc(binary[100] + 1, file);
+  fclose(file);
+
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+
+  Dali::Vector<unsigned char> buffer;
+  DALI_TEST_CHECK(!cache.Load(names[0], buffer));
+  DALI_TEST_EQUALS(buffer.Count(), 0u, TEST_LOCATION);
+
+  // The corrupted binary is removed.
+  DALI_TEST_CHECK(access((std::string(CACHE_DIRECTORY) + names[0]).c_str(), F_OK) != 0);
+
+  RemoveCache(names);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheDriverChanged(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin"};
+  RemoveCache(names);
+
+  const std::vector<unsigned char> binary = CreateBinary(4u, 500u);
+  {
+    ShaderBinaryCache cache;
+    cache.SetDirectory(GetCacheDirectory());
+    cache.SetDriver(DRIVER);
+    DALI_TEST_CHECK(cache.Save(names[0], binary.data(), binary.size()));
+  }
+
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+  cache.SetDriver("Vendor\nRenderer\nOpenGL ES 3.2 updated\n");
+
+  Dali::Vector<unsigned char> buffer;
+  DALI_TEST_CHECK(!cache.Load(names[0], buffer));
+  DALI_TEST_CHECK(access((std::string(CACHE_DIRECTORY) + names[0]).c_str(), F_OK) != 0);
+
+  RemoveCache(names);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheEviction(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin", "shader-b.bin", "shader-c.bin"};
+  RemoveCache(names);
+
+  const std::vector<unsigned char> binaryA = CreateBinary(5u, 400u);
+  const std::vector<unsigned char> binaryB = CreateBinary(6u, 400u);
+  const std::vector<unsigned char> binaryC = CreateBinary(7u, 400u);
+
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+  cache.SetMaximumSize(1000u);
+  DALI_TEST_CHECK(cache.Save(names[0], binaryA.data(), binaryA.size()));
+  DALI_TEST_CHECK(cache.Save(names[1], binaryB.data(), binaryB.size()));
+
+  // A is used more recently than B, so B is evicted to make room for C.
+  DALI_TEST_CHECK(LoadsBinary(cache, names[0], binaryA));
+  DALI_TEST_CHECK(cache.Save(names[2], binaryC.data(), binaryC.size()));
+
+  DALI_TEST_CHECK(LoadsBinary(cache, names[0], binaryA));
+  DALI_TEST_CHECK(LoadsBinary(cache, names[2], binaryC));
+
+  Dali::Vector<unsigned char> buffer;
+  DALI_TEST_CHECK(!cache.Load(names[1], buffer));
+
+  // A binary bigger than the cache is not saved.
+  const std::vector<unsigned char> binaryD = CreateBinary(8u, 2000u);
+  DALI_TEST_CHECK(!cache.Save("shader-d.bin", binaryD.data(), binaryD.size()));
+
+  RemoveCache(names);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCachePreload(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin", "shader-b.bin", "shader-c.bin"};
+  RemoveCache(names);
+
+  std::vector<std::vector<unsigned char>> binaries;
+  {
+    ShaderBinaryCache cache;
+    cache.SetDirectory(GetCacheDirectory());
+    cache.SetDriver(DRIVER);
+    for(size_t index = 0u; index < names.size(); ++index)
+    {
+      binaries.push_back(CreateBinary(static_cast<unsigned char>(index), 2000u));
+      DALI_TEST_CHECK(cache.Save(names[index], binaries[index].data(), binaries[index].size()));
+    }
+  }
+
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+  cache.Preload(std::vector<std::string>());
+  cache.SetDriver(DRIVER);
+
+  // Loading waits for the binaries being preloaded.
+  for(size_t index = 0u; index < names.size(); ++index)
+  {
+    DALI_TEST_CHECK(LoadsBinary(cache, names[index], binaries[index]));
+  }
+
+  ShaderBinaryCache::Statistics statistics = cache.GetStatistics();
+  DALI_TEST_EQUALS(statistics.preloadHits, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.fileHits, 0u, TEST_LOCATION);
+
+  RemoveCache(names);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheReleasePreloaded(void)
+{
+  const std::vector<std::string> names = {"shader-a.bin", "shader-b.bin", "shader-c.bin"};
+  RemoveCache(names);
+
+  std::vector<std::vector<unsigned char>> binaries;
+  {
+    ShaderBinaryCache cache;
+    cache.SetDirectory(GetCacheDirectory());
+    cache.SetDriver(DRIVER);
+    for(size_t index = 0u; index < names.size(); ++index)
+    {
+      binaries.push_back(CreateBinary(static_cast<unsigned char>(index), 2000u));
+      DALI_TEST_CHECK(cache.Save(names[index], binaries[index].data(), binaries[index].size()));
+    }
+  }
+
+  ShaderBinaryCache cache;
+  cache.SetDirectory(GetCacheDirectory());
+  cache.Preload(std::vector<std::string>());
+  cache.SetDriver(DRIVER);
+
+  // The least recently used binary is preloaded last, so the others are preloaded once it is loaded.
+  DALI_TEST_CHECK(LoadsBinary(cache, names[0], binaries[0]));
+  cache.ReleasePreloaded();
+
+  // The binaries released are read from their files.
+  DALI_TEST_CHECK(LoadsBinary(cache, names[1], binaries[1]));
+  DALI_TEST_CHECK(LoadsBinary(cache, names[2], binaries[2]));
+
+  ShaderBinaryCache::Statistics statistics = cache.GetStatistics();
+  DALI_TEST_EQUALS(statistics.preloadHits, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.fileHits, 2u, TEST_LOCATION);
+
+  RemoveCache(names);
+
+  END_TEST;
+}
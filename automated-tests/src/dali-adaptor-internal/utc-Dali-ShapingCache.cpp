@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/shaping.h>
+#include <dali/internal/text/text-abstraction/shaping-cache.h>
+#include <dali/internal/text/text-abstraction/shaping-impl.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+using namespace Dali::TextAbstraction::Internal;
+
+void utc_dali_shaping_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_shaping_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+// "مرحبا" and "नमस्ते", a right to left and a complex script.
+const Character ARABIC_TEXT[]     = {0x0645, 0x0631, 0x062D, 0x0628, 0x0627};
+const Character DEVANAGARI_TEXT[] = {0x0928, 0x092E, 0x0938, 0x094D, 0x0924, 0x0947};
+const Character LATIN_TEXT[]      = {'H', 'e', 'l', 'l', 'o'};
+
+/**
+ * Creates a run with a glyph per character, but with the glyphs in the reverse order as a right to left shaper would.
+ */
+std::shared_ptr<ShapedRun> CreateRun(const Character* text, Length numberOfCharacters, float advance)
+{
+  std::shared_ptr<ShapedRun> run(new ShapedRun);
+  for(Length index = 0u; index < numberOfCharacters; ++index)
+  {
+    const Length characterIndex = numberOfCharacters - 1u - index;
+    run->indices.PushBack(text[characterIndex] & 0xff);
+    run->advance.PushBack(advance);
+    run->offset.PushBack(0.f);
+    run->offset.PushBack(-1.f);
+    run->characterMap.PushBack(characterIndex);
+  }
+  return run;
+}
+
+bool RunsAreEqual(const ShapedRun& lhs, const ShapedRun& rhs)
+{
+  if(lhs.indices.Count() != rhs.indices.Count() ||
+     lhs.advance.Count() != rhs.advance.Count() ||
+     lhs.offset.Count() != rhs.offset.Count() ||
+     lhs.characterMap.Count() != rhs.characterMap.Count())
+  {
+    return false;
+  }
+
+  for(Length index = 0u; index < lhs.indices.Count(); ++index)
+  {
+    if(lhs.indices[index] != rhs.indices[index] ||
+       lhs.advance[index] != rhs.advance[index] ||
+       lhs.offset[2u * index] != rhs.offset[2u * index] ||
+       lhs.offset[2u * index + 1u] != rhs.offset[2u * index + 1u] ||
+       lhs.characterMap[index] != rhs.characterMap[index])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * The glyphs of a text shaped by the shaping singleton.
+ */
+struct ShapedText
+{
+  std::vector<GlyphInfo>      glyphs;
+  std::vector<CharacterIndex> glyphToCharacterMap;
+};
+
+ShapedText Shape(TextAbstraction::Shaping& shaping, const Character* text, Length numberOfCharacters, FontId fontId, Script script)
+{
+  ShapedText   shapedText;
+  const Length numberOfGlyphs = shaping.Shape(text, numberOfCharacters, fontId, script);
+  shapedText.glyphs.resize(numberOfGlyphs);
+  shapedText.glyphToCharacterMap.resize(numberOfGlyphs);
+  shaping.GetGlyphs(shapedText.glyphs.data(), shapedText.glyphToCharacterMap.data());
+  return shapedText;
+}
+
+bool ShapedTextsAreEqual(const ShapedText& lhs, const ShapedText& rhs)
+{
+  if(lhs.glyphs.size() != rhs.glyphs.size())
+  {
+    return false;
+  }
+
+  for(size_t index = 0u; index < lhs.glyphs.size(); ++index)
+  {
+    const GlyphInfo& lhsGlyph = lhs.glyphs[index];
+    const GlyphInfo& rhsGlyph = rhs.glyphs[index];
+    if(lhsGlyph.fontId != rhsGlyph.fontId ||
+       lhsGlyph.index != rhsGlyph.index ||
+       lhsGlyph.advance != rhsGlyph.advance ||
+       lhsGlyph.xBearing != rhsGlyph.xBearing ||
+       lhsGlyph.yBearing != rhsGlyph.yBearing ||
+       lhs.glyphToCharacterMap[index] != rhs.glyphToCharacterMap[index])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int UtcDaliShapingCacheFindAdd(void)
+{
+  ShapingCache cache(64u * 1024u);
+
+  tet_infoline("Test that nothing is found in an empty cache");
+  DALI_TEST_CHECK(!cache.Find(ARABIC_TEXT, 5u, 1u, ARABIC));
+
+  std::shared_ptr<ShapedRun> arabicRun     = CreateRun(ARABIC_TEXT, 5u, 10.f);
+  std::shared_ptr<ShapedRun> devanagariRun = CreateRun(DEVANAGARI_TEXT, 6u, 12.f);
+  cache.Add(ARABIC_TEXT, 5u, 1u, ARABIC, arabicRun);
+  cache.Add(DEVANAGARI_TEXT, 6u, 1u, DEVANAGARI, devanagariRun);
+
+  tet_infoline("Test that the cached runs are identical to the shaped ones");
+  ShapedRunPtr found = cache.Find(ARABIC_TEXT, 5u, 1u, ARABIC);
+  DALI_TEST_CHECK(found);
+  DALI_TEST_CHECK(RunsAreEqual(*found, *CreateRun(ARABIC_TEXT, 5u, 10.f)));
+
+  found = cache.Find(DEVANAGARI_TEXT, 6u, 1u, DEVANAGARI);
+  DALI_TEST_CHECK(found);
+  DALI_TEST_CHECK(RunsAreEqual(*found, *CreateRun(DEVANAGARI_TEXT, 6u, 12.f)));
+
+  tet_infoline("Test that a different font, script or text is not found");
+  DALI_TEST_CHECK(!cache.Find(ARABIC_TEXT, 5u, 2u, ARABIC));
+  DALI_TEST_CHECK(!cache.Find(ARABIC_TEXT, 5u, 1u, LATIN));
+  DALI_TEST_CHECK(!cache.Find(ARABIC_TEXT, 4u, 1u, ARABIC));
+  DALI_TEST_CHECK(!cache.Find(LATIN_TEXT, 5u, 1u, ARABIC));
+
+  ShapingCache::Statistics statistics;
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.hits, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.misses, 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.entries, 2u, TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.bytes > 0u);
+
+  tet_infoline("Test that clearing the cache removes the runs but keeps the counters");
+  cache.Clear();
+  DALI_TEST_CHECK(!cache.Find(ARABIC_TEXT, 5u, 1u, ARABIC));
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.entries, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.bytes, static_cast<size_t>(0u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.misses, 6u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShapingCacheEviction(void)
+{
+  ShapingCache cache(4u * 1024u);
+
+  // Each run uses a few hundred bytes, so not all of them fit in the cache.
+  const unsigned int NUMBER_OF_RUNS = 64u;
+  for(unsigned int index = 0u; index < NUMBER_OF_RUNS; ++index)
+  {
+    const Character text[] = {'a', 'b', 'c', index};
+    cache.Add(text, 4u, 1u, LATIN, CreateRun(text, 4u, 1.f));
+  }
+
+  ShapingCache::Statistics statistics;
+  cache.GetStatistics(statistics);
+  DALI_TEST_CHECK(statistics.bytes <= cache.GetMemoryBudget());
+  DALI_TEST_CHECK(statistics.evictions > 0u);
+  DALI_TEST_EQUALS(statistics.entries + statistics.evictions, NUMBER_OF_RUNS, TEST_LOCATION);
+
+  tet_infoline("Test that the least recently used runs have been evicted");
+  const Character first[] = {'a', 'b', 'c', 0u};
+  const Character last[]  = {'a', 'b', 'c', NUMBER_OF_RUNS - 1u};
+  DALI_TEST_CHECK(!cache.Find(first, 4u, 1u, LATIN));
+  DALI_TEST_CHECK(cache.Find(last, 4u, 1u, LATIN));
+
+  tet_infoline("Test that a zero budget disables the cache");
+  cache.SetMemoryBudget(0u);
+  cache.GetStatistics(statistics);
+  DALI_TEST_EQUALS(statistics.entries, 0u, TEST_LOCATION);
+  cache.Add(last, 4u, 1u, LATIN, CreateRun(last, 4u, 1.f));
+  DALI_TEST_CHECK(!cache.Find(last, 4u, 1u, LATIN));
+
+  END_TEST;
+}
+
+int UtcDaliShapingCacheMatchesUncachedShaping(void)
+{
+  TestApplication application;
+  Application     adaptorApplication = Application::New(); // Provides the singleton service.
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi(96u, 96u);
+
+  TextAbstraction::Shaping            shaping     = TextAbstraction::Shaping::Get();
+  TextAbstraction::Internal::Shaping& shapingImpl = GetImplementation(shaping);
+
+  struct Run
+  {
+    const Character* text;
+    Length           numberOfCharacters;
+    Script           script;
+  };
+  const Run RUNS[] = {{ARABIC_TEXT, 5u, ARABIC}, {DEVANAGARI_TEXT, 6u, DEVANAGARI}, {LATIN_TEXT, 5u, LATIN}};
+
+  for(const Run& run : RUNS)
+  {
+    const FontId fontId = fontClient.FindDefaultFont(run.text[0], 16u * 64u);
+
+    tet_infoline("Shape the run without the cache");
+    shapingImpl.SetCacheMemoryBudget(0u);
+    const ShapedText uncached = Shape(shaping, run.text, run.numberOfCharacters, fontId, run.script);
+
+    tet_infoline("Test that the shaped run added to the cache and the one found in it are identical to the uncached one");
+    shapingImpl.SetCacheMemoryBudget(64u * 1024u);
+    const ShapedText added = Shape(shaping, run.text, run.numberOfCharacters, fontId, run.script);
+
+    ShapingCache::Statistics statistics;
+    shapingImpl.GetCacheStatistics(statistics);
+    const uint32_t hits = statistics.hits;
+
+    const ShapedText found = Shape(shaping, run.text, run.numberOfCharacters, fontId, run.script);
+    shapingImpl.GetCacheStatistics(statistics);
+
+    DALI_TEST_CHECK(ShapedTextsAreEqual(uncached, added));
+    DALI_TEST_CHECK(ShapedTextsAreEqual(uncached, found));
+    if(!uncached.glyphs.empty())
+    {
+      DALI_TEST_EQUALS(statistics.hits, hits + 1u, TEST_LOCATION);
+    }
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_bitmap_saver_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_bitmap_saver_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const PNG_FILE_NAME = "/tmp/utc-dali-bitmap-saver.png";
+const char* const JPG_FILE_NAME = "/tmp/utc-dali-bitmap-saver.jpg";
+const char* const DIRECTORY     = "/tmp/utc-dali-bitmap-saver-directory.png";
+
+std::vector<unsigned char> CreatePixels(uint32_t width, uint32_t height, uint32_t bytesPerPixel)
+{
+  std::vector<unsigned char> pixels(width * height * bytesPerPixel);
+  for(size_t index = 0u; index < pixels.size(); ++index)
+  {
+    pixels[index] = static_cast<unsigned char>((index * 31u) ^ (index >> 7u));
+  }
+  return pixels;
+}
+
+bool FileExists(const std::string& path)
+{
+  struct stat fileStat;
+  return stat(path.c_str(), &fileStat) == 0;
+}
+
+} // namespace
+
+int UtcDaliEncodeToFileWithOptionsPngRoundTrip(void)
+{
+  // A PNG file is lossless whatever its compression settings, so the pixels are read back as they were written
+  const uint32_t                   width  = 37u;
+  const uint32_t                   height = 23u;
+  const std::vector<unsigned char> pixels = CreatePixels(width, height, 4u);
+
+  const EncodingOptions::PngFilter filters[] = {EncodingOptions::PngFilter::ADAPTIVE, EncodingOptions::PngFilter::NONE, EncodingOptions::PngFilter::PAETH};
+  const int32_t                    levels[]  = {0, 1, 9};
+  for(auto filter : filters)
+  {
+    for(auto level : levels)
+    {
+      EncodingOptions options;
+      options.pngFilter           = filter;
+      options.pngCompressionLevel = level;
+
+      unlink(PNG_FILE_NAME);
+      DALI_TEST_CHECK(EncodeToFile(pixels.data(), PNG_FILE_NAME, Pixel::RGBA8888, width, height, options));
+
+      Devel::PixelBuffer pixelBuffer = LoadImageFromFile(PNG_FILE_NAME);
+      DALI_TEST_CHECK(pixelBuffer);
+      DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+      DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+      DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION);
+      DALI_TEST_CHECK(std::equal(pixels.begin(), pixels.end(), pixelBuffer.GetBuffer()));
+    }
+  }
+
+  // The temporary file has been renamed over the file
+  DALI_TEST_CHECK(!FileExists(std::string(PNG_FILE_NAME) + '.' + std::to_string(getpid())));
+  unlink(PNG_FILE_NAME);
+
+  END_TEST;
+}
+
+int UtcDaliEncodeToFileWithOptionsJpegRoundTrip(void)
+{
+  // A flat color survives the chroma subsampling
+  const uint32_t             width  = 32u;
+  const uint32_t             height = 16u;
+  std::vector<unsigned char> pixels(width * height * 3u);
+  for(size_t index = 0u; index < pixels.size(); index += 3u)
+  {
+    pixels[index]      = 200u;
+    pixels[index + 1u] = 100u;
+    pixels[index + 2u] = 50u;
+  }
+
+  EncodingOptions options;
+  options.quality         = 90u;
+  options.jpegSubsampling = EncodingOptions::JpegSubsampling::SUBSAMPLING_420;
+
+  DALI_TEST_CHECK(EncodeToFile(pixels.data(), JPG_FILE_NAME, Pixel::RGB888, width, height, options));
+
+  Devel::PixelBuffer pixelBuffer = LoadImageFromFile(JPG_FILE_NAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION);
+
+  const unsigned char* buffer = pixelBuffer.GetBuffer();
+  for(size_t index = 0u; index < pixels.size(); ++index)
+  {
+    DALI_TEST_CHECK(std::abs(static_cast<int>(buffer[index]) - static_cast<int>(pixels[index])) <= 4);
+  }
+
+  // A grayscale file has no chroma at all
+  options.jpegSubsampling = EncodingOptions::JpegSubsampling::GRAYSCALE;
+  DALI_TEST_CHECK(EncodeToFile(pixels.data(), JPG_FILE_NAME, Pixel::RGB888, width, height, options));
+
+  pixelBuffer = LoadImageFromFile(JPG_FILE_NAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::L8, TEST_LOCATION);
+
+  unlink(JPG_FILE_NAME);
+
+  END_TEST;
+}
+
+int UtcDaliEncodeToFileWithOptionsAtomicWriteFailure(void)
+{
+  const uint32_t                   width  = 8u;
+  const uint32_t                   height = 8u;
+  const std::vector<unsigned char> pixels = CreatePixels(width, height, 4u);
+  const std::string                temporaryFileName = std::string(DIRECTORY) + '.' + std::to_string(getpid());
+
+  // The temporary file is written but can't be renamed over a directory: nothing is left behind
+  mkdir(DIRECTORY, 0700);
+  DALI_TEST_CHECK(!EncodeToFile(pixels.data(), DIRECTORY, Pixel::RGBA8888, width, height, EncodingOptions()));
+  DALI_TEST_CHECK(!FileExists(temporaryFileName));
+
+  struct stat fileStat;
+  DALI_TEST_CHECK(stat(DIRECTORY, &fileStat) == 0 && S_ISDIR(fileStat.st_mode));
+  rmdir(DIRECTORY);
+
+  // The temporary file can't be created in a missing directory
+  DALI_TEST_CHECK(!EncodeToFile(pixels.data(), "/tmp/utc-dali-bitmap-saver-missing/file.png", Pixel::RGBA8888, width, height, EncodingOptions()));
+
+  END_TEST;
+}
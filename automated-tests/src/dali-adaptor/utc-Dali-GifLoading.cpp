@@ -19,6 +19,9 @@
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
 #include <stdlib.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
 
 using namespace Dali;
 
@@ -30,6 +33,9 @@ static const char* gGif_100_None = TEST_RESOURCE_DIR "/canvas-none.gif";
 static const char* gGif_100_Prev = TEST_RESOURCE_DIR "/canvas-prev.gif";
 // test gif image, resolution: 100*100, 5 frames, delay: 1 second, disposal method: background
 static const char* gGif_100_Bgnd = TEST_RESOURCE_DIR "/canvas-bgnd.gif";
+// test gif image, resolution: 64*64, 40 frames, delay: 0.1 second, disposal methods: none, background and previous mixed,
+// previous on the frames 16 and 32 which fall on the composed keyframes
+static const char* gGif_64_Mixed = TEST_RESOURCE_DIR "/canvas-mixed.gif";
 
 // this image if not exist, for negative test
 static const char* gGifNonExist = "non-exist.gif";
@@ -148,3 +154,173 @@ int UtcDaliAnimatedImageLoadingGetImageSizeN(void)
 
   END_TEST;
 }
+
+int UtcDaliAnimatedImageLoadingLoadFrameOutOfOrderP(void)
+{
+  const char*    gifs[]        = {gGif_100_None, gGif_100_Prev, gGif_100_Bgnd, gGif_64_Mixed};
+  const uint32_t frameCounts[] = {5u, 5u, 5u, 40u};
+  for(uint32_t gifIndex = 0u; gifIndex < 4u; ++gifIndex)
+  {
+    // The frames composed in order
+    std::vector<Dali::Devel::PixelBuffer> expectedFrames;
+    Dali::AnimatedImageLoading            animatedImageLoading = Dali::AnimatedImageLoading::New(gifs[gifIndex], true);
+    const uint32_t                        frameCount           = animatedImageLoading.GetImageCount();
+    DALI_TEST_EQUALS(frameCount, frameCounts[gifIndex], TEST_LOCATION);
+    for(uint32_t frameIndex = 0u; frameIndex < frameCount; ++frameIndex)
+    {
+      expectedFrames.push_back(animatedImageLoading.LoadFrame(frameIndex));
+      DALI_TEST_CHECK(expectedFrames.back());
+    }
+
+    const uint32_t width  = animatedImageLoading.GetImageSize().GetWidth();
+    const uint32_t height = animatedImageLoading.GetImageSize().GetHeight();
+
+    // Jumping around, then going backwards, composes the frames again from the keyframes, which must give the same pixels.
+    std::vector<uint32_t> frameIndices;
+    for(uint32_t step = 0u; step < frameCount; ++step)
+    {
+      frameIndices.push_back((step * 7u + 3u) % frameCount);
+    }
+    for(uint32_t frameIndex = frameCount; frameIndex > 0u; --frameIndex)
+    {
+      frameIndices.push_back(frameIndex - 1u);
+    }
+    frameIndices.push_back(frameIndices.back());
+
+    animatedImageLoading = Dali::AnimatedImageLoading::New(gifs[gifIndex], true);
+    for(uint32_t frameIndex : frameIndices)
+    {
+      Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading.LoadFrame(frameIndex);
+      DALI_TEST_CHECK(pixelBuffer);
+      DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+      DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+      DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expectedFrames[frameIndex].GetBuffer(), width * height * 4u), 0, TEST_LOCATION);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageLoadingStreamingP(void)
+{
+  const char* gifs[] = {gGif_100_None, gGif_100_Prev, gGif_100_Bgnd};
+  for(const char* gif : gifs)
+  {
+    Dali::AnimatedImageLoading expectedLoading = Dali::AnimatedImageLoading::New(gif, true);
+    Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(gif, true);
+    const uint32_t             frameCount           = animatedImageLoading.GetImageCount();
+    DALI_TEST_EQUALS(frameCount, 5u, TEST_LOCATION);
+
+    animatedImageLoading.StartStreaming(0u, 3u);
+
+    // Play twice through the animation, measuring how long the frames take to be retrieved.
+    double maximumWait = 0.0;
+    double totalWait   = 0.0;
+    for(uint32_t frame = 0u; frame < frameCount * 2u; ++frame)
+    {
+      const auto               start       = std::chrono::steady_clock::now();
+      Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading.GetStreamedFrame(frame);
+      const double             wait        = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      maximumWait                          = std::max(maximumWait, wait);
+      totalWait += wait;
+
+      DALI_TEST_CHECK(pixelBuffer);
+      Dali::Devel::PixelBuffer expected = expectedLoading.LoadFrame(frame % frameCount);
+      DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expected.GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+
+      // Shorter than the frame interval of the test images, to keep the test quick.
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    tet_printf("%s: average wait %.3fms, maximum wait %.3fms\n", gif, totalWait / (frameCount * 2u), maximumWait);
+
+    Dali::AnimatedImageLoading::StreamingStatistics statistics = animatedImageLoading.GetStreamingStatistics();
+    DALI_TEST_CHECK(statistics.bufferedFrames <= 3u);
+    DALI_TEST_EQUALS(statistics.droppedFrames, 0u, TEST_LOCATION);
+    DALI_TEST_CHECK(statistics.decodedFrames + statistics.lateFrames >= frameCount * 2u);
+    tet_printf("decoded:%u late:%u dropped:%u\n", statistics.decodedFrames, statistics.lateFrames, statistics.droppedFrames);
+
+    animatedImageLoading.StopStreaming();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageLoadingStreamingSeekP(void)
+{
+  Dali::AnimatedImageLoading expectedLoading      = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+  Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+
+  // Without streaming the frame is loaded directly.
+  Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading.GetStreamedFrame(2u);
+  Dali::Devel::PixelBuffer expected    = expectedLoading.LoadFrame(2u);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expected.GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(animatedImageLoading.GetStreamingStatistics().decodedFrames, 0u, TEST_LOCATION);
+
+  animatedImageLoading.StartStreaming(0u, 2u);
+  pixelBuffer = animatedImageLoading.GetStreamedFrame(0u);
+  DALI_TEST_CHECK(pixelBuffer);
+
+  // Let the worker fill the buffer with the frames 1 and 2, then skip the frame 1.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  pixelBuffer = animatedImageLoading.GetStreamedFrame(2u);
+  expected    = expectedLoading.LoadFrame(2u);
+  DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expected.GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+  DALI_TEST_CHECK(animatedImageLoading.GetStreamingStatistics().droppedFrames >= 1u);
+
+  // The buffer holds the frames 3 and 4; going backwards is late, and the streaming continues after it.
+  const uint32_t lateFrames = animatedImageLoading.GetStreamingStatistics().lateFrames;
+  pixelBuffer               = animatedImageLoading.GetStreamedFrame(1u);
+  expected                  = expectedLoading.LoadFrame(1u);
+  DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expected.GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(animatedImageLoading.GetStreamingStatistics().lateFrames, lateFrames + 1u, TEST_LOCATION);
+
+  animatedImageLoading.SeekStreaming(4u);
+  pixelBuffer = animatedImageLoading.GetStreamedFrame(4u);
+  expected    = expectedLoading.LoadFrame(4u);
+  DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expected.GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+
+  // Stopping discards the buffered frames but keeps the statistics.
+  animatedImageLoading.StopStreaming();
+  Dali::AnimatedImageLoading::StreamingStatistics statistics = animatedImageLoading.GetStreamingStatistics();
+  DALI_TEST_EQUALS(statistics.bufferedFrames, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.decodedFrames > 0u);
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageLoadingLoadFrameWhileStreamingP(void)
+{
+  Dali::AnimatedImageLoading expectedLoading      = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+  Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+  const uint32_t             frameCount           = animatedImageLoading.GetImageCount();
+
+  std::vector<Dali::Devel::PixelBuffer> expectedFrames;
+  for(uint32_t frameIndex = 0u; frameIndex < frameCount; ++frameIndex)
+  {
+    expectedFrames.push_back(expectedLoading.LoadFrame(frameIndex));
+  }
+
+  // The direct decoding calls are serialized with the worker decoding the frames ahead.
+  animatedImageLoading.StartStreaming(0u, frameCount);
+  for(uint32_t i = 0u; i < frameCount * 4u; ++i)
+  {
+    const uint32_t           frameIndex  = (i * 3u) % frameCount;
+    Dali::Devel::PixelBuffer pixelBuffer = animatedImageLoading.LoadFrame(frameIndex);
+    DALI_TEST_CHECK(pixelBuffer);
+    DALI_TEST_EQUALS(memcmp(pixelBuffer.GetBuffer(), expectedFrames[frameIndex].GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+    DALI_TEST_EQUALS(animatedImageLoading.GetFrameInterval(frameIndex), expectedLoading.GetFrameInterval(frameIndex), TEST_LOCATION);
+
+    std::vector<Dali::PixelData> pixelData;
+    DALI_TEST_CHECK(animatedImageLoading.LoadNextNFrames(frameIndex, 1, pixelData));
+    DALI_TEST_EQUALS(pixelData.size(), 1u, TEST_LOCATION);
+
+    // The worker keeps decoding the frames in order meanwhile.
+    Dali::Devel::PixelBuffer streamedFrame = animatedImageLoading.GetStreamedFrame(i);
+    DALI_TEST_CHECK(streamedFrame);
+    DALI_TEST_EQUALS(memcmp(streamedFrame.GetBuffer(), expectedFrames[i % frameCount].GetBuffer(), 100u * 100u * 4u), 0, TEST_LOCATION);
+  }
+  animatedImageLoading.StopStreaming();
+
+  END_TEST;
+}
@@ -215,6 +215,24 @@ int UtcDaliLoadImageP(void)
   END_TEST;
 }
 
+int UtcDaliLoadImageScaledJpegP(void)
+{
+  // A quarter of the size is decoded directly by the JPEG decoder.
+  Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile(IMAGE_128_RGB, ImageDimensions(32, 32));
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION);
+
+  // Half of the size is decoded, then resampled to the requested size.
+  pixelBuffer = Dali::LoadImageFromFile(IMAGE_128_RGB, ImageDimensions(48, 48));
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), 48u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), 48u, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliLoadImageN(void)
 {
   Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile(IMAGENONEXIST);
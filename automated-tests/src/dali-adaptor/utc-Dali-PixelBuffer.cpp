@@ -742,3 +742,187 @@ int UtcDaliPixelBufferGaussianBlur(void)
 
   END_TEST;
 }
+
+int UtcDaliPixelBufferGaussianBlurLargeRadius(void)
+{
+  TestApplication application;
+
+  Devel::PixelBuffer imageData = Devel::PixelBuffer::New(64, 64, Pixel::RGBA8888);
+  FillCheckerboard(imageData);
+
+  // A large radius uses the sliding window approximation of the Gaussian kernel
+  imageData.ApplyGaussianBlur(20.0f);
+
+  tet_infoline("Test that the checkerboard has been smoothed to a uniform grey");
+  unsigned char* buffer = imageData.GetBuffer();
+  bool           smooth = true;
+  for(unsigned int i = 0; i < 64u * 64u * 4u; ++i)
+  {
+    smooth = smooth && buffer[i] >= 0x60u && buffer[i] <= 0xA0u;
+  }
+  DALI_TEST_CHECK(smooth);
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferGaussianBlurFlatColor(void)
+{
+  TestApplication application;
+
+  const float radii[] = {1.0f, 3.5f, 20.0f};
+  for(float radius : radii)
+  {
+    Devel::PixelBuffer imageData = Devel::PixelBuffer::New(32, 32, Pixel::RGBA8888);
+    unsigned char*     buffer    = imageData.GetBuffer();
+    for(unsigned int i = 0; i < 32u * 32u; ++i)
+    {
+      buffer[i * 4]     = 0x10u;
+      buffer[i * 4 + 1] = 0x80u;
+      buffer[i * 4 + 2] = 0xC3u;
+      buffer[i * 4 + 3] = 0xFFu;
+    }
+
+    imageData.ApplyGaussianBlur(radius);
+
+    tet_printf("Test that a flat color is unchanged by a blur of radius %f\n", radius);
+    bool unchanged = true;
+    for(unsigned int i = 0; i < 32u * 32u; ++i)
+    {
+      unchanged = unchanged && buffer[i * 4] == 0x10u && buffer[i * 4 + 1] == 0x80u && buffer[i * 4 + 2] == 0xC3u && buffer[i * 4 + 3] == 0xFFu;
+    }
+    DALI_TEST_CHECK(unchanged);
+  }
+
+  END_TEST;
+}
+
+void FillGradient(Devel::PixelBuffer buffer, unsigned int seed)
+{
+  unsigned char* pixels = buffer.GetBuffer();
+  unsigned int   size   = buffer.GetWidth() * buffer.GetHeight() * Pixel::GetBytesPerPixel(buffer.GetPixelFormat());
+  for(unsigned int i = 0; i < size; ++i)
+  {
+    pixels[i] = static_cast<unsigned char>((i * 37u + seed * 11u + (i / 7u) * 5u) & 0xFFu);
+  }
+}
+
+bool IsSameBuffer(Devel::PixelBuffer first, Devel::PixelBuffer second)
+{
+  if(first.GetWidth() != second.GetWidth() || first.GetHeight() != second.GetHeight() ||
+     first.GetPixelFormat() != second.GetPixelFormat() || first.IsAlphaPreMultiplied() != second.IsAlphaPreMultiplied())
+  {
+    return false;
+  }
+  unsigned int size = first.GetWidth() * first.GetHeight() * Pixel::GetBytesPerPixel(first.GetPixelFormat());
+  return memcmp(first.GetBuffer(), second.GetBuffer(), size) == 0;
+}
+
+int UtcDaliPixelBufferApplyOperations(void)
+{
+  TestApplication application;
+
+  const Pixel::Format formats[]     = {Pixel::RGBA8888, Pixel::BGRA8888, Pixel::RGB888};
+  const Pixel::Format maskFormats[] = {Pixel::INVALID, Pixel::L8, Pixel::RGBA8888};
+  const float         radii[]       = {0.0f, 2.5f, 20.0f};
+
+  for(Pixel::Format format : formats)
+  {
+    for(Pixel::Format maskFormat : maskFormats)
+    {
+      for(int multiply = 0; multiply < 2; ++multiply)
+      {
+        for(float radius : radii)
+        {
+          Devel::PixelBuffer expected = Devel::PixelBuffer::New(48, 40, format);
+          Devel::PixelBuffer actual   = Devel::PixelBuffer::New(48, 40, format);
+          FillGradient(expected, 1u);
+          FillGradient(actual, 1u);
+
+          Devel::PixelBuffer mask;
+          if(maskFormat != Pixel::INVALID)
+          {
+            mask = Devel::PixelBuffer::New(24, 20, maskFormat);
+            FillGradient(mask, 2u);
+          }
+
+          expected.Resize(32, 30);
+          if(mask)
+          {
+            expected.ApplyMask(mask, 1.0f, true);
+          }
+          if(multiply)
+          {
+            expected.MultiplyColorByAlpha();
+          }
+          if(radius > 0.0f)
+          {
+            expected.ApplyGaussianBlur(radius);
+          }
+
+          Devel::PixelBuffer::Operations operations;
+          operations.width                = 32;
+          operations.height               = 30;
+          operations.mask                 = mask;
+          operations.cropToMask           = true;
+          operations.multiplyColorByAlpha = multiply;
+          operations.blurRadius           = radius;
+          actual.ApplyOperations(operations);
+
+          tet_printf("Test that the operations on format %d with mask format %d, multiply %d and blur radius %f give the same output as the individual operations\n", format, maskFormat, multiply, radius);
+          DALI_TEST_CHECK(IsSameBuffer(expected, actual));
+        }
+      }
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferApplyOperationsConvert(void)
+{
+  TestApplication application;
+
+  struct Conversion
+  {
+    Pixel::Format format;
+    unsigned char bytes[4];
+  };
+  const Conversion conversions[] = {
+    {Pixel::RGB888, {0x10, 0x20, 0x30, 0x00}},
+    {Pixel::RGB8888, {0x10, 0x20, 0x30, 0xFF}},
+    {Pixel::BGR8888, {0x30, 0x20, 0x10, 0xFF}},
+    {Pixel::RGBA8888, {0x10, 0x20, 0x30, 0x40}},
+    {Pixel::BGRA8888, {0x30, 0x20, 0x10, 0x40}},
+    {Pixel::A8, {0x40, 0x00, 0x00, 0x00}}};
+
+  for(const Conversion& conversion : conversions)
+  {
+    Devel::PixelBuffer imageData = Devel::PixelBuffer::New(20, 10, Pixel::RGBA8888);
+    unsigned char*     pixels    = imageData.GetBuffer();
+    for(unsigned int i = 0; i < 20u * 10u; ++i)
+    {
+      pixels[i * 4]     = 0x10;
+      pixels[i * 4 + 1] = 0x20;
+      pixels[i * 4 + 2] = 0x30;
+      pixels[i * 4 + 3] = 0x40;
+    }
+
+    Devel::PixelBuffer::Operations operations;
+    operations.pixelFormat = conversion.format;
+    imageData.ApplyOperations(operations);
+
+    tet_printf("Test the conversion of RGBA8888 to format %d\n", conversion.format);
+    DALI_TEST_EQUALS(imageData.GetPixelFormat(), conversion.format, TEST_LOCATION);
+    DALI_TEST_EQUALS(imageData.GetWidth(), 20u, TEST_LOCATION);
+
+    const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel(conversion.format);
+    bool               converted     = true;
+    for(unsigned int i = 0; i < 20u * 10u * bytesPerPixel; ++i)
+    {
+      converted = converted && imageData.GetBuffer()[i] == conversion.bytes[i % bytesPerPixel];
+    }
+    DALI_TEST_CHECK(converted);
+  }
+
+  END_TEST;
+}
@@ -125,6 +125,7 @@ IF( enable_wayland )
 ELSE()
   CHECK_MODULE_AND_SET( ECORE_X ecore-x DALI_USE_ECORE_X11 [] )
   CHECK_MODULE_AND_SET( X11 x11 DALI_USE_X11 [] )
+  CHECK_MODULE_AND_SET( XEXT xext xext_available )
 ENDIF()
 
 CHECK_MODULE_AND_SET( WAYLAND_EXTENSION xdg-shell-client text-client input-method-client [] )
@@ -144,6 +145,11 @@ IF( webp_available )
   ADD_DEFINITIONS( -DDALI_WEBP_AVAILABLE )
 ENDIF()
 
+IF( xext_available )
+  SET(DALI_XSHM_AVAILABLE 1)
+  ADD_DEFINITIONS( -DDALI_XSHM_AVAILABLE )
+ENDIF()
+
 ADD_DEFINITIONS( -DPLATFORM_TIZEN )
 
 IF( enable_debug )
@@ -386,9 +392,11 @@ IF( WAYLAND )
 ELSE()
   SET( DALI_CFLAGS ${DALI_CFLAGS}
        ${X11_CFLAGS}
+       ${XEXT_CFLAGS}
        )
   SET( DALI_LDFLAGS ${DALI_LDFLAGS}
        ${X11_LDFLAGS}
+       ${XEXT_LDFLAGS}
        ${ECORE_X_LDFLAGS}
        )
 ENDIF()
@@ -91,6 +91,31 @@ std::string AnimatedImageLoading::GetUrl() const
   return GetImplementation(*this).GetUrl();
 }
 
+void AnimatedImageLoading::StartStreaming(uint32_t frameIndex, uint32_t maximumBufferedFrames)
+{
+  GetImplementation(*this).StartStreaming(frameIndex, maximumBufferedFrames);
+}
+
+Dali::Devel::PixelBuffer AnimatedImageLoading::GetStreamedFrame(uint32_t frameIndex)
+{
+  return GetImplementation(*this).GetStreamedFrame(frameIndex);
+}
+
+void AnimatedImageLoading::SeekStreaming(uint32_t frameIndex)
+{
+  GetImplementation(*this).SeekStreaming(frameIndex);
+}
+
+void AnimatedImageLoading::StopStreaming()
+{
+  GetImplementation(*this).StopStreaming();
+}
+
+AnimatedImageLoading::StreamingStatistics AnimatedImageLoading::GetStreamingStatistics() const
+{
+  return GetImplementation(*this).GetStreamingStatistics();
+}
+
 AnimatedImageLoading::AnimatedImageLoading(Internal::Adaptor::AnimatedImageLoading* internal)
 : BaseHandle(internal)
 {
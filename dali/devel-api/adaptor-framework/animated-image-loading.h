@@ -55,6 +55,17 @@ class AnimatedImageLoading;
 class DALI_ADAPTOR_API AnimatedImageLoading : public BaseHandle
 {
 public:
+  /**
+   * @brief The frames counted since the streaming mode was started.
+   */
+  struct StreamingStatistics
+  {
+    uint32_t decodedFrames{0u};  ///< The number of frames decoded ahead on the worker thread
+    uint32_t lateFrames{0u};     ///< The number of requested frames which weren't decoded ahead yet
+    uint32_t droppedFrames{0u};  ///< The number of frames decoded ahead which were discarded without being requested
+    uint32_t bufferedFrames{0u}; ///< The number of frames currently decoded ahead
+  };
+
   /**
    * Create a GifLoading with the given url and resourceType.
    * @param[in] url The url of the animated image to load
@@ -149,6 +160,52 @@ public:
    */
   std::string GetUrl() const;
 
+  /**
+   * @brief Starts decoding the frames ahead on a worker thread, in playing order from the given frame.
+   *
+   * The decoded frames are kept in a ring buffer until they are retrieved with GetStreamedFrame().
+   * The worker thread decodes ahead until the buffered frames last longer than a few times the time
+   * taken to decode a frame, according to the interval of each frame, or until the buffer is full.
+   * Starting again resets the statistics.
+   *
+   * @param[in] frameIndex The first frame to decode
+   * @param[in] maximumBufferedFrames The capacity of the buffer, at least one frame
+   */
+  void StartStreaming(uint32_t frameIndex, uint32_t maximumBufferedFrames);
+
+  /**
+   * @brief Retrieves a frame decoded ahead in streaming mode.
+   *
+   * The frames decoded ahead before the given one are dropped. If the frame is not decoded ahead yet,
+   * it is decoded on the calling thread and the streaming continues from the next frame.
+   * The frame is loaded with LoadFrame() if the streaming is not started.
+   *
+   * @param[in] frameIndex The frame index to retrieve.
+   * @return Dali::Devel::PixelBuffer The loaded PixelBuffer. If loading is fail, return empty handle.
+   */
+  Dali::Devel::PixelBuffer GetStreamedFrame(uint32_t frameIndex);
+
+  /**
+   * @brief Discards the frames decoded ahead and continues streaming from the given frame.
+   *
+   * @param[in] frameIndex The next frame to decode
+   */
+  void SeekStreaming(uint32_t frameIndex);
+
+  /**
+   * @brief Stops the worker thread and discards the frames decoded ahead.
+   *
+   * @note The statistics are kept until the streaming is started again.
+   */
+  void StopStreaming();
+
+  /**
+   * @brief Retrieves the frames counted since the streaming mode was started.
+   *
+   * @return The streaming statistics.
+   */
+  StreamingStatistics GetStreamingStatistics() const;
+
 public: // Not intended for application developers
   /// @cond internal
   /**
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/batch-image-loader.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/batch-image-loader-impl.h>
+
+namespace Dali
+{
+BatchImageLoader BatchImageLoader::New()
+{
+  return New(0u);
+}
+
+BatchImageLoader BatchImageLoader::New(uint32_t numberOfThreads)
+{
+  Internal::Adaptor::BatchImageLoaderPtr internal = Internal::Adaptor::BatchImageLoader::New(numberOfThreads);
+  return BatchImageLoader(internal.Get());
+}
+
+BatchImageLoader::BatchImageLoader()
+{
+}
+
+BatchImageLoader::~BatchImageLoader()
+{
+}
+
+BatchImageLoader BatchImageLoader::DownCast(BaseHandle handle)
+{
+  return BatchImageLoader(dynamic_cast<Internal::Adaptor::BatchImageLoader*>(handle.GetObjectPtr()));
+}
+
+uint32_t BatchImageLoader::Load(const Request& request)
+{
+  return GetImplementation(*this).Load(request);
+}
+
+std::vector<uint32_t> BatchImageLoader::Load(const std::vector<Request>& requests)
+{
+  return GetImplementation(*this).Load(requests);
+}
+
+bool BatchImageLoader::SetPriority(uint32_t loadId, int32_t priority)
+{
+  return GetImplementation(*this).SetPriority(loadId, priority);
+}
+
+bool BatchImageLoader::Cancel(uint32_t loadId)
+{
+  return GetImplementation(*this).Cancel(loadId);
+}
+
+void BatchImageLoader::CancelAll()
+{
+  GetImplementation(*this).CancelAll();
+}
+
+BatchImageLoader::LoadCompletedSignalType& BatchImageLoader::LoadCompletedSignal()
+{
+  return GetImplementation(*this).LoadCompletedSignal();
+}
+
+BatchImageLoader::BatchImageLoader(Internal::Adaptor::BatchImageLoader* internal)
+: BaseHandle(internal)
+{
+}
+
+} // namespace Dali
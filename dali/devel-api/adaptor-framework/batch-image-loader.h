@@ -0,0 +1,225 @@
+#ifndef DALI_BATCH_IMAGE_LOADER_H
+#define DALI_BATCH_IMAGE_LOADER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/signals/dali-signal.h>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/dali-adaptor-common.h>
+
+namespace Dali
+{
+namespace Internal DALI_INTERNAL
+{
+namespace Adaptor
+{
+class BatchImageLoader;
+}
+} // namespace DALI_INTERNAL
+
+/**
+ * @brief Decodes many images at once on a pool of worker threads.
+ *
+ * Each request is given an id when it is added. When a request has been decoded, LoadCompletedSignal()
+ * is emitted on the event thread with that id and the loaded PixelBuffer (an empty handle if loading failed).
+ * Requests with a higher priority are decoded first; requests with the same priority are decoded in the
+ * order they were added.
+ *
+ * @code
+ * BatchImageLoader loader = BatchImageLoader::New();
+ * loader.LoadCompletedSignal().Connect( this, &MyClass::OnThumbnailLoaded );
+ *
+ * std::vector<BatchImageLoader::Request> requests;
+ * for( auto&& url : urls )
+ * {
+ *   requests.push_back( BatchImageLoader::Request( url, ImageDimensions( 256, 256 ) ) );
+ * }
+ * std::vector<uint32_t> loadIds = loader.Load( requests );
+ * @endcode
+ *
+ * @note The worker threads are stopped when the last handle is released, which waits for the images
+ * being decoded. Requests which have not been emitted by then are discarded.
+ */
+class DALI_ADAPTOR_API BatchImageLoader : public BaseHandle
+{
+public:
+  /**
+   * @brief The parameters of an image to load.
+   */
+  struct Request
+  {
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] url The URL of the image file to load. Remote (http or https) URLs are downloaded first.
+     * @param[in] size The width and height to fit the loaded image to, 0.0 means whole image
+     * @param[in] fittingMode The method used to fit the shape of the image before loading to the shape defined by the size parameter.
+     * @param[in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size.
+     * @param[in] orientationCorrection Reorient the image to respect any orientation metadata in its header.
+     * @param[in] priority Requests with a higher priority are loaded first.
+     */
+    Request(const std::string& url,
+            ImageDimensions    size                  = ImageDimensions(0, 0),
+            FittingMode::Type  fittingMode           = FittingMode::DEFAULT,
+            SamplingMode::Type samplingMode          = SamplingMode::BOX_THEN_LINEAR,
+            bool               orientationCorrection = true,
+            int32_t            priority              = 0)
+    : url(url),
+      size(size),
+      fittingMode(fittingMode),
+      samplingMode(samplingMode),
+      orientationCorrection(orientationCorrection),
+      priority(priority)
+    {
+    }
+
+    std::string        url;                   ///< The URL of the image file to load
+    ImageDimensions    size;                  ///< The width and height to fit the loaded image to
+    FittingMode::Type  fittingMode;           ///< The method used to fit the image to the size
+    SamplingMode::Type samplingMode;          ///< The filtering method used when fitting the image
+    bool               orientationCorrection; ///< Whether to reorient the image to respect its orientation metadata
+    int32_t            priority;              ///< Requests with a higher priority are loaded first
+  };
+
+  using LoadCompletedSignalType = Signal<void(uint32_t, Devel::PixelBuffer)>; ///< Load completed signal type
+
+public:
+  /**
+   * @brief Creates a BatchImageLoader with the default number of worker threads.
+   *
+   * The default is the number of cores, up to four, and can be changed with the
+   * DALI_IMAGE_LOADING_THREADS environment variable.
+   * @return A handle to a newly allocated BatchImageLoader
+   */
+  static BatchImageLoader New();
+
+  /**
+   * @brief Creates a BatchImageLoader.
+   *
+   * @param[in] numberOfThreads The number of worker threads. Zero means the default number.
+   * @return A handle to a newly allocated BatchImageLoader
+   */
+  static BatchImageLoader New(uint32_t numberOfThreads);
+
+  /**
+   * @brief Creates an empty handle.
+   */
+  BatchImageLoader();
+
+  /**
+   * @brief Destructor.
+   */
+  ~BatchImageLoader();
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param[in] copy The BatchImageLoader to copy
+   */
+  BatchImageLoader(const BatchImageLoader& copy) = default;
+
+  /**
+   * @brief Assignment operator.
+   *
+   * @param[in] rhs The BatchImageLoader to copy
+   * @return A reference to this
+   */
+  BatchImageLoader& operator=(const BatchImageLoader& rhs) = default;
+
+  /**
+   * @brief Downcasts a handle to BatchImageLoader handle.
+   *
+   * @param[in] handle Handle to an object
+   * @return Handle to a BatchImageLoader or an empty handle
+   */
+  static BatchImageLoader DownCast(BaseHandle handle);
+
+  /**
+   * @brief Adds a request to load an image.
+   *
+   * @param[in] request The image to load
+   * @return The id of the request
+   */
+  uint32_t Load(const Request& request);
+
+  /**
+   * @brief Adds requests to load a list of images.
+   *
+   * @param[in] requests The images to load
+   * @return The ids of the requests, in the same order
+   */
+  std::vector<uint32_t> Load(const std::vector<Request>& requests);
+
+  /**
+   * @brief Changes the priority of a request which hasn't started loading yet.
+   *
+   * @param[in] loadId The id of the request
+   * @param[in] priority The new priority
+   * @return true if the request was waiting to be loaded
+   */
+  bool SetPriority(uint32_t loadId, int32_t priority);
+
+  /**
+   * @brief Cancels a request.
+   *
+   * LoadCompletedSignal() won't be emitted for a cancelled request. A request which is being
+   * decoded when it is cancelled is allowed to finish but its result is discarded.
+   * @param[in] loadId The id of the request
+   * @return true if the request was cancelled, false if it had already completed or the id is unknown
+   */
+  bool Cancel(uint32_t loadId);
+
+  /**
+   * @brief Cancels all the requests.
+   */
+  void CancelAll();
+
+public: // Signals
+  /**
+   * @brief This signal is emitted on the event thread when an image has been loaded.
+   *
+   * A callback of the following type may be connected:
+   * @code
+   *   void YourCallbackName( uint32_t loadId, Devel::PixelBuffer pixelBuffer );
+   * @endcode
+   * The pixel buffer is an empty handle if the image could not be loaded.
+   * @return The signal to connect to
+   */
+  LoadCompletedSignalType& LoadCompletedSignal();
+
+public: // Not intended for application developers
+  /// @cond internal
+  /**
+   * @brief This constructor is used by New() methods.
+   *
+   * @param[in] internal A pointer to a newly allocated Dali resource.
+   */
+  explicit DALI_INTERNAL BatchImageLoader(Internal::Adaptor::BatchImageLoader* internal);
+  /// @endcond
+};
+
+} // namespace Dali
+
+#endif // DALI_BATCH_IMAGE_LOADER_H
@@ -85,18 +85,18 @@ bool EncodeToFormat(const unsigned char*   pixelBuffer,
                     std::size_t            width,
                     std::size_t            height,
                     Pixel::Format          pixelFormat,
-                    const uint32_t         quality)
+                    const EncodingOptions& options)
 {
   switch(formatEncoding)
   {
     case JPG_FORMAT:
     {
-      return TizenPlatform::EncodeToJpeg(pixelBuffer, encodedPixels, width, height, pixelFormat, quality);
+      return TizenPlatform::EncodeToJpeg(pixelBuffer, encodedPixels, width, height, pixelFormat, options.quality, options.jpegSubsampling);
       break;
     }
     case PNG_FORMAT:
     {
-      return TizenPlatform::EncodeToPng(pixelBuffer, encodedPixels, width, height, pixelFormat);
+      return TizenPlatform::EncodeToPng(pixelBuffer, encodedPixels, width, height, pixelFormat, options);
       break;
     }
     default:
@@ -126,9 +126,12 @@ bool EncodeToFile(const unsigned char* const pixelBuffer,
                   const uint32_t             quality)
 {
   DALI_ASSERT_DEBUG(pixelBuffer != 0 && filename.size() > 4 && width > 0 && height > 0);
+  EncodingOptions options;
+  options.quality = quality;
+
   Vector<unsigned char> pixbufEncoded;
   const FileFormat      format       = GetFormatFromFileName(filename);
-  const bool            encodeResult = EncodeToFormat(pixelBuffer, pixbufEncoded, format, width, height, pixelFormat, quality);
+  const bool            encodeResult = EncodeToFormat(pixelBuffer, pixbufEncoded, format, width, height, pixelFormat, options);
   if(!encodeResult)
   {
     DALI_LOG_ERROR("Encoding pixels failed\n");
@@ -137,4 +140,23 @@ bool EncodeToFile(const unsigned char* const pixelBuffer,
   return TizenPlatform::SaveFile(filename, pixbufEncoded.Begin(), pixbufEncoded.Count());
 }
 
+bool EncodeToFile(const unsigned char* const pixelBuffer,
+                  const std::string&         filename,
+                  const Pixel::Format        pixelFormat,
+                  const std::size_t          width,
+                  const std::size_t          height,
+                  const EncodingOptions&     options)
+{
+  DALI_ASSERT_DEBUG(pixelBuffer != 0 && filename.size() > 4 && width > 0 && height > 0);
+  Vector<unsigned char> pixbufEncoded;
+  const FileFormat      format       = GetFormatFromFileName(filename);
+  const bool            encodeResult = EncodeToFormat(pixelBuffer, pixbufEncoded, format, width, height, pixelFormat, options);
+  if(!encodeResult)
+  {
+    DALI_LOG_ERROR("Encoding pixels failed\n");
+    return false;
+  }
+  return TizenPlatform::SaveFileAtomically(filename, pixbufEncoded.Begin(), pixbufEncoded.Count());
+}
+
 } // namespace Dali
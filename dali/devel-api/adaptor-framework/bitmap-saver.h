@@ -28,6 +28,42 @@ namespace Dali
 {
 static constexpr uint32_t DEFAULT_JPG_QUALITY = 100;
 
+/**
+ * The settings trading the encoding speed for the size or the quality of the file.
+ * The defaults give the same files as EncodeToFile() without options.
+ */
+struct EncodingOptions
+{
+  /**
+   * The filter applied to the rows of a PNG file before compressing them.
+   */
+  enum class PngFilter
+  {
+    ADAPTIVE, ///< libpng picks a filter per row, which compresses best
+    NONE,     ///< No filter, which is the fastest
+    SUB,
+    UP,
+    AVERAGE,
+    PAETH
+  };
+
+  /**
+   * The chroma subsampling of a JPEG file.
+   */
+  enum class JpegSubsampling
+  {
+    SUBSAMPLING_444, ///< No subsampling, the best quality
+    SUBSAMPLING_422, ///< Half the horizontal chroma resolution
+    SUBSAMPLING_420, ///< Half the horizontal and vertical chroma resolution, the smallest and fastest in color
+    GRAYSCALE        ///< No chroma at all
+  };
+
+  uint32_t        quality{DEFAULT_JPG_QUALITY};                       ///< The JPEG quality in the range [1, 100]
+  JpegSubsampling jpegSubsampling{JpegSubsampling::SUBSAMPLING_444};  ///< The JPEG chroma subsampling
+  int32_t         pngCompressionLevel{1};                             ///< The zlib level of a PNG file, from 0 (none, fastest) to 9 (smallest)
+  PngFilter       pngFilter{PngFilter::ADAPTIVE};                     ///< The PNG row filter
+};
+
 /**
  * Store the given pixel data to a file.
  * The suffix of the filename determines what type of file will be stored,
@@ -68,6 +104,31 @@ DALI_ADAPTOR_API bool EncodeToFile(const unsigned char* const pixelBuffer,
                                    const std::size_t          height,
                                    const uint32_t             quality);
 
+/**
+ * Store the given pixel data to a file, with the given encoding settings.
+ * The suffix of the filename determines what type of file will be stored,
+ * currently only jpeg and png formats are supported.
+ *
+ * The file is written atomically: the pixels are written to a temporary file
+ * in the same directory, which then replaces the file, so readers never see a
+ * partially written file.
+ *
+ * @param[in] pixelBuffer Pointer to the pixel data
+ * @param[in] filename    Filename to save
+ * @param[in] pixelFormat The format of the buffer's pixels
+ * @param[in] width       The width of the image in pixels
+ * @param[in] height      The height of the image in pixels
+ * @param[in] options     The encoding settings
+ *
+ * @return true if the file was saved
+ */
+DALI_ADAPTOR_API bool EncodeToFile(const unsigned char* const pixelBuffer,
+                                   const std::string&         filename,
+                                   const Pixel::Format        pixelFormat,
+                                   const std::size_t          width,
+                                   const std::size_t          height,
+                                   const EncodingOptions&     options);
+
 } // namespace Dali
 
 #endif // DALI_ADAPTOR_BITMAP_SAVER_H
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/capture-impl.h>
+
+namespace Dali
+{
+namespace DevelCapture
+{
+void SetEncodingOptions(Capture capture, const EncodingOptions& options)
+{
+  GetImpl(capture).SetEncodingOptions(options);
+}
+
+void SetAsynchronousEncoding(Capture capture, bool asynchronous)
+{
+  GetImpl(capture).SetAsynchronousEncoding(asynchronous);
+}
+
+bool StartRecording(Capture capture, Actor source, const Vector2& position, const Vector2& size, const Vector4& clearColor, const RecordingOptions& options, FrameCallback callback)
+{
+  return GetImpl(capture).StartRecording(source, position, size, clearColor, options, std::move(callback), std::string());
+}
+
+bool StartRecording(Capture capture, Actor source, const Vector2& position, const Vector2& size, const Vector4& clearColor, const RecordingOptions& options, const std::string& path)
+{
+  return GetImpl(capture).StartRecording(source, position, size, clearColor, options, FrameCallback(), path);
+}
+
+void StopRecording(Capture capture)
+{
+  GetImpl(capture).StopRecording();
+}
+
+bool IsRecording(Capture capture)
+{
+  return GetImpl(capture).IsRecording();
+}
+
+RecordingStatistics GetRecordingStatistics(Capture capture)
+{
+  return GetImpl(capture).GetRecordingStatistics();
+}
+
+} // namespace DevelCapture
+
+} // namespace Dali
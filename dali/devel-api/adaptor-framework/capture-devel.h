@@ -0,0 +1,161 @@
+#ifndef DALI_CAPTURE_DEVEL_H
+#define DALI_CAPTURE_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/public-api/capture/capture.h>
+
+namespace Dali
+{
+namespace DevelCapture
+{
+/**
+ * @brief Sets the settings used to encode the file of the next captures.
+ *
+ * The quality of the settings replaces the one given by Capture::SetImageQuality().
+ *
+ * @param[in] capture The capture
+ * @param[in] options The encoding settings
+ */
+DALI_ADAPTOR_API void SetEncodingOptions(Capture capture, const EncodingOptions& options);
+
+/**
+ * @brief Sets whether the file of the next captures is encoded on a worker thread.
+ *
+ * When asynchronous, the event thread only reads the pixels back, the file is encoded and written
+ * atomically on a worker thread, and Capture::FinishedSignal() is emitted once the file is written.
+ * When synchronous, which is the default, the file is encoded on the event thread before the signal is emitted.
+ * The file is encoded synchronously without an adaptor.
+ *
+ * @param[in] capture The capture
+ * @param[in] asynchronous Whether to encode on a worker thread
+ */
+DALI_ADAPTOR_API void SetAsynchronousEncoding(Capture capture, bool asynchronous);
+
+/**
+ * @brief The settings of a recording.
+ */
+struct RecordingOptions
+{
+  uint32_t framesPerSecond{30u};     ///< The rate at which the frames are captured
+  uint32_t bufferCount{3u};          ///< The number of offscreen targets rendered to in turn; a frame is dropped when all of them are still being read
+  uint32_t width{0u};                ///< The width of the frames delivered, 0 to keep the captured width, or the aspect ratio if only the height is set
+  uint32_t height{0u};               ///< The height of the frames delivered, 0 to keep the captured height, or the aspect ratio if only the width is set
+  bool     onlyChangedFrames{false}; ///< Whether the frames identical to the previous one are not delivered to the callback
+};
+
+/**
+ * @brief The counters of a recording, which tell whether it keeps up with its frame rate.
+ */
+struct RecordingStatistics
+{
+  uint32_t framesCaptured{0u};  ///< The frames rendered and read back
+  uint32_t framesDelivered{0u}; ///< The frames given to the callback or written to the file
+  uint32_t framesUnchanged{0u}; ///< The frames identical to the previous one
+  uint32_t framesDropped{0u};   ///< The frames not captured, because the previous one was still rendering or no target was free
+};
+
+/**
+ * @brief A frame of a recording.
+ */
+struct Frame
+{
+  const uint8_t* pixels{nullptr}; ///< The tightly packed RGBA8888 pixels, only valid during the callback
+  uint32_t       width{0u};       ///< The width of the frame
+  uint32_t       height{0u};      ///< The height of the frame
+  uint32_t       index{0u};       ///< The number of the frame in the recording, starting at 0, counting the frames not delivered
+  uint64_t       timestamp{0u};   ///< The time the frame was rendered, in microseconds since the start of the recording
+};
+
+/**
+ * @brief Called on a worker thread with each frame of a recording.
+ */
+using FrameCallback = std::function<void(const Frame& frame)>;
+
+/**
+ * @brief Starts capturing frames of an actor tree continuously, and hands them over to a callback.
+ *
+ * The render task and the offscreen targets are kept until StopRecording(). The frames are read back,
+ * converted and scaled on a worker thread, which also calls the callback, so a slow callback makes
+ * frames be dropped rather than stalling the event or the render thread.
+ *
+ * @param[in] capture The capture, which must not be capturing or recording
+ * @param[in] source The root of the actor tree to capture, which must be on a window
+ * @param[in] position The top-left position of the area to capture, in the window
+ * @param[in] size The size of the area to capture
+ * @param[in] clearColor The background color
+ * @param[in] options The settings of the recording
+ * @param[in] callback Called on a worker thread with each frame
+ * @return true if the recording started.
+ */
+DALI_ADAPTOR_API bool StartRecording(Capture capture, Actor source, const Vector2& position, const Vector2& size, const Vector4& clearColor, const RecordingOptions& options, FrameCallback callback);
+
+/**
+ * @brief Starts capturing frames of an actor tree continuously, and writes them to a file.
+ *
+ * A path ending with ".y4m" gives a YUV4MPEG2 file with 4:2:0 chroma, any other path a file of the
+ * raw RGBA8888 frames one after the other. Both have a constant frame rate: a dropped frame repeats
+ * the previous one, and an unchanged frame is written again without being converted.
+ *
+ * @see StartRecording(Capture, Actor, const Vector2&, const Vector2&, const Vector4&, const RecordingOptions&, FrameCallback)
+ * @param[in] capture The capture, which must not be capturing or recording
+ * @param[in] source The root of the actor tree to capture, which must be on a window
+ * @param[in] position The top-left position of the area to capture, in the window
+ * @param[in] size The size of the area to capture
+ * @param[in] clearColor The background color
+ * @param[in] options The settings of the recording
+ * @param[in] path The path of the file
+ * @return true if the recording started.
+ */
+DALI_ADAPTOR_API bool StartRecording(Capture capture, Actor source, const Vector2& position, const Vector2& size, const Vector4& clearColor, const RecordingOptions& options, const std::string& path);
+
+/**
+ * @brief Stops the recording, after delivering the frames already captured, and releases its resources.
+ *
+ * @param[in] capture The capture
+ */
+DALI_ADAPTOR_API void StopRecording(Capture capture);
+
+/**
+ * @brief Whether the capture is recording.
+ *
+ * @param[in] capture The capture
+ * @return true if recording.
+ */
+DALI_ADAPTOR_API bool IsRecording(Capture capture);
+
+/**
+ * @brief Retrieves the counters of the current recording, or of the last one once stopped.
+ *
+ * @param[in] capture The capture
+ * @return The counters.
+ */
+DALI_ADAPTOR_API RecordingStatistics GetRecordingStatistics(Capture capture);
+
+} // namespace DevelCapture
+
+} // namespace Dali
+
+#endif // DALI_CAPTURE_DEVEL_H
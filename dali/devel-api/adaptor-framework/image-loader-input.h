@@ -21,6 +21,7 @@
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/public-api/images/image-operations.h>
+#include <cstdint>
 #include <cstdio>
 
 // INTERNAL INCLUDES
@@ -54,12 +55,16 @@ struct Input
   Input(FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true)
   : file(file),
     scalingParameters(scalingParameters),
-    reorientationRequested(reorientationRequested)
+    reorientationRequested(reorientationRequested),
+    data(nullptr),
+    dataSize(0u)
   {
   }
   FILE*             file;
   ScalingParameters scalingParameters;
   bool              reorientationRequested;
+  const uint8_t*    data;     ///< The whole contents of the file mapped in memory, or NULL if the file has to be read from the stream.
+  size_t            dataSize; ///< The size of the data in bytes.
 };
 
 using LoadBitmapFunction       = bool (*)(const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& pixelData);
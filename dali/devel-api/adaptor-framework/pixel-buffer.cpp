@@ -139,6 +139,11 @@ bool PixelBuffer::IsAlphaPreMultiplied() const
   return GetImplementation(*this).IsAlphaPreMultiplied();
 }
 
+void PixelBuffer::ApplyOperations(const Operations& operations)
+{
+  GetImplementation(*this).ApplyOperations(operations);
+}
+
 } // namespace Devel
 
 } // namespace Dali
@@ -244,6 +244,24 @@ public:
    */
   bool IsAlphaPreMultiplied() const;
 
+  /**
+   * @brief A list of operations applied by ApplyOperations().
+   */
+  struct Operations;
+
+  /**
+   * @brief Applies a list of operations to this buffer, in the order: resize, mask, multiply color by alpha,
+   * Gaussian blur and pixel format conversion.
+   *
+   * The result is the same as calling Resize(), ApplyMask(), MultiplyColorByAlpha(), ApplyGaussianBlur() and
+   * converting the pixel format in turn. For RGBA8888 and BGRA8888 buffers, the per pixel operations are done
+   * together in a single traversal of the buffer, and the rows are masked and multiplied just before they are
+   * blurred, while they are in the cache. Other buffers fall back to applying the operations one after the other.
+   *
+   * @param[in] operations The operations to apply.
+   */
+  void ApplyOperations(const Operations& operations);
+
 public:
   /**
    * @brief The constructor.
@@ -254,6 +272,19 @@ public:
   explicit DALI_INTERNAL PixelBuffer(Internal::Adaptor::PixelBuffer* pointer);
 };
 
+struct PixelBuffer::Operations
+{
+  uint16_t      width{0u};                   ///< The width to resize the buffer to, or 0 to keep its size
+  uint16_t      height{0u};                  ///< The height to resize the buffer to, or 0 to keep its size
+  PixelBuffer   mask;                        ///< The mask to apply, or an empty handle for no mask. @see ApplyMask()
+  float         maskContentScale{1.0f};      ///< The scaling factor applied to the content when cropping to the mask
+  bool          cropToMask{false};           ///< Whether to crop the buffer to the mask size or scale the mask to the buffer size
+  bool          multiplyColorByAlpha{false}; ///< Whether to multiply the color values by the alpha value
+  float         blurRadius{0.0f};            ///< The radius of the Gaussian blur, 0 for no blur. Only RGBA8888 buffers are blurred
+  Pixel::Format pixelFormat{Pixel::INVALID}; ///< The format to convert the buffer to, or Pixel::INVALID to keep its format.
+                                             ///< Supports RGB888, RGB8888, BGR8888, RGBA8888, BGRA8888 and A8.
+};
+
 } // namespace Devel
 } // namespace Dali
 
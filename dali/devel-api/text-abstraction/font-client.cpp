@@ -140,6 +140,16 @@ FontId FontClient::FindFallbackFont(Character              charcode,
   return GetImplementation(*this).FindFallbackFont(charcode, preferredFontDescription, requestedPointSize, preferColor);
 }
 
+void FontClient::FindFallbackFonts(const Character* const text,
+                                   Length                 numberOfCharacters,
+                                   const FontDescription& preferredFontDescription,
+                                   PointSize26Dot6        requestedPointSize,
+                                   bool                   preferColor,
+                                   Vector<FontId>&        fontIds)
+{
+  GetImplementation(*this).FindFallbackFonts(text, numberOfCharacters, preferredFontDescription, requestedPointSize, preferColor, fontIds);
+}
+
 FontId FontClient::GetFontId(const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex)
 {
   return GetImplementation(*this).GetFontId(path, requestedPointSize, faceIndex);
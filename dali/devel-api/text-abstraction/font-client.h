@@ -264,6 +264,26 @@ public:
                           PointSize26Dot6        requestedPointSize = DEFAULT_POINT_SIZE,
                           bool                   preferColor        = false);
 
+  /**
+   * @brief Find a fallback-font for each character of a UTF-32 text.
+   *
+   * The result is the same as calling FindFallbackFont() for each character, but the list of
+   * fallback-fonts is retrieved once for the whole text, which is faster for long texts.
+   *
+   * @param[in] text Pointer to the first character of the text.
+   * @param[in] numberOfCharacters The number of characters of the text.
+   * @param[in] preferredFontDescription Description of the preferred font which may not provide a glyph for all the characters.
+   * @param[in] requestedPointSize The point size in 26.6 fractional points.
+   * @param[in] preferColor @e true if a color font is preferred.
+   * @param[out] fontIds The font identifier of each character, or zero if no font supports it. It's resized to @p numberOfCharacters.
+   */
+  void FindFallbackFonts(const Character* const text,
+                         Length                 numberOfCharacters,
+                         const FontDescription& preferredFontDescription,
+                         PointSize26Dot6        requestedPointSize,
+                         bool                   preferColor,
+                         Vector<FontId>&        fontIds);
+
   /**
    * @brief Retrieve the unique identifier for a font.
    *
@@ -149,6 +149,17 @@ public:
    */
   virtual bool PreRender(bool resizingSurface, const std::vector<Rect<int>>& damagedRects, Rect<int>& clippingRect) = 0;
 
+  /**
+   * @brief Retrieves the areas of the surface to render in this frame, as calculated by PreRender().
+   *
+   * The clipping rect returned by PreRender() is their bounding box. When there is more than one area,
+   * rendering each of them separately avoids rendering the pixels between them.
+   * @param[out] clippingRects The areas to render. Left empty to render the clipping rect only.
+   */
+  virtual void GetClippingRects(std::vector<Rect<int>>& clippingRects) const
+  {
+  }
+
   /**
    * @brief Invoked by render thread after Core::Render
    * @param[in] renderToFbo True if render to FBO.
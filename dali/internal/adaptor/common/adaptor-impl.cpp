@@ -151,6 +151,9 @@ void Adaptor::Initialize( GraphicsFactory& graphicsFactory )
   GetDataStoragePath( path );
   mPlatformAbstraction->SetDataStoragePath( path );
 
+  // Reads the shader binaries of the previous runs while the graphics are initialized; the ones the first frame doesn't load are released after it.
+  mPlatformAbstraction->PreloadShaderBinaryFiles( std::vector< std::string >() );
+
   if( mEnvironmentOptions->PerformanceServerRequired() )
   {
     mPerformanceInterface = PerformanceInterfaceFactory::CreateInterface( *this, *mEnvironmentOptions );
@@ -800,6 +803,16 @@ void Adaptor::GetWindowContainerInterface( WindowContainer& windows )
   windows = mWindows;
 }
 
+void Adaptor::SetGraphicsDriver( const std::string& driver )
+{
+  mPlatformAbstraction->SetGraphicsDriver( driver );
+}
+
+void Adaptor::ReleasePreloadedShaderBinaries()
+{
+  mPlatformAbstraction->ReleasePreloadedShaderBinaryFiles();
+}
+
 void Adaptor::DestroyTtsPlayer(Dali::TtsPlayer::Mode mode)
 {
   if( mTtsPlayers[mode] )
@@ -496,6 +496,16 @@ public:  //AdaptorInternalServices
    */
   void GetWindowContainerInterface( WindowContainer& windows ) override;
 
+  /**
+   * @copydoc Dali::Internal::Adaptor::AdaptorInternalServices::SetGraphicsDriver()
+   */
+  void SetGraphicsDriver( const std::string& driver ) override;
+
+  /**
+   * @copydoc Dali::Internal::Adaptor::AdaptorInternalServices::ReleasePreloadedShaderBinaries()
+   */
+  void ReleasePreloadedShaderBinaries() override;
+
 public: // Signals
 
   /**
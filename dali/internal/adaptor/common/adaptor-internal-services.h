@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/gl-abstraction.h>
 
@@ -115,6 +116,17 @@ public:
    */
   virtual void GetWindowContainerInterface( WindowContainer& windows ) = 0;
 
+  /**
+   * Used by the Render thread once the context is created, to discard the cached shader binaries built by another GL driver
+   * @param[in] driver The vendor, renderer and version of the GL driver
+   */
+  virtual void SetGraphicsDriver( const std::string& driver ) = 0;
+
+  /**
+   * Used by the Render thread once the first frame is rendered, to free the preloaded shader binaries Core hasn't loaded
+   */
+  virtual void ReleasePreloadedShaderBinaries() = 0;
+
 protected:
 
   /**
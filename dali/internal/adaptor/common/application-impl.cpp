@@ -237,6 +237,7 @@ void Application::OnInit()
   ResumeSignal().Connect( &GetImplementation( lifecycleController ), &LifecycleController::OnResume );
   ResetSignal().Connect( &GetImplementation( lifecycleController ), &LifecycleController::OnReset );
   LanguageChangedSignal().Connect( &GetImplementation( lifecycleController ), &LifecycleController::OnLanguageChanged );
+  LowMemorySignal().Connect( &GetImplementation( lifecycleController ), &LifecycleController::OnMemoryLow );
 
   Dali::Application application(this);
   mInitSignal.Emit( application );
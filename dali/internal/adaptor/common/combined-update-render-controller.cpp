@@ -28,12 +28,9 @@
 #include <dali/devel-api/adaptor-framework/thread-settings.h>
 #include <dali/internal/adaptor/common/adaptor-internal-services.h>
 #include <dali/internal/adaptor/common/combined-update-render-controller-debug.h>
-#include <dali/internal/graphics/gles/egl-graphics.h>
-#include <dali/internal/graphics/gles/egl-implementation.h>
-#include <dali/internal/graphics/common/graphics-interface.h>
+#include <dali/internal/adaptor/common/frame-pacing.h>
 #include <dali/internal/system/common/environment-options.h>
 #include <dali/internal/system/common/time-service.h>
-#include <dali/internal/window-system/common/window-impl.h>
 
 namespace Dali
 {
@@ -121,7 +118,8 @@ CombinedUpdateRenderController::CombinedUpdateRenderController( AdaptorInternalS
   mSurfaceResized( FALSE ),
   mForceClear( FALSE ),
   mUploadWithoutRendering( FALSE ),
-  mFirstFrameAfterResume( FALSE )
+  mFirstFrameAfterResume( FALSE ),
+  mFrameRenderer( adaptorInterfaces )
 {
   LOG_EVENT_TRACE;
 
@@ -519,50 +517,7 @@ void CombinedUpdateRenderController::UpdateRenderThread()
   // EGL has been initialised at this point
   NotifyGraphicsInitialised();
 
-  RenderSurfaceInterface* currentSurface = nullptr;
-
-  GraphicsInterface& graphics = mAdaptorInterfaces.GetGraphicsInterface();
-  EglGraphics* eglGraphics = static_cast<EglGraphics *>(&graphics);
-
-  // This will only be created once
-  EglInterface* eglInterface = &eglGraphics->GetEglInterface();
-
-  Internal::Adaptor::EglImplementation& eglImpl = static_cast<Internal::Adaptor::EglImplementation&>( *eglInterface );
-
-  // Try to use OpenGL es 3.0
-  // ChooseConfig returns false here when the device only support gles 2.0.
-  // Because eglChooseConfig with gles 3.0 setting fails when the device only support gles 2.0 and Our default setting is gles 3.0.
-  if( !eglImpl.ChooseConfig( true, COLOR_DEPTH_32 ) )
-  {
-    // Retry to use OpenGL es 2.0
-    eglGraphics->SetGlesVersion( 20 );
-    eglImpl.ChooseConfig( true, COLOR_DEPTH_32 );
-  }
-
-  // Check whether surfaceless context is supported
-  bool isSurfacelessContextSupported = eglImpl.IsSurfacelessContextSupported();
-  eglGraphics->SetIsSurfacelessContextSupported( isSurfacelessContextSupported );
-
-  if ( isSurfacelessContextSupported )
-  {
-    // Create a surfaceless OpenGL context for shared resources
-    eglImpl.CreateContext();
-    eglImpl.MakeContextCurrent( EGL_NO_SURFACE, eglImpl.GetContext() );
-  }
-  else
-  {
-    currentSurface = mAdaptorInterfaces.GetRenderSurfaceInterface();
-    if( currentSurface )
-    {
-      currentSurface->InitializeGraphics();
-      currentSurface->MakeContextCurrent();
-    }
-  }
-
-  eglGraphics->GetGlesInterface().ContextCreated();
-
-  // Tell core it has a context
-  mCore.ContextCreated();
+  mFrameRenderer.InitializeGraphics();
 
   NotifyThreadInitialised();
 
@@ -610,17 +565,7 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     if( DALI_UNLIKELY( newSurface ) )
     {
       LOG_UPDATE_RENDER_TRACE_FMT( "Replacing Surface" );
-      // This is designed for replacing pixmap surfaces, but should work for window as well
-      // we need to delete the surface and renderable (pixmap / window)
-      // Then create a new pixmap/window and new surface
-      // If the new surface has a different display connection, then the context will be lost
-      mAdaptorInterfaces.GetDisplayConnectionInterface().Initialize();
-      newSurface->InitializeGraphics();
-      newSurface->MakeContextCurrent();
-      // TODO: ReplaceGraphicsSurface doesn't work, InitializeGraphics()
-      // already creates new surface window, the surface and the context.
-      // We probably don't need ReplaceGraphicsSurface at all.
-      // newSurface->ReplaceGraphicsSurface();
+      mFrameRenderer.ReplaceSurface( newSurface );
       SurfaceReplaced();
     }
 
@@ -634,26 +579,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     const unsigned int currentTime = currentFrameStartTime / NANOSECONDS_PER_MILLISECOND;
     const unsigned int nextFrameTime = currentTime + mDefaultFrameDurationMilliseconds;
 
-    uint64_t noOfFramesSinceLastUpdate = 1;
-    float frameDelta = 0.0f;
-    if( useElapsedTime )
-    {
-      if( mThreadMode == ThreadMode::RUN_IF_REQUESTED )
-      {
-        extraFramesDropped = 0;
-        while( timeSinceLastFrame >= mDefaultFrameDurationNanoseconds )
-        {
-           timeSinceLastFrame -= mDefaultFrameDurationNanoseconds;
-           extraFramesDropped++;
-        }
-      }
-
-      // If using the elapsed time, then calculate frameDelta as a multiple of mDefaultFrameDelta
-      noOfFramesSinceLastUpdate += extraFramesDropped;
-
-      frameDelta = mDefaultFrameDelta * noOfFramesSinceLastUpdate;
-    }
-    LOG_UPDATE_RENDER( "timeSinceLastFrame(%llu) noOfFramesSinceLastUpdate(%u) frameDelta(%.6f)", timeSinceLastFrame, noOfFramesSinceLastUpdate, frameDelta );
+    const float frameDelta = FramePacing::CalculateFrameDelta( useElapsedTime, mThreadMode == ThreadMode::RUN_IF_REQUESTED, timeSinceLastFrame, mDefaultFrameDurationNanoseconds, mDefaultFrameDelta, extraFramesDropped );
+    LOG_UPDATE_RENDER( "timeSinceLastFrame(%llu) extraFramesDropped(%d) frameDelta(%.6f)", timeSinceLastFrame, extraFramesDropped, frameDelta );
 
     Integration::UpdateStatus updateStatus;
 
@@ -695,87 +622,11 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     // RENDER
     //////////////////////////////
 
-    mAdaptorInterfaces.GetDisplayConnectionInterface().ConsumeEvents();
-
-    if( mPreRenderCallback != NULL )
-    {
-      bool keepCallback = CallbackBase::ExecuteReturn<bool>(*mPreRenderCallback);
-      if( ! keepCallback )
-      {
-        delete mPreRenderCallback;
-        mPreRenderCallback = NULL;
-      }
-    }
-
-    if( eglImpl.IsSurfacelessContextSupported() )
-    {
-      // Make the shared surfaceless context as current before rendering
-      eglImpl.MakeContextCurrent( EGL_NO_SURFACE, eglImpl.GetContext() );
-    }
-
-    if( mFirstFrameAfterResume )
-    {
-      // mFirstFrameAfterResume is set to true when the thread is resumed
-      // Let eglImplementation know the first frame after thread initialized or resumed.
-      eglImpl.SetFirstFrameAfterResume();
-      mFirstFrameAfterResume = FALSE;
-    }
-
     Integration::RenderStatus renderStatus;
 
-    AddPerformanceMarker( PerformanceInterface::RENDER_START );
-
-    // Upload shared resources
-    mCore.PreRender( renderStatus, mForceClear, mUploadWithoutRendering );
-
-    if ( !mUploadWithoutRendering )
-    {
-      // Go through each window
-      WindowContainer windows;
-      mAdaptorInterfaces.GetWindowContainerInterface( windows );
-
-      for( auto&& window : windows )
-      {
-        Dali::Integration::Scene scene = window->GetScene();
-        Dali::RenderSurfaceInterface* windowSurface = window->GetSurface();
-
-        if ( scene && windowSurface )
-        {
-          Integration::RenderStatus windowRenderStatus;
-
-          windowSurface->InitializeGraphics();
-
-          // clear previous frame damaged render items rects, buffer history is tracked on surface level
-          mDamagedRects.clear();
-
-          // Collect damage rects
-          mCore.PreRender( scene, mDamagedRects );
-
-          // Render off-screen frame buffers first if any
-          mCore.RenderScene( windowRenderStatus, scene, true );
-
-          Rect<int> clippingRect; // Empty for fbo rendering
-
-          // Switch to the EGL context of the surface, merge damaged areas for previous frames
-          windowSurface->PreRender( surfaceResized, mDamagedRects, clippingRect ); // Switch GL context
-
-          if (clippingRect.IsEmpty())
-          {
-            mDamagedRects.clear();
-          }
-
-          // Render the surface
-          mCore.RenderScene( windowRenderStatus, scene, false, clippingRect );
-
-          if( windowRenderStatus.NeedsPostRender() )
-          {
-            windowSurface->PostRender( false, false, surfaceResized, mDamagedRects ); // Swap Buffer with damage
-          }
-        }
-      }
-    }
-
-    mCore.PostRender( mUploadWithoutRendering );
+    // mFirstFrameAfterResume is set to true when the thread is resumed
+    mFrameRenderer.Render( mPreRenderCallback, mFirstFrameAfterResume, mForceClear, mUploadWithoutRendering, surfaceResized, renderStatus );
+    mFirstFrameAfterResume = FALSE;
 
     //////////////////////////////
     // DELETE SURFACE
@@ -811,37 +662,10 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     // FRAME TIME
     //////////////////////////////
 
-    extraFramesDropped = 0;
-
-    if (timeToSleepUntil == 0)
-    {
-      // If this is the first frame after the thread is initialized or resumed, we
-      // use the actual time the current frame starts from to calculate the time to
-      // sleep until the next frame.
-      timeToSleepUntil = currentFrameStartTime + mDefaultFrameDurationNanoseconds;
-    }
-    else
-    {
-      // Otherwise, always use the sleep-until time calculated in the last frame to
-      // calculate the time to sleep until the next frame. In this way, if there is
-      // any time gap between the current frame and the next frame, or if update or
-      // rendering in the current frame takes too much time so that the specified
-      // sleep-until time has already passed, it will try to keep the frames syncing
-      // by shortening the duration of the next frame.
-      timeToSleepUntil += mDefaultFrameDurationNanoseconds;
-
-      // Check the current time at the end of the frame
-      uint64_t currentFrameEndTime = 0;
-      TimeService::GetNanoseconds( currentFrameEndTime );
-      while ( currentFrameEndTime > timeToSleepUntil + mDefaultFrameDurationNanoseconds )
-      {
-         // We are more than one frame behind already, so just drop the next frames
-         // until the sleep-until time is later than the current time so that we can
-         // catch up.
-         timeToSleepUntil += mDefaultFrameDurationNanoseconds;
-         extraFramesDropped++;
-      }
-    }
+    // Check the current time at the end of the frame
+    uint64_t currentFrameEndTime = 0;
+    TimeService::GetNanoseconds( currentFrameEndTime );
+    extraFramesDropped = FramePacing::CalculateTimeToSleepUntil( currentFrameStartTime, currentFrameEndTime, mDefaultFrameDurationNanoseconds, timeToSleepUntil );
 
     // Render to FBO is intended to measure fps above 60 so sleep is not wanted.
     if( 0u == renderToFboInterval )
@@ -851,21 +675,7 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     }
   }
 
-  // Inform core of context destruction
-  mCore.ContextDestroyed();
-
-  WindowContainer windows;
-  mAdaptorInterfaces.GetWindowContainerInterface( windows );
-
-  // Destroy surfaces
-  for( auto&& window : windows )
-  {
-    Dali::RenderSurfaceInterface* surface = window->GetSurface();
-    surface->DestroySurface();
-  }
-
-  // Shutdown EGL
-  eglInterface->TerminateGles();
+  mFrameRenderer.TerminateGraphics();
 
   LOG_UPDATE_RENDER( "THREAD DESTROYED" );
 
@@ -28,6 +28,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/thread-synchronization-interface.h>
+#include <dali/internal/adaptor/common/frame-renderer.h>
 #include <dali/internal/adaptor/common/thread-controller-interface.h>
 #include <dali/internal/system/common/fps-tracker.h>
 #include <dali/internal/system/common/performance-interface.h>
@@ -392,7 +393,7 @@ private:
 
   volatile unsigned int             mFirstFrameAfterResume;            ///< Will be set to check the first frame after resume (for log)
 
-  std::vector<Rect<int>>            mDamagedRects;                     ///< Keeps collected damaged render items rects for one render pass
+  FrameRenderer                     mFrameRenderer;                    ///< Sets the graphics up and renders the frames (update-render thread only).
 };
 
 } // namespace Adaptor
@@ -0,0 +1,121 @@
+#ifndef DALI_INTERNAL_ADAPTOR_FRAME_PACING_H
+#define DALI_INTERNAL_ADAPTOR_FRAME_PACING_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief The frame timing of the update render controller, which paces the frames without a VSync thread.
+ */
+namespace FramePacing
+{
+
+/**
+ * @brief Calculates the time the animations progress by in the next update.
+ *
+ * @param[in] useElapsedTime Whether the elapsed time is used, otherwise the animations don't progress
+ * @param[in] countElapsedFrames Whether the frames elapsed since the last frame are counted, rather than the ones dropped by the frame pacing
+ * @param[in] timeSinceLastFrame The time elapsed since the start of the last frame, in nanoseconds
+ * @param[in] frameDuration The duration of a frame, in nanoseconds
+ * @param[in] defaultFrameDelta The time a frame lasts, in seconds
+ * @param[in,out] extraFramesDropped The frames dropped since the last frame, set to the frames elapsed if they're counted
+ * @return The time delta, in seconds.
+ */
+inline float CalculateFrameDelta( bool useElapsedTime, bool countElapsedFrames, uint64_t timeSinceLastFrame, uint64_t frameDuration, float defaultFrameDelta, int& extraFramesDropped )
+{
+  float frameDelta = 0.0f;
+  if( useElapsedTime )
+  {
+    if( countElapsedFrames )
+    {
+      extraFramesDropped = 0;
+      while( timeSinceLastFrame >= frameDuration )
+      {
+         timeSinceLastFrame -= frameDuration;
+         extraFramesDropped++;
+      }
+    }
+
+    // If using the elapsed time, then calculate frameDelta as a multiple of defaultFrameDelta
+    const uint64_t noOfFramesSinceLastUpdate = 1u + extraFramesDropped;
+    frameDelta = defaultFrameDelta * noOfFramesSinceLastUpdate;
+  }
+  return frameDelta;
+}
+
+/**
+ * @brief Calculates when the next frame starts.
+ *
+ * The sleep-until time of the last frame is used rather than the current time, so if there is any time gap
+ * between the frames, or if the current frame took so long that the sleep-until time has already passed,
+ * the frames keep syncing by shortening the duration of the next frame.
+ *
+ * @param[in] currentFrameStartTime When the current frame started, in nanoseconds
+ * @param[in] currentFrameEndTime When the current frame ended, in nanoseconds
+ * @param[in] frameDuration The duration of a frame, in nanoseconds
+ * @param[in,out] timeToSleepUntil When the current frame was due, or zero if the thread waited before it; set to when the next frame is due.
+ * @return The number of frames dropped to catch up, when more than a frame behind.
+ */
+inline int CalculateTimeToSleepUntil( uint64_t currentFrameStartTime, uint64_t currentFrameEndTime, uint64_t frameDuration, uint64_t& timeToSleepUntil )
+{
+  int extraFramesDropped = 0;
+
+  if( timeToSleepUntil == 0 )
+  {
+    // If this is the first frame after the thread is initialized or resumed, we
+    // use the actual time the current frame starts from to calculate the time to
+    // sleep until the next frame.
+    timeToSleepUntil = currentFrameStartTime + frameDuration;
+  }
+  else
+  {
+    timeToSleepUntil += frameDuration;
+
+    while( currentFrameEndTime > timeToSleepUntil + frameDuration )
+    {
+      // We are more than one frame behind already, so just drop the next frames
+      // until the sleep-until time is later than the current time so that we can
+      // catch up.
+      timeToSleepUntil += frameDuration;
+      extraFramesDropped++;
+    }
+  }
+
+  return extraFramesDropped;
+}
+
+} // namespace FramePacing
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_FRAME_PACING_H
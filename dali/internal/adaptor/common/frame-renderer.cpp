@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/adaptor/common/frame-renderer.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/adaptor/common/adaptor-internal-services.h>
+#include <dali/internal/graphics/gles/egl-graphics.h>
+#include <dali/internal/graphics/gles/egl-implementation.h>
+#include <dali/internal/graphics/common/graphics-interface.h>
+#include <dali/internal/window-system/common/window-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+FrameRenderer::FrameRenderer( AdaptorInternalServices& adaptorInterfaces )
+: mAdaptorInterfaces( adaptorInterfaces ),
+  mPerformanceInterface( adaptorInterfaces.GetPerformanceInterface() ),
+  mCore( adaptorInterfaces.GetCore() ),
+  mEglGraphics( nullptr ),
+  mEglImplementation( nullptr ),
+  mDamagedRects(),
+  mClippingRects(),
+  mPreloadedShaderBinariesReleased( false )
+{
+}
+
+void FrameRenderer::InitializeGraphics()
+{
+  GraphicsInterface& graphics = mAdaptorInterfaces.GetGraphicsInterface();
+  mEglGraphics = static_cast<EglGraphics *>(&graphics);
+
+  // This will only be created once
+  EglInterface* eglInterface = &mEglGraphics->GetEglInterface();
+
+  mEglImplementation = static_cast<Internal::Adaptor::EglImplementation*>( eglInterface );
+  EglImplementation& eglImpl = *mEglImplementation;
+
+  // Try to use OpenGL es 3.0
+  // ChooseConfig returns false here when the device only support gles 2.0.
+  // Because eglChooseConfig with gles 3.0 setting fails when the device only support gles 2.0 and Our default setting is gles 3.0.
+  if( !eglImpl.ChooseConfig( true, COLOR_DEPTH_32 ) )
+  {
+    // Retry to use OpenGL es 2.0
+    mEglGraphics->SetGlesVersion( 20 );
+    eglImpl.ChooseConfig( true, COLOR_DEPTH_32 );
+  }
+
+  // Check whether surfaceless context is supported
+  bool isSurfacelessContextSupported = eglImpl.IsSurfacelessContextSupported();
+  mEglGraphics->SetIsSurfacelessContextSupported( isSurfacelessContextSupported );
+
+  if ( isSurfacelessContextSupported )
+  {
+    // Create a surfaceless OpenGL context for shared resources
+    eglImpl.CreateContext();
+    eglImpl.MakeContextCurrent( EGL_NO_SURFACE, eglImpl.GetContext() );
+  }
+  else
+  {
+    RenderSurfaceInterface* currentSurface = mAdaptorInterfaces.GetRenderSurfaceInterface();
+    if( currentSurface )
+    {
+      currentSurface->InitializeGraphics();
+      currentSurface->MakeContextCurrent();
+    }
+  }
+
+  mEglGraphics->GetGlesInterface().ContextCreated();
+
+  // Discards the cached shader binaries before Core loads them if the driver changed.
+  mAdaptorInterfaces.SetGraphicsDriver( mEglGraphics->GetGlesInterface().GetDriver() );
+
+  // Tell core it has a context
+  mCore.ContextCreated();
+}
+
+void FrameRenderer::ReplaceSurface( Dali::RenderSurfaceInterface* newSurface )
+{
+  // This is designed for replacing pixmap surfaces, but should work for window as well
+  // we need to delete the surface and renderable (pixmap / window)
+  // Then create a new pixmap/window and new surface
+  // If the new surface has a different display connection, then the context will be lost
+  mAdaptorInterfaces.GetDisplayConnectionInterface().Initialize();
+  newSurface->InitializeGraphics();
+  newSurface->MakeContextCurrent();
+  // TODO: ReplaceGraphicsSurface doesn't work, InitializeGraphics()
+  // already creates new surface window, the surface and the context.
+  // We probably don't need ReplaceGraphicsSurface at all.
+  // newSurface->ReplaceGraphicsSurface();
+}
+
+void FrameRenderer::Render( CallbackBase*& preRenderCallback, bool firstFrameAfterResume, bool forceClear, bool uploadWithoutRendering, bool surfaceResized, Integration::RenderStatus& renderStatus )
+{
+  mAdaptorInterfaces.GetDisplayConnectionInterface().ConsumeEvents();
+
+  if( preRenderCallback != NULL )
+  {
+    bool keepCallback = CallbackBase::ExecuteReturn<bool>(*preRenderCallback);
+    if( ! keepCallback )
+    {
+      delete preRenderCallback;
+      preRenderCallback = NULL;
+    }
+  }
+
+  EglImplementation& eglImpl = *mEglImplementation;
+  if( eglImpl.IsSurfacelessContextSupported() )
+  {
+    // Make the shared surfaceless context as current before rendering
+    eglImpl.MakeContextCurrent( EGL_NO_SURFACE, eglImpl.GetContext() );
+  }
+
+  if( firstFrameAfterResume )
+  {
+    // Let eglImplementation know the first frame after thread initialized or resumed.
+    eglImpl.SetFirstFrameAfterResume();
+  }
+
+  AddPerformanceMarker( PerformanceInterface::RENDER_START );
+
+  // Upload shared resources
+  mCore.PreRender( renderStatus, forceClear, uploadWithoutRendering );
+
+  if ( !uploadWithoutRendering )
+  {
+    // Go through each window
+    WindowContainer windows;
+    mAdaptorInterfaces.GetWindowContainerInterface( windows );
+
+    for( auto&& window : windows )
+    {
+      Dali::Integration::Scene scene = window->GetScene();
+      Dali::RenderSurfaceInterface* windowSurface = window->GetSurface();
+
+      if ( scene && windowSurface )
+      {
+        Integration::RenderStatus windowRenderStatus;
+
+        windowSurface->InitializeGraphics();
+
+        // clear previous frame damaged render items rects, buffer history is tracked on surface level
+        mDamagedRects.clear();
+
+        // Collect damage rects
+        mCore.PreRender( scene, mDamagedRects );
+
+        // Render off-screen frame buffers first if any
+        mCore.RenderScene( windowRenderStatus, scene, true );
+
+        Rect<int> clippingRect; // Empty for fbo rendering
+
+        // Switch to the EGL context of the surface, merge damaged areas for previous frames
+        windowSurface->PreRender( surfaceResized, mDamagedRects, clippingRect ); // Switch GL context
+
+        if (clippingRect.IsEmpty())
+        {
+          mDamagedRects.clear();
+        }
+
+        // Render the surface, each damaged area on its own if they're far apart
+        windowSurface->GetClippingRects( mClippingRects );
+        if( mClippingRects.empty() )
+        {
+          mCore.RenderScene( windowRenderStatus, scene, false, clippingRect );
+        }
+        else
+        {
+          for( auto&& rect : mClippingRects )
+          {
+            mCore.RenderScene( windowRenderStatus, scene, false, rect );
+          }
+        }
+
+        if( windowRenderStatus.NeedsPostRender() )
+        {
+          windowSurface->PostRender( false, false, surfaceResized, mDamagedRects ); // Swap Buffer with damage
+        }
+      }
+    }
+  }
+
+  mCore.PostRender( uploadWithoutRendering );
+
+  if( !mPreloadedShaderBinariesReleased && !uploadWithoutRendering )
+  {
+    // Core has loaded the shaders of the first frame, the other binaries are read when they are needed.
+    mAdaptorInterfaces.ReleasePreloadedShaderBinaries();
+    mPreloadedShaderBinariesReleased = true;
+  }
+}
+
+void FrameRenderer::TerminateGraphics()
+{
+  // Inform core of context destruction
+  mCore.ContextDestroyed();
+
+  WindowContainer windows;
+  mAdaptorInterfaces.GetWindowContainerInterface( windows );
+
+  // Destroy surfaces
+  for( auto&& window : windows )
+  {
+    Dali::RenderSurfaceInterface* surface = window->GetSurface();
+    surface->DestroySurface();
+  }
+
+  // Shutdown EGL
+  mEglGraphics->GetEglInterface().TerminateGles();
+}
+
+void FrameRenderer::AddPerformanceMarker( PerformanceInterface::MarkerType type )
+{
+  if( mPerformanceInterface )
+  {
+    mPerformanceInterface->AddMarker( type );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
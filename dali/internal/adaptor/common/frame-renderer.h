@@ -0,0 +1,124 @@
+#ifndef DALI_INTERNAL_ADAPTOR_FRAME_RENDERER_H
+#define DALI_INTERNAL_ADAPTOR_FRAME_RENDERER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+#include <dali/integration-api/core.h>
+#include <dali/public-api/math/rect.h>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
+
+namespace Dali
+{
+
+class RenderSurfaceInterface;
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class AdaptorInternalServices;
+class EglGraphics;
+class EglImplementation;
+
+/**
+ * @brief Sets the graphics up, renders the frames updated by Core to the windows and shuts the graphics down.
+ *
+ * Used by the update render controller; all its methods are called on the thread which renders.
+ */
+class FrameRenderer
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] adaptorInterfaces The adaptor internal interface
+   */
+  FrameRenderer( AdaptorInternalServices& adaptorInterfaces );
+
+  /**
+   * @brief Chooses the EGL configuration, creates the context and tells Core it has a context.
+   *
+   * The display connection must have been initialised.
+   */
+  void InitializeGraphics();
+
+  /**
+   * @brief Replaces the surface rendered to, making its context current.
+   *
+   * @param[in] newSurface The new surface
+   */
+  void ReplaceSurface( Dali::RenderSurfaceInterface* newSurface );
+
+  /**
+   * @brief Renders the last updated frame of Core to every window, from Core::PreRender to Core::PostRender.
+   *
+   * @param[in,out] preRenderCallback The callback called before rendering, deleted and set to nullptr if it isn't kept
+   * @param[in] firstFrameAfterResume Whether this is the first frame rendered after a resume
+   * @param[in] forceClear Whether the surface should be cleared
+   * @param[in] uploadWithoutRendering Whether the resources should be uploaded without rendering
+   * @param[in] surfaceResized Whether the surface has been resized by the update of the frame
+   * @param[out] renderStatus The status of the render
+   */
+  void Render( CallbackBase*& preRenderCallback, bool firstFrameAfterResume, bool forceClear, bool uploadWithoutRendering, bool surfaceResized, Integration::RenderStatus& renderStatus );
+
+  /**
+   * @brief Tells Core its context is destroyed, destroys the surfaces of the windows and terminates EGL.
+   */
+  void TerminateGraphics();
+
+private:
+
+  // Undefined
+  FrameRenderer( const FrameRenderer& ) = delete;
+  FrameRenderer& operator=( const FrameRenderer& ) = delete;
+
+  /**
+   * @brief Helper to add a performance marker to the performance server (if it's active)
+   * @param[in]  type  performance marker type
+   */
+  void AddPerformanceMarker( PerformanceInterface::MarkerType type );
+
+private:
+
+  AdaptorInternalServices& mAdaptorInterfaces;    ///< The adaptor internal interface
+  PerformanceInterface*    mPerformanceInterface; ///< The performance logging interface
+  Integration::Core&       mCore;                 ///< Dali core reference
+  EglGraphics*             mEglGraphics;          ///< The graphics, set by InitializeGraphics()
+  EglImplementation*       mEglImplementation;    ///< The EGL implementation, set by InitializeGraphics()
+
+  std::vector<Rect<int>>   mDamagedRects;         ///< Keeps collected damaged render items rects for one render pass
+  std::vector<Rect<int>>   mClippingRects;        ///< Keeps the areas of the surface rendered separately in one render pass
+
+  bool                     mPreloadedShaderBinariesReleased; ///< Whether the preloaded shader binaries were released after the first frame
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_FRAME_RENDERER_H
@@ -24,6 +24,7 @@
 // INTERNAL INCLUDES
 #include <dali/internal/adaptor/common/adaptor-impl.h>
 #include <dali/devel-api/common/singleton-service.h>
+#include <dali/internal/imaging/common/pixel-buffer-pool.h>
 
 namespace Dali
 {
@@ -157,6 +158,9 @@ void LifecycleController::OnTerminate( Dali::Application& app )
 void LifecycleController::OnPause( Dali::Application& app )
 {
   EmitPauseSignal();
+
+  // The pixel buffers kept for reuse aren't needed in the background.
+  PixelBufferPool::Get().Trim();
 }
 
 void LifecycleController::OnResume( Dali::Application& app )
@@ -174,6 +178,14 @@ void LifecycleController::OnLanguageChanged( Dali::Application& app )
   EmitLanguageChangedSignal();
 }
 
+void LifecycleController::OnMemoryLow( Dali::DeviceStatus::Memory::Status status )
+{
+  if( status != Dali::DeviceStatus::Memory::NORMAL )
+  {
+    PixelBufferPool::Get().Trim();
+  }
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
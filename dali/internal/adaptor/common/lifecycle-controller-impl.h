@@ -133,6 +133,13 @@ public:
    */
   void OnLanguageChanged( Dali::Application& app );
 
+  /**
+   * Called when the framework informs the application that the memory of the device is low.
+   *
+   * @param[in] status The memory status
+   */
+  void OnMemoryLow( Dali::DeviceStatus::Memory::Status status );
+
 protected:
 
   /**
@@ -411,7 +411,7 @@ EGLint EglImplementation::GetBufferAge(EGLSurface& eglSurface) const
   return age;
 }
 
-void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, std::vector< Rect< int > >& damagedRects )
+void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, const std::vector< Rect< int > >& damagedRects )
 {
   if( !mPartialUpdateRequired )
   {
@@ -420,7 +420,7 @@ void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, std::vector< Re
 
   if( eglSurface != EGL_NO_SURFACE ) // skip if using surfaceless context
   {
-    EGLBoolean result = mEglSetDamageRegionKHR( mEglDisplay, eglSurface, reinterpret_cast< int* >( damagedRects.data() ), 1 );
+    EGLBoolean result = mEglSetDamageRegionKHR( mEglDisplay, eglSurface, reinterpret_cast< int* >( const_cast< std::vector< Rect< int > >& >( damagedRects ).data() ), damagedRects.size() );
     if (result == EGL_FALSE)
     {
       DALI_LOG_ERROR( "eglSetDamageRegionKHR(%d)\n", eglGetError() );
@@ -137,7 +137,7 @@ public:
   /**
    * Performs an OpenGL set damage command with damaged rects
    */
-  void SetDamageRegion( EGLSurface& eglSurface, std::vector< Rect< int > >& damagedRects );
+  void SetDamageRegion( EGLSurface& eglSurface, const std::vector< Rect< int > >& damagedRects );
 
   /**
    * Performs an OpenGL swap buffers command with damaged rects
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <memory>
 #include <cstdlib>
+#include <string>
 #include <GLES2/gl2.h>
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/devel-api/threading/conditional-wait.h>
@@ -81,6 +82,25 @@ public:
     mIsContextCreated = true;
   }
 
+  /**
+   * Retrieves the vendor, renderer and version of the GL driver, which the shader binaries are only valid for.
+   * The context must be current.
+   */
+  std::string GetDriver()
+  {
+    std::string driver;
+    for( GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION } )
+    {
+      const GLubyte* value = glGetString( name );
+      if( value )
+      {
+        driver += reinterpret_cast<const char*>( value );
+      }
+      driver += '\n';
+    }
+    return driver;
+  }
+
   void SetGlesVersion( const int32_t glesVersion )
   {
     if( mGlesVersion != glesVersion )
@@ -16,6 +16,7 @@
 
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 #include <dali/internal/imaging/common/alpha-mask.h>
+#include <dali/internal/imaging/common/pixel-converters.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 #include <dali/public-api/images/image-operations.h> // For ImageDimensions
 #include <dali/internal/imaging/common/image-operations.h>
@@ -61,6 +62,14 @@ void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask )
   // if image is premultiplied, the other channels of the image need to multiply by alpha.
   if( buffer.IsAlphaPreMultiplied() )
   {
+    // The masks whose alpha is a byte can feed a converter specialized for the format of the buffer.
+    MultiplyRowFunction multiplyRow = GetMultiplyRowFunction( destPixelFormat );
+    if( multiplyRow && srcAlphaMask == 0xFF && Pixel::HasAlpha( srcPixelFormat ) )
+    {
+      multiplyRow( destBuffer, srcBuffer + srcAlphaByteOffset, srcBytesPerPixel, buffer.GetWidth() * buffer.GetHeight() );
+      return;
+    }
+
     for( unsigned int row = 0; row < buffer.GetHeight(); ++row )
     {
       for( unsigned int col = 0; col < buffer.GetWidth(); ++col )
@@ -148,6 +157,18 @@ PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuff
   float srcAlphaValue = 1.0f;
   unsigned char destAlpha = 0;
 
+  // The color channels are converted at once when there is a converter for the format. The luminance
+  // formats are left to ConvertColorChannelsToRGBA8888(), which doesn't copy the luminance to the colors.
+  ConvertRowFunction convertRow = nullptr;
+  if( HasChannel( srcColorPixelFormat, Adaptor::RED ) )
+  {
+    convertRow = GetConvertRowFunction( srcColorPixelFormat, destPixelFormat );
+  }
+  if( convertRow )
+  {
+    convertRow( oldBuffer, destBuffer, buffer.GetWidth() * buffer.GetHeight() );
+  }
+
   for( unsigned int row = 0; row < buffer.GetHeight(); ++row )
   {
     for( unsigned int col = 0; col < buffer.GetWidth(); ++col )
@@ -155,7 +176,10 @@ PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuff
       unsigned char alpha = srcBuffer[srcAlphaOffset + srcAlphaByteOffset] & srcAlphaMask;
       srcAlphaValue = float(alpha)/255.0f;
 
-      ConvertColorChannelsToRGBA8888(oldBuffer, srcColorOffset, srcColorPixelFormat, destBuffer, destOffset );
+      if( !convertRow )
+      {
+        ConvertColorChannelsToRGBA8888(oldBuffer, srcColorOffset, srcColorPixelFormat, destBuffer, destOffset );
+      }
 
       if( hasAlpha )
       {
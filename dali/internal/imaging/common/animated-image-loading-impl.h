@@ -18,6 +18,7 @@
  *
  */
 // EXTERNAL INCLUDES
+#include <memory>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/math/uint-16-pair.h>
@@ -27,6 +28,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-adaptor-common.h>
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
+#include <dali/internal/imaging/common/animated-image-streaming.h>
 
 namespace Dali
 {
@@ -45,6 +47,10 @@ typedef IntrusivePtr<AnimatedImageLoading> AnimatedImageLoadingPtr;
 /**
  * Class interface for animated image loading.
  * Each loading classes for animated image file format(e.g., gif and webp) needs to inherit this interface
+ *
+ * @note The streaming mode decodes the frames with LoadFrame() and GetFrameInterval() on a worker thread,
+ * so the derived classes must make LoadFrame(), LoadNextNFrames() and GetFrameInterval() thread safe and
+ * call StopStreaming() at the start of their destructor.
  */
 class AnimatedImageLoading : public BaseObject
 {
@@ -97,6 +103,60 @@ public:
    * @copydoc Dali::AnimatedImageLoading::GetUrl()
    */
   virtual std::string GetUrl() const = 0;
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::StartStreaming()
+   */
+  void StartStreaming( uint32_t frameIndex, uint32_t maximumBufferedFrames )
+  {
+    if( !mStreaming )
+    {
+      mStreaming.reset( new AnimatedImageStreaming( *this ) );
+    }
+    mStreaming->Start( frameIndex, maximumBufferedFrames );
+  }
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::GetStreamedFrame()
+   */
+  Dali::Devel::PixelBuffer GetStreamedFrame( uint32_t frameIndex )
+  {
+    return mStreaming ? mStreaming->GetFrame( frameIndex ) : LoadFrame( frameIndex );
+  }
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::SeekStreaming()
+   */
+  void SeekStreaming( uint32_t frameIndex )
+  {
+    if( mStreaming )
+    {
+      mStreaming->Seek( frameIndex );
+    }
+  }
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::StopStreaming()
+   */
+  void StopStreaming()
+  {
+    if( mStreaming )
+    {
+      mStreaming->Stop();
+    }
+  }
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::GetStreamingStatistics()
+   */
+  Dali::AnimatedImageLoading::StreamingStatistics GetStreamingStatistics() const
+  {
+    return mStreaming ? mStreaming->GetStatistics() : Dali::AnimatedImageLoading::StreamingStatistics();
+  }
+
+private:
+
+  std::unique_ptr<AnimatedImageStreaming> mStreaming; ///< Decodes the frames ahead, created when the streaming is first started
 };
 
 } // namespace Adaptor
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/animated-image-streaming.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <chrono>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/animated-image-loading-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gStreamingLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_ANIMATED_IMAGE_STREAMING" );
+#endif
+
+const uint32_t MINIMUM_BUFFERED_FRAMES = 2u;     ///< The worker always decodes this number of frames ahead, if the buffer is big enough.
+const uint32_t MINIMUM_LOOK_AHEAD_TIME = 100u;   ///< The buffered frames last at least this long, in milliseconds.
+const uint32_t LOOK_AHEAD_DECODE_TIMES = 4u;     ///< The buffered frames last at least this number of average decoding times.
+const uint32_t INITIAL_DECODE_TIME = 10000u;     ///< The decoding time assumed before the first frame is decoded, in microseconds.
+
+} // unnamed namespace
+
+AnimatedImageStreaming::AnimatedImageStreaming( AnimatedImageLoading& loading )
+: mLoading( loading ),
+  mConditionalWait(),
+  mFrames(),
+  mWorker(),
+  mStatistics(),
+  mFirstFrame( 0u ),
+  mFrameCount( 0u ),
+  mNextFrame( 0u ),
+  mDecodingFrame( 0u ),
+  mGeneration( 0u ),
+  mBufferedTime( 0u ),
+  mAverageDecodeTime( INITIAL_DECODE_TIME ),
+  mIsDecoding( false ),
+  mTerminate( false )
+{
+}
+
+AnimatedImageStreaming::~AnimatedImageStreaming()
+{
+  Stop();
+}
+
+void AnimatedImageStreaming::Start( uint32_t frameIndex, uint32_t maximumBufferedFrames )
+{
+  Stop();
+
+  mFrameCount = mLoading.GetImageCount();
+  if( 0u == mFrameCount )
+  {
+    return;
+  }
+
+  mFrames.resize( std::max( maximumBufferedFrames, 1u ) );
+  mFirstFrame = 0u;
+  mNextFrame = frameIndex % mFrameCount;
+  mBufferedTime = 0u;
+  mAverageDecodeTime = INITIAL_DECODE_TIME;
+  mStatistics = Dali::AnimatedImageLoading::StreamingStatistics();
+  mTerminate = false;
+
+  mWorker = std::thread( &AnimatedImageStreaming::Run, this );
+}
+
+Dali::Devel::PixelBuffer AnimatedImageStreaming::GetFrame( uint32_t frameIndex )
+{
+  if( !mWorker.joinable() )
+  {
+    return mLoading.LoadFrame( frameIndex );
+  }
+
+  frameIndex %= mFrameCount;
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+
+    bool isLate = false;
+    while( true )
+    {
+      for( uint32_t i = 0u; i < mStatistics.bufferedFrames; ++i )
+      {
+        if( mFrames[( mFirstFrame + i ) % mFrames.size()].index == frameIndex )
+        {
+          // The frames before were skipped.
+          mStatistics.droppedFrames += i;
+          for( ; i > 0u; --i )
+          {
+            PopFrame();
+          }
+
+          Dali::Devel::PixelBuffer pixelBuffer = mFrames[mFirstFrame].pixelBuffer;
+          PopFrame();
+
+          mStatistics.lateFrames += isLate ? 1u : 0u;
+          mConditionalWait.Notify( lock );
+          return pixelBuffer;
+        }
+      }
+
+      if( !mIsDecoding || ( mDecodingFrame != frameIndex ) )
+      {
+        break;
+      }
+
+      // The worker is decoding the frame; waiting is faster than decoding it again.
+      isLate = true;
+      mConditionalWait.Wait( lock );
+    }
+
+    // The frame is behind or far ahead of the worker; it continues after the frame.
+    ++mStatistics.lateFrames;
+    SeekFrom( ( frameIndex + 1u ) % mFrameCount );
+    mConditionalWait.Notify( lock );
+  }
+
+  DALI_LOG_INFO( gStreamingLogFilter, Debug::Verbose, "Frame %u was not decoded ahead\n", frameIndex );
+
+  return mLoading.LoadFrame( frameIndex );
+}
+
+void AnimatedImageStreaming::Seek( uint32_t frameIndex )
+{
+  if( !mWorker.joinable() )
+  {
+    return;
+  }
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  SeekFrom( frameIndex % mFrameCount );
+  mConditionalWait.Notify( lock );
+}
+
+void AnimatedImageStreaming::Stop()
+{
+  if( !mWorker.joinable() )
+  {
+    return;
+  }
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+  mWorker.join();
+
+  // The statistics are kept, but not the frames.
+  mStatistics.droppedFrames += mStatistics.bufferedFrames;
+  while( mStatistics.bufferedFrames > 0u )
+  {
+    PopFrame();
+  }
+
+  DALI_LOG_INFO( gStreamingLogFilter, Debug::General, "Stopped %s, decoded:%u late:%u dropped:%u\n",
+                 mLoading.GetUrl().c_str(), mStatistics.decodedFrames, mStatistics.lateFrames, mStatistics.droppedFrames );
+}
+
+Dali::AnimatedImageLoading::StreamingStatistics AnimatedImageStreaming::GetStatistics() const
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  return mStatistics;
+}
+
+void AnimatedImageStreaming::Run()
+{
+  while( true )
+  {
+    uint32_t frameIndex = 0u;
+    uint32_t generation = 0u;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      while( !mTerminate && IsLookAheadReached() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      if( mTerminate )
+      {
+        return;
+      }
+
+      frameIndex = mNextFrame;
+      generation = mGeneration;
+      mNextFrame = ( mNextFrame + 1u ) % mFrameCount;
+      mDecodingFrame = frameIndex;
+      mIsDecoding = true;
+    }
+
+    Dali::Devel::PixelBuffer pixelBuffer;
+    uint32_t interval = 0u;
+    const auto start = std::chrono::steady_clock::now();
+    pixelBuffer = mLoading.LoadFrame( frameIndex );
+
+    // The interval may only be known once the frame is decoded.
+    interval = mLoading.GetFrameInterval( frameIndex );
+    const uint32_t decodeTime = static_cast<uint32_t>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count() );
+
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mIsDecoding = false;
+    mAverageDecodeTime = ( mAverageDecodeTime * 3u + decodeTime ) / 4u;
+
+    if( generation == mGeneration )
+    {
+      Frame& frame = mFrames[( mFirstFrame + mStatistics.bufferedFrames ) % mFrames.size()];
+      frame.index = frameIndex;
+      frame.interval = interval;
+      frame.pixelBuffer = pixelBuffer;
+
+      ++mStatistics.bufferedFrames;
+      ++mStatistics.decodedFrames;
+      mBufferedTime += interval;
+    }
+    else
+    {
+      // Seeked while decoding
+      ++mStatistics.droppedFrames;
+    }
+
+    // Wakes up a caller waiting for the frame.
+    mConditionalWait.Notify( lock );
+  }
+}
+
+bool AnimatedImageStreaming::IsLookAheadReached() const
+{
+  if( mStatistics.bufferedFrames >= mFrames.size() )
+  {
+    return true;
+  }
+
+  if( mStatistics.bufferedFrames < MINIMUM_BUFFERED_FRAMES )
+  {
+    return false;
+  }
+
+  // Frames with short intervals need to be decoded further ahead.
+  const uint32_t lookAheadTime = std::max( MINIMUM_LOOK_AHEAD_TIME, LOOK_AHEAD_DECODE_TIMES * mAverageDecodeTime / 1000u );
+  return mBufferedTime >= lookAheadTime;
+}
+
+void AnimatedImageStreaming::SeekFrom( uint32_t frameIndex )
+{
+  mStatistics.droppedFrames += mStatistics.bufferedFrames;
+  while( mStatistics.bufferedFrames > 0u )
+  {
+    PopFrame();
+  }
+
+  mNextFrame = frameIndex;
+  ++mGeneration;
+}
+
+void AnimatedImageStreaming::PopFrame()
+{
+  Frame& frame = mFrames[mFirstFrame];
+  mBufferedTime -= frame.interval;
+  frame.pixelBuffer.Reset();
+
+  mFirstFrame = ( mFirstFrame + 1u ) % mFrames.size();
+  --mStatistics.bufferedFrames;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
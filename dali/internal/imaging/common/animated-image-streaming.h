@@ -0,0 +1,153 @@
+#ifndef DALI_INTERNAL_ANIMATED_IMAGE_STREAMING_H
+#define DALI_INTERNAL_ANIMATED_IMAGE_STREAMING_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/animated-image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class AnimatedImageLoading;
+
+/**
+ * Decodes the frames of an animated image ahead of playback on a worker thread, into a ring buffer.
+ *
+ * The worker decodes the frames in playing order while the buffered frames last less than a few
+ * times the average decoding time of a frame, according to the interval of each frame, and while
+ * the buffer is not full. The buffer, the position of the worker and the statistics are guarded by
+ * the lock of mConditionalWait; the loaders serialize the decoding of the worker with the other calls.
+ */
+class AnimatedImageStreaming
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] loading The loader decoding the frames. It must outlive the worker thread.
+   */
+  explicit AnimatedImageStreaming( AnimatedImageLoading& loading );
+
+  /**
+   * @brief Destructor. Stops the worker thread.
+   */
+  ~AnimatedImageStreaming();
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::StartStreaming()
+   */
+  void Start( uint32_t frameIndex, uint32_t maximumBufferedFrames );
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::GetStreamedFrame()
+   */
+  Dali::Devel::PixelBuffer GetFrame( uint32_t frameIndex );
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::SeekStreaming()
+   */
+  void Seek( uint32_t frameIndex );
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::StopStreaming()
+   */
+  void Stop();
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::GetStreamingStatistics()
+   */
+  Dali::AnimatedImageLoading::StreamingStatistics GetStatistics() const;
+
+private:
+
+  // Undefined
+  AnimatedImageStreaming( const AnimatedImageStreaming& ) = delete;
+  AnimatedImageStreaming& operator=( const AnimatedImageStreaming& ) = delete;
+
+  /**
+   * @brief The loop of the worker thread. Decodes the next frame whenever the look-ahead is not reached.
+   */
+  void Run();
+
+  /**
+   * @brief Whether enough frames are buffered for the worker to wait. Called with the lock held.
+   */
+  bool IsLookAheadReached() const;
+
+  /**
+   * @brief Discards the buffered frames and continues decoding from a frame. Called with the lock held.
+   *
+   * @param[in] frameIndex The next frame to decode
+   */
+  void SeekFrom( uint32_t frameIndex );
+
+  /**
+   * @brief Removes the oldest buffered frame. Called with the lock held.
+   */
+  void PopFrame();
+
+private:
+
+  /**
+   * @brief A frame decoded ahead.
+   */
+  struct Frame
+  {
+    uint32_t                 index;       ///< The index of the frame
+    uint32_t                 interval;    ///< How long the frame is shown, in milliseconds
+    Dali::Devel::PixelBuffer pixelBuffer; ///< The decoded frame, or an empty handle if decoding failed
+  };
+
+  AnimatedImageLoading&   mLoading;           ///< The loader decoding the frames
+  mutable ConditionalWait mConditionalWait;   ///< Guards the members below; the worker waits on it when the look-ahead is reached
+  std::vector<Frame>      mFrames;            ///< The ring buffer, its size is the capacity
+  std::thread             mWorker;            ///< The worker thread
+  Dali::AnimatedImageLoading::StreamingStatistics mStatistics; ///< The frames counted since started
+  uint32_t                mFirstFrame;        ///< The position of the oldest buffered frame in mFrames
+  uint32_t                mFrameCount;        ///< The number of frames of the animated image
+  uint32_t                mNextFrame;         ///< The index of the next frame to decode
+  uint32_t                mDecodingFrame;     ///< The index of the frame being decoded by the worker
+  uint32_t                mGeneration;        ///< Incremented on every seek so the frame being decoded before is discarded
+  uint32_t                mBufferedTime;      ///< How long the buffered frames last, in milliseconds
+  uint32_t                mAverageDecodeTime; ///< The moving average of the decoding time of a frame, in microseconds
+  bool                    mIsDecoding;        ///< Whether the worker is decoding mDecodingFrame
+  bool                    mTerminate;         ///< Whether the worker thread should stop
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ANIMATED_IMAGE_STREAMING_H
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/async-image-encoder.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/singleton-service.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/signals/callback.h>
+#include <chrono>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gEncoderLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_ASYNC_IMAGE_ENCODER" );
+#endif
+
+} // unnamed namespace
+
+AsyncImageEncoder* AsyncImageEncoder::Get()
+{
+  AsyncImageEncoder* encoder = nullptr;
+
+  Dali::SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( AsyncImageEncoder ) );
+    if( handle )
+    {
+      encoder = dynamic_cast< AsyncImageEncoder* >( handle.GetObjectPtr() );
+    }
+    else
+    {
+      // The service keeps the encoder until the adaptor is destroyed
+      encoder = new AsyncImageEncoder();
+      service.Register( typeid( AsyncImageEncoder ), Dali::BaseHandle( encoder ) );
+    }
+  }
+
+  return encoder;
+}
+
+AsyncImageEncoder::AsyncImageEncoder()
+: mConditionalWait(),
+  mPendingTasks(),
+  mCompletedTasks(),
+  mEventThreadCallback( new EventThreadCallback( MakeCallback( this, &AsyncImageEncoder::ProcessCompletedTasks ) ) ),
+  mWorker(),
+  mTerminate( false )
+{
+  mWorker = std::thread( &AsyncImageEncoder::Run, this );
+}
+
+AsyncImageEncoder::~AsyncImageEncoder()
+{
+  std::deque<Task> pendingTasks;
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    pendingTasks.swap( mPendingTasks );
+    mConditionalWait.Notify( lock );
+  }
+
+  mWorker.join();
+
+  // The requesters hold themselves until their file completes.
+  ProcessCompletedTasks();
+  for( auto&& task : pendingTasks )
+  {
+    if( task.completedFunction )
+    {
+      task.completedFunction( false );
+    }
+  }
+}
+
+void AsyncImageEncoder::Encode( std::vector<uint8_t>&& pixels, uint32_t width, uint32_t height, Pixel::Format pixelFormat,
+                                const std::string& path, const EncodingOptions& options, CompletedFunction completedFunction )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mPendingTasks.push_back( Task{ std::move( pixels ), width, height, pixelFormat, path, options, std::move( completedFunction ) } );
+  mConditionalWait.Notify( lock );
+}
+
+void AsyncImageEncoder::Run()
+{
+  while( true )
+  {
+    Task task;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      while( !mTerminate && mPendingTasks.empty() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      if( mTerminate )
+      {
+        break;
+      }
+
+      task = std::move( mPendingTasks.front() );
+      mPendingTasks.pop_front();
+    }
+
+    // Encode without the lock so the event thread can carry on requesting files.
+    const auto startTime = std::chrono::steady_clock::now();
+    const bool success = !task.pixels.empty() &&
+                         Dali::EncodeToFile( task.pixels.data(), task.path, task.pixelFormat, task.width, task.height, task.options );
+    DALI_LOG_INFO( gEncoderLogFilter, Debug::General, "Encoded %s (%ux%u) in %lld ms, %s\n",
+                   task.path.c_str(), task.width, task.height,
+                   static_cast<long long>( std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - startTime ).count() ),
+                   success ? "succeeded" : "failed" );
+
+    // The pixels are released on this thread, not on the event thread.
+    std::vector<uint8_t>().swap( task.pixels );
+
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mCompletedTasks.push_back( CompletedTask{ std::move( task.completedFunction ), success } );
+    mEventThreadCallback->Trigger();
+  }
+}
+
+void AsyncImageEncoder::ProcessCompletedTasks()
+{
+  while( true )
+  {
+    CompletedTask task;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      if( mCompletedTasks.empty() )
+      {
+        break;
+      }
+      task = std::move( mCompletedTasks.front() );
+      mCompletedTasks.pop_front();
+    }
+
+    if( task.completedFunction )
+    {
+      task.completedFunction( task.success );
+    }
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
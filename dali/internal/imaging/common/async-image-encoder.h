@@ -0,0 +1,150 @@
+#ifndef DALI_INTERNAL_ADAPTOR_ASYNC_IMAGE_ENCODER_H
+#define DALI_INTERNAL_ADAPTOR_ASYNC_IMAGE_ENCODER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/object/base-object.h>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Encodes pixels to PNG or JPEG files on a worker thread, so the event thread only pays for handing
+ * the pixels over.
+ *
+ * The files are written atomically with Dali::EncodeToFile( ..., const EncodingOptions& ), in the order they
+ * were requested, and the completion of each one is reported on the event thread.
+ *
+ * There is one encoder per adaptor, registered in its singleton service, so it is destroyed with the adaptor
+ * whose main loop reports the completions.
+ */
+class AsyncImageEncoder : public Dali::BaseObject
+{
+public:
+
+  /**
+   * @brief Called on the event thread when a file has been written or has failed.
+   *
+   * @param[in] success Whether the file was written
+   */
+  typedef std::function<void( bool success )> CompletedFunction;
+
+  /**
+   * @brief Retrieves the encoder of the adaptor, which is created by the first call. Must be called on the event thread.
+   *
+   * @return The encoder, or nullptr if there is no adaptor.
+   */
+  static AsyncImageEncoder* Get();
+
+  /**
+   * @brief Requests the encoding of pixels to a file.
+   *
+   * @param[in] pixels The pixels, moved to the worker thread
+   * @param[in] width The width of the image
+   * @param[in] height The height of the image
+   * @param[in] pixelFormat The format of the pixels
+   * @param[in] path The path of the file, whose suffix gives the file format
+   * @param[in] options The encoding settings
+   * @param[in] completedFunction Called on the event thread once the file has been written
+   */
+  void Encode( std::vector<uint8_t>&& pixels, uint32_t width, uint32_t height, Pixel::Format pixelFormat,
+               const std::string& path, const EncodingOptions& options, CompletedFunction completedFunction );
+
+private:
+
+  /**
+   * @brief Constructor. Must be called on the event thread.
+   */
+  AsyncImageEncoder();
+
+  /**
+   * @brief Destructor. Waits for the file being encoded; the pending files are dropped and reported as failed,
+   * so every requester is released.
+   */
+  ~AsyncImageEncoder() override;
+
+  // Undefined
+  AsyncImageEncoder( const AsyncImageEncoder& ) = delete;
+  AsyncImageEncoder& operator=( const AsyncImageEncoder& ) = delete;
+
+  /**
+   * @brief The loop of the worker thread.
+   */
+  void Run();
+
+  /**
+   * @brief Called on the event thread to call the functions of the completed tasks.
+   */
+  void ProcessCompletedTasks();
+
+  /**
+   * @brief A file to encode.
+   */
+  struct Task
+  {
+    std::vector<uint8_t> pixels;                     ///< The pixels
+    uint32_t             width{0u};                  ///< The width of the image
+    uint32_t             height{0u};                 ///< The height of the image
+    Pixel::Format        pixelFormat{Pixel::INVALID}; ///< The format of the pixels
+    std::string          path;                       ///< The path of the file
+    EncodingOptions      options;                    ///< The encoding settings
+    CompletedFunction    completedFunction;          ///< Called once the file has been written
+  };
+
+  /**
+   * @brief An encoded file waiting for its function to be called.
+   */
+  struct CompletedTask
+  {
+    CompletedFunction completedFunction; ///< The function to call
+    bool              success{false};    ///< Whether the file was written
+  };
+
+  ConditionalWait                      mConditionalWait;     ///< Guards the tasks; the worker waits on it for requests
+  std::deque<Task>                     mPendingTasks;        ///< The files waiting to be encoded
+  std::deque<CompletedTask>            mCompletedTasks;      ///< The files encoded, waiting for their function to be called
+  std::unique_ptr<EventThreadCallback> mEventThreadCallback; ///< Wakes up the event thread when files are written
+  std::thread                          mWorker;              ///< The worker thread
+  bool                                 mTerminate;           ///< Whether the worker thread should stop
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_ASYNC_IMAGE_ENCODER_H
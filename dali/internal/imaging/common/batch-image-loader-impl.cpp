@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/batch-image-loader-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/signals/callback.h>
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+const uint32_t DEFAULT_MAXIMUM_THREADS = 4u;
+
+/**
+ * @brief Reads the default number of worker threads from the environment, once.
+ */
+uint32_t GetDefaultThreadCount()
+{
+  static const uint32_t defaultThreadCount = []()
+  {
+    const char* environmentValue = EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_IMAGE_LOADING_THREADS );
+    if( environmentValue )
+    {
+      return static_cast< uint32_t >( std::max( 1, std::atoi( environmentValue ) ) );
+    }
+    return std::max( 1u, std::min( std::thread::hardware_concurrency(), DEFAULT_MAXIMUM_THREADS ) );
+  }();
+  return defaultThreadCount;
+}
+
+bool IsRemoteUrl( const std::string& url )
+{
+  return ( url.compare( 0u, 7u, "http://" ) == 0 ) || ( url.compare( 0u, 8u, "https://" ) == 0 );
+}
+
+} // unnamed namespace
+
+BatchImageLoaderPtr BatchImageLoader::New( uint32_t numberOfThreads )
+{
+  return BatchImageLoaderPtr( new BatchImageLoader( numberOfThreads > 0u ? numberOfThreads : GetDefaultThreadCount() ) );
+}
+
+BatchImageLoader::BatchImageLoader( uint32_t numberOfThreads )
+: mLoadCompletedSignal(),
+  mConditionalWait(),
+  mPendingTasks(),
+  mRunningTasks(),
+  mCompletedTasks(),
+  mEventThreadCallback( new EventThreadCallback( MakeCallback( this, &BatchImageLoader::OnCompletedTasksTriggered ) ) ),
+  mWorkers(),
+  mLoadIdCounter( 0u ),
+  mTerminate( false )
+{
+  mWorkers.reserve( numberOfThreads );
+  for( uint32_t i = 0u; i < numberOfThreads; ++i )
+  {
+    mWorkers.emplace_back( &BatchImageLoader::Run, this );
+  }
+}
+
+BatchImageLoader::~BatchImageLoader()
+{
+  {
+    // The workers discard the images they are decoding as the requests are no longer running,
+    // so nothing triggers the event thread callback once they are told to stop.
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mPendingTasks.clear();
+    mRunningTasks.clear();
+    mCompletedTasks.clear();
+    mConditionalWait.Notify( lock );
+  }
+
+  for( auto&& worker : mWorkers )
+  {
+    worker.join();
+  }
+}
+
+uint32_t BatchImageLoader::Load( const Dali::BatchImageLoader::Request& request )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  const uint32_t loadId = AddTask( request );
+  mConditionalWait.Notify( lock );
+  return loadId;
+}
+
+std::vector< uint32_t > BatchImageLoader::Load( const std::vector< Dali::BatchImageLoader::Request >& requests )
+{
+  std::vector< uint32_t > loadIds;
+  loadIds.reserve( requests.size() );
+
+  // Add all the requests before waking up the workers so the priorities are respected from the first one.
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  for( auto&& request : requests )
+  {
+    loadIds.push_back( AddTask( request ) );
+  }
+  mConditionalWait.Notify( lock );
+  return loadIds;
+}
+
+bool BatchImageLoader::SetPriority( uint32_t loadId, int32_t priority )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  auto iter = std::find_if( mPendingTasks.begin(), mPendingTasks.end(), [loadId]( const Task& task ) { return task.id == loadId; } );
+  if( iter != mPendingTasks.end() )
+  {
+    iter->request.priority = priority;
+    return true;
+  }
+  return false;
+}
+
+bool BatchImageLoader::Cancel( uint32_t loadId )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  auto pendingIter = std::find_if( mPendingTasks.begin(), mPendingTasks.end(), [loadId]( const Task& task ) { return task.id == loadId; } );
+  if( pendingIter != mPendingTasks.end() )
+  {
+    mPendingTasks.erase( pendingIter );
+    return true;
+  }
+
+  // The worker discards the image when it finds the request is no longer running.
+  auto runningIter = std::find( mRunningTasks.begin(), mRunningTasks.end(), loadId );
+  if( runningIter != mRunningTasks.end() )
+  {
+    mRunningTasks.erase( runningIter );
+    return true;
+  }
+
+  auto completedIter = std::find_if( mCompletedTasks.begin(), mCompletedTasks.end(), [loadId]( const CompletedTask& task ) { return task.id == loadId; } );
+  if( completedIter != mCompletedTasks.end() )
+  {
+    mCompletedTasks.erase( completedIter );
+    return true;
+  }
+
+  return false;
+}
+
+void BatchImageLoader::CancelAll()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mPendingTasks.clear();
+  mRunningTasks.clear();
+  mCompletedTasks.clear();
+}
+
+uint32_t BatchImageLoader::AddTask( const Dali::BatchImageLoader::Request& request )
+{
+  const uint32_t loadId = ++mLoadIdCounter;
+  mPendingTasks.push_back( Task{ loadId, request } );
+  return loadId;
+}
+
+void BatchImageLoader::Run()
+{
+  while( true )
+  {
+    Task task{ 0u, Dali::BatchImageLoader::Request( std::string() ) };
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      while( !mTerminate && mPendingTasks.empty() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      if( mTerminate )
+      {
+        break;
+      }
+
+      // The ids increase, so among the highest priority the first request found is the oldest one.
+      auto iter = std::max_element( mPendingTasks.begin(), mPendingTasks.end(), []( const Task& lhs, const Task& rhs )
+                                    {
+                                      return lhs.request.priority < rhs.request.priority;
+                                    } );
+      task = std::move( *iter );
+      mPendingTasks.erase( iter );
+      mRunningTasks.push_back( task.id );
+    }
+
+    // Decode without the lock so the other workers and the event thread can carry on.
+    Devel::PixelBuffer pixelBuffer;
+    const Dali::BatchImageLoader::Request& request = task.request;
+    if( IsRemoteUrl( request.url ) )
+    {
+      pixelBuffer = Dali::DownloadImageSynchronously( request.url, request.size, request.fittingMode, request.samplingMode, request.orientationCorrection );
+    }
+    else
+    {
+      pixelBuffer = Dali::LoadImageFromFile( request.url, request.size, request.fittingMode, request.samplingMode, request.orientationCorrection );
+    }
+
+    // The request isn't running any more if it was cancelled or the loader is being destroyed.
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    auto runningIter = std::find( mRunningTasks.begin(), mRunningTasks.end(), task.id );
+    if( runningIter != mRunningTasks.end() )
+    {
+      mRunningTasks.erase( runningIter );
+      mCompletedTasks.push_back( CompletedTask{ task.id, std::move( pixelBuffer ) } );
+      mEventThreadCallback->Trigger();
+    }
+  }
+}
+
+void BatchImageLoader::ProcessCompletedTasks()
+{
+  // Keeps this object alive if a callback releases the last handle.
+  Reference();
+
+  while( true )
+  {
+    CompletedTask task = CompletedTask();
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      if( mCompletedTasks.empty() )
+      {
+        break;
+      }
+      task = std::move( mCompletedTasks.front() );
+      mCompletedTasks.pop_front();
+    }
+
+    mLoadCompletedSignal.Emit( task.id, task.pixelBuffer );
+  }
+
+  Unreference();
+}
+
+void BatchImageLoader::OnCompletedTasksTriggered()
+{
+  // Keeps this object, and so the trigger which is calling this method, alive until the trigger has returned.
+  Reference();
+
+  ProcessCompletedTasks();
+
+  if( ReferenceCount() > 1 )
+  {
+    Unreference();
+    return;
+  }
+
+  if( Dali::Adaptor::IsAvailable() )
+  {
+    CallbackBase* callback = MakeCallback( this, &BatchImageLoader::ReleaseAfterCompletedTasks );
+    if( Internal::Adaptor::Adaptor::GetImplementation( Dali::Adaptor::Get() ).AddIdle( callback, false, true ) )
+    {
+      return;
+    }
+    delete callback;
+  }
+
+  DALI_LOG_ERROR( "BatchImageLoader released in its signal without an adaptor; it is kept alive\n" );
+}
+
+void BatchImageLoader::ReleaseAfterCompletedTasks()
+{
+  Unreference();
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
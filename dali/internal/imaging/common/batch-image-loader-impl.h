@@ -0,0 +1,205 @@
+#ifndef DALI_INTERNAL_BATCH_IMAGE_LOADER_IMPL_H
+#define DALI_INTERNAL_BATCH_IMAGE_LOADER_IMPL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/object/base-object.h>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/batch-image-loader.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class BatchImageLoader;
+typedef IntrusivePtr<BatchImageLoader> BatchImageLoaderPtr;
+
+/**
+ * Decodes image requests on a pool of worker threads and emits the results on the event thread.
+ *
+ * The pending, running and completed requests are guarded by mConditionalWait, which the workers wait on
+ * when there is nothing to decode. The destructor tells the workers to stop and joins them, waiting for the
+ * images being decoded, which are discarded.
+ */
+class BatchImageLoader : public BaseObject
+{
+public:
+
+  /**
+   * @copydoc Dali::BatchImageLoader::New( uint32_t )
+   */
+  static BatchImageLoaderPtr New( uint32_t numberOfThreads );
+
+  /**
+   * @copydoc Dali::BatchImageLoader::Load( const Request& )
+   */
+  uint32_t Load( const Dali::BatchImageLoader::Request& request );
+
+  /**
+   * @copydoc Dali::BatchImageLoader::Load( const std::vector<Request>& )
+   */
+  std::vector< uint32_t > Load( const std::vector< Dali::BatchImageLoader::Request >& requests );
+
+  /**
+   * @copydoc Dali::BatchImageLoader::SetPriority()
+   */
+  bool SetPriority( uint32_t loadId, int32_t priority );
+
+  /**
+   * @copydoc Dali::BatchImageLoader::Cancel()
+   */
+  bool Cancel( uint32_t loadId );
+
+  /**
+   * @copydoc Dali::BatchImageLoader::CancelAll()
+   */
+  void CancelAll();
+
+  /**
+   * @copydoc Dali::BatchImageLoader::LoadCompletedSignal()
+   */
+  Dali::BatchImageLoader::LoadCompletedSignalType& LoadCompletedSignal()
+  {
+    return mLoadCompletedSignal;
+  }
+
+  /**
+   * @brief Called on the event thread to emit the signal for the completed requests.
+   *
+   * If a callback releases the last handle, the loader is destroyed when this returns.
+   * @note This must not be called from the trigger of the loader; the trigger calls OnCompletedTasksTriggered().
+   */
+  void ProcessCompletedTasks();
+
+private:
+
+  /**
+   * @brief Constructor. Starts the worker threads.
+   *
+   * @param[in] numberOfThreads The number of worker threads, at least one.
+   */
+  BatchImageLoader( uint32_t numberOfThreads );
+
+  /**
+   * @brief Destructor. Stops and joins the worker threads, discarding the images being decoded.
+   */
+  ~BatchImageLoader() override;
+
+  // Undefined
+  BatchImageLoader( const BatchImageLoader& ) = delete;
+  BatchImageLoader& operator=( const BatchImageLoader& ) = delete;
+
+  /**
+   * @brief Called by the trigger to emit the signal for the completed requests.
+   *
+   * Destroying the loader here would destroy the trigger which is still running, so if a callback releases
+   * the last handle, the loader is released from an idle callback once the trigger has returned. Without an
+   * adaptor nothing can run after the trigger, so the last reference is kept and the loader is not destroyed.
+   */
+  void OnCompletedTasksTriggered();
+
+  /**
+   * @brief Releases the reference kept by OnCompletedTasksTriggered() when it was the last one, from an idle callback.
+   */
+  void ReleaseAfterCompletedTasks();
+
+  /**
+   * @brief Adds a request to the pending ones. Called with the lock held.
+   *
+   * @return The id of the request
+   */
+  uint32_t AddTask( const Dali::BatchImageLoader::Request& request );
+
+private:
+
+  /**
+   * @brief A request waiting to be decoded.
+   */
+  struct Task
+  {
+    uint32_t                        id;      ///< The id of the request
+    Dali::BatchImageLoader::Request request; ///< The image to load
+  };
+
+  /**
+   * @brief A decoded request waiting for its signal to be emitted.
+   */
+  struct CompletedTask
+  {
+    uint32_t           id;          ///< The id of the request
+    Devel::PixelBuffer pixelBuffer; ///< The loaded image, or an empty handle if loading failed
+  };
+
+  /**
+   * @brief The loop of a worker thread. Decodes the pending request with the highest priority until stopped.
+   */
+  void Run();
+
+  Dali::BatchImageLoader::LoadCompletedSignalType mLoadCompletedSignal; ///< Emitted when an image has been loaded
+
+  ConditionalWait                        mConditionalWait;     ///< Guards the tasks and mTerminate; the workers wait on it for requests
+  std::vector< Task >                    mPendingTasks;        ///< The requests waiting to be decoded
+  std::vector< uint32_t >                mRunningTasks;        ///< The ids of the requests being decoded
+  std::deque< CompletedTask >            mCompletedTasks;      ///< The decoded requests waiting to be emitted
+  std::unique_ptr< EventThreadCallback > mEventThreadCallback; ///< Wakes up the event thread when requests complete
+  std::vector< std::thread >             mWorkers;             ///< The worker threads
+  uint32_t                               mLoadIdCounter;       ///< The id of the last request
+  bool                                   mTerminate;           ///< Whether the worker threads should stop
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+// Helpers for api forwarding methods
+
+inline Internal::Adaptor::BatchImageLoader& GetImplementation( Dali::BatchImageLoader& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "BatchImageLoader handle is empty" );
+
+  BaseObject& object = handle.GetBaseObject();
+
+  return static_cast< Internal::Adaptor::BatchImageLoader& >( object );
+}
+
+inline const Internal::Adaptor::BatchImageLoader& GetImplementation( const Dali::BatchImageLoader& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "BatchImageLoader handle is empty" );
+
+  const BaseObject& object = handle.GetBaseObject();
+
+  return static_cast< const Internal::Adaptor::BatchImageLoader& >( object );
+}
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_BATCH_IMAGE_LOADER_IMPL_H
@@ -14,13 +14,22 @@
  * limitations under the License.
  */
 
+// CLASS HEADER
+#include <dali/internal/imaging/common/gaussian-blur.h>
+
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/common/vector-wrapper.h>
 
 // INTERNAL INCLUDES
-#include <dali/internal/imaging/common/gaussian-blur.h>
+#include <dali/internal/imaging/common/image-processing-thread-pool.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/simd-pixel.h>
 
 namespace Dali
 {
@@ -31,101 +40,326 @@ namespace Internal
 namespace Adaptor
 {
 
+namespace
+{
+const unsigned int WEIGHT_PRECISION_BITS = 14u;                            ///< Fractional bits of the fixed point weights.
+const uint32_t WEIGHT_ONE = 1u << WEIGHT_PRECISION_BITS;                   ///< The fixed point representation of 1.0.
+const uint32_t WEIGHT_ROUNDING = WEIGHT_ONE >> 1u;                         ///< Added before shifting the accumulated channels back down.
+const unsigned int BOX_PRECISION_BITS = 22u;                               ///< Fractional bits of the reciprocal used to average a box.
+const unsigned int BOX_PASS_COUNT = 3u;                                    ///< Three successive box filters are within 3% of a true Gaussian.
+const int BOX_BLUR_MIN_RADIUS = 16;                                        ///< From this radius on, the sliding window approximation is used.
+const unsigned int MAXIMUM_CACHED_KERNELS = 8u;                            ///< The number of most recently used weight tables kept around.
 
+/**
+ * @brief The fixed point weights of a one dimensional Gaussian kernel.
+ */
+struct GaussianKernel
+{
+  float blurRadius;              ///< The radius the kernel was computed for, used as the cache key.
+  int radius;                    ///< The number of taps either side of the centre.
+  std::vector< uint16_t > weights; ///< 2 * radius + 1 weights which add up to WEIGHT_ONE.
+};
 
-void ConvoluteAndTranspose( unsigned char* inBuffer,
-                            unsigned char* outBuffer,
-                            const unsigned int bufferWidth,
-                            const unsigned int bufferHeight,
-                            const float blurRadius )
+typedef std::shared_ptr< const GaussianKernel > GaussianKernelPtr;
+
+/**
+ * @brief Computes the weights using the same equations as the original floating point implementation.
+ */
+GaussianKernelPtr CreateKernel( float blurRadius )
 {
-  // Calculate the weights for gaussian blur
-  int radius = static_cast<int>( std::ceil( blurRadius ) );
-  int rows = radius * 2 + 1;
+  std::shared_ptr< GaussianKernel > kernel( new GaussianKernel );
+  kernel->blurRadius = blurRadius;
+  kernel->radius = static_cast<int>( std::ceil( blurRadius ) );
 
-  float sigma = ( blurRadius < Math::MACHINE_EPSILON_1 ) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
+  const int rows = kernel->radius * 2 + 1;
+  kernel->weights.resize( rows );
+
+  if( blurRadius < Math::MACHINE_EPSILON_1 )
+  {
+    kernel->radius = 0;
+    kernel->weights.assign( 1u, static_cast<uint16_t>( WEIGHT_ONE ) );
+    return kernel;
+  }
+
+  float sigma = blurRadius * 0.4f + 0.6f; // The same equation used by Android
   float sigma22 = 2.0f * sigma * sigma;
-  float sqrtSigmaPi2 = std::sqrt( 2.0f * Math::PI ) * sigma;
-  float radius2 = radius * radius;
   float normalizeFactor = 0.0f;
 
-  float* weightMatrix = new float[rows];
-  int index = 0;
+  std::vector< float > weights( rows );
+  for( int row = -kernel->radius; row <= kernel->radius; ++row )
+  {
+    weights[row + kernel->radius] = std::exp( -static_cast<float>( row * row ) / sigma22 );
+    normalizeFactor += weights[row + kernel->radius];
+  }
 
-  for ( int row = -radius; row <= radius; row++ )
+  // Quantise the weights, then give the rounding error to the centre tap so that a flat
+  // image stays exactly the same after blurring.
+  int total = 0;
+  for( int i = 0; i < rows; ++i )
   {
-    float distance = row * row;
-    if ( distance > radius2 )
-    {
-      weightMatrix[index] = 0.0f;
-    }
-    else
+    kernel->weights[i] = static_cast<uint16_t>( std::lround( weights[i] / normalizeFactor * WEIGHT_ONE ) );
+    total += kernel->weights[i];
+  }
+  kernel->weights[kernel->radius] = static_cast<uint16_t>( kernel->weights[kernel->radius] + static_cast<int>( WEIGHT_ONE ) - total );
+
+  return kernel;
+}
+
+/**
+ * @brief Retrieves the weights for the given radius, computing them only if they are not cached.
+ *
+ * Blurs are usually applied with a handful of different radii, so a small most recently used list is enough.
+ */
+GaussianKernelPtr GetKernel( float blurRadius )
+{
+  static Dali::Mutex cacheMutex;
+  static std::vector< GaussianKernelPtr > cache;
+
+  Dali::Mutex::ScopedLock lock( cacheMutex );
+
+  for( auto iter = cache.begin(), endIter = cache.end(); iter != endIter; ++iter )
+  {
+    if( ( *iter )->blurRadius == blurRadius )
     {
-      weightMatrix[index] = static_cast<float>( std::exp( -( distance ) / sigma22 ) / sqrtSigmaPi2 );
+      GaussianKernelPtr kernel = *iter;
+      cache.erase( iter );
+      cache.insert( cache.begin(), kernel );
+      return kernel;
     }
-    normalizeFactor += weightMatrix[index];
-    index++;
   }
 
-  for ( int i = 0; i < rows; i++ )
+  GaussianKernelPtr kernel = CreateKernel( blurRadius );
+  cache.insert( cache.begin(), kernel );
+  if( cache.size() > MAXIMUM_CACHED_KERNELS )
   {
-    weightMatrix[i] /= normalizeFactor;
+    cache.pop_back();
   }
+  return kernel;
+}
 
-  // Perform the convolution and transposition using the weights
-  int columns = rows;
-  int columns2 = columns / 2;
-  for ( unsigned int y = 0; y < bufferHeight; y++ )
+/**
+ * @brief Convolves rows [startRow, endRow) with the kernel, writing each output row as a column.
+ *
+ * If given, prepareRow is called on each row just before it is convolved, while the row is in the cache.
+ */
+void ConvoluteRowsAndTranspose( const GaussianKernel& kernel,
+                                uint8_t* inBuffer,
+                                uint8_t* outBuffer,
+                                unsigned int bufferWidth,
+                                unsigned int bufferHeight,
+                                unsigned int startRow,
+                                unsigned int endRow,
+                                const PrepareRowFunction* prepareRow )
+{
+  const int radius = kernel.radius;
+  const int width = static_cast<int>( bufferWidth );
+  const int lastColumn = width - 1;
+  const uint16_t* weights = kernel.weights.data();
+  const int taps = static_cast<int>( kernel.weights.size() );
+  const unsigned int outStride = bufferHeight * 4u;
+
+  // Columns in [interiorStart, interiorEnd) don't need their taps clamped to the edges of the row.
+  const int interiorStart = std::min( radius, width );
+  const int interiorEnd = std::max( interiorStart, width - radius );
+
+  for( unsigned int y = startRow; y < endRow; ++y )
   {
-    unsigned int targetPixelIndex = y;
-    unsigned int ioffset = y * bufferWidth;
-    for ( unsigned int x = 0; x < bufferWidth; x++ )
+    uint8_t* inRow = inBuffer + y * bufferWidth * 4u;
+    uint8_t* outPixel = outBuffer + y * 4u;
+    if( prepareRow )
+    {
+      ( *prepareRow )( inRow, y );
+    }
+
+    for( int x = 0; x < width; ++x, outPixel += outStride )
     {
-      float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
-      int weightColumnOffset = columns2;
-      for ( int column = -columns2; column <= columns2; column++ )
+      SimdPixel::Accumulator accumulator = SimdPixel::Splat( WEIGHT_ROUNDING );
+
+      if( x >= interiorStart && x < interiorEnd )
       {
-        float weight = weightMatrix[weightColumnOffset + column];
-        if ( fabsf( weight ) > Math::MACHINE_EPSILON_1 )
+        const uint8_t* inPixel = inRow + ( x - radius ) * 4;
+        for( int tap = 0; tap < taps; ++tap, inPixel += 4 )
         {
-          int ix = x + column;
-          ix = std::max( 0, std::min( ix, static_cast<int>( bufferWidth - 1 ) ) );
-          unsigned int sourcePixelIndex = ioffset + ix;
-          r += weight * inBuffer[sourcePixelIndex*4];
-          g += weight * inBuffer[sourcePixelIndex*4+1];
-          b += weight * inBuffer[sourcePixelIndex*4+2];
-          a += weight * inBuffer[sourcePixelIndex*4+3];
+          SimdPixel::MultiplyAdd( accumulator, SimdPixel::LoadPixel( inPixel ), weights[tap] );
         }
       }
+      else
+      {
+        for( int tap = 0; tap < taps; ++tap )
+        {
+          const int ix = std::max( 0, std::min( x + tap - radius, lastColumn ) );
+          SimdPixel::MultiplyAdd( accumulator, SimdPixel::LoadPixel( inRow + ix * 4 ), weights[tap] );
+        }
+      }
+
+      SimdPixel::StorePixel( outPixel, SimdPixel::Pack< WEIGHT_PRECISION_BITS >( accumulator ) );
+    }
+  }
+}
+
+/**
+ * @brief Calculates the radii of the box filters which, applied in turn, best approximate a Gaussian.
+ *
+ * @see "Fast Almost-Gaussian Filtering", W. Jarosz, and the widely used "boxes for Gauss" derivation.
+ */
+void CalculateBoxRadii( float blurRadius, int ( &boxRadii )[BOX_PASS_COUNT] )
+{
+  const float sigma = blurRadius * 0.4f + 0.6f;
+  const float passes = static_cast<float>( BOX_PASS_COUNT );
+
+  int lowerWidth = static_cast<int>( std::floor( std::sqrt( 12.0f * sigma * sigma / passes + 1.0f ) ) );
+  if( lowerWidth % 2 == 0 )
+  {
+    --lowerWidth;
+  }
+  const int upperWidth = lowerWidth + 2;
+  const float idealLowerCount = ( 12.0f * sigma * sigma - passes * lowerWidth * lowerWidth - 4.0f * passes * lowerWidth - 3.0f * passes ) / ( -4.0f * lowerWidth - 4.0f );
+  const int lowerCount = static_cast<int>( std::round( idealLowerCount ) );
+
+  for( int pass = 0; pass < static_cast<int>( BOX_PASS_COUNT ); ++pass )
+  {
+    boxRadii[pass] = ( ( pass < lowerCount ? lowerWidth : upperWidth ) - 1 ) / 2;
+  }
+}
+
+/**
+ * @brief Averages every pixel of a row with its neighbours using a running sum.
+ *
+ * @param[in] in The source row
+ * @param[out] out Where the result is written
+ * @param[in] width The number of pixels in the row
+ * @param[in] outStride The distance in bytes between consecutive output pixels
+ * @param[in] radius The number of pixels either side of the centre which are averaged
+ */
+void BoxBlurRow( const uint8_t* in, uint8_t* out, int width, unsigned int outStride, int radius )
+{
+  const int lastColumn = width - 1;
+  const uint32_t boxSize = static_cast<uint32_t>( radius * 2 + 1 );
+  const uint32_t reciprocal = ( ( 1u << BOX_PRECISION_BITS ) + boxSize / 2u ) / boxSize;
+  const uint32_t rounding = 1u << ( BOX_PRECISION_BITS - 1u );
+
+  uint32_t sum[4];
+  for( int channel = 0; channel < 4; ++channel )
+  {
+    sum[channel] = in[channel] * static_cast<uint32_t>( radius + 1 );
+    for( int i = 1; i <= radius; ++i )
+    {
+      sum[channel] += in[std::min( i, lastColumn ) * 4 + channel];
+    }
+  }
 
-      outBuffer[targetPixelIndex*4] = std::max( 0, std::min( static_cast<int>( r + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+1] = std::max( 0, std::min( static_cast<int>( g + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+2] = std::max( 0, std::min( static_cast<int>( b + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+3] = std::max( 0, std::min( static_cast<int>( a + 0.5f ), 255 ) );
+  for( int x = 0; x < width; ++x, out += outStride )
+  {
+    const uint8_t* incoming = in + std::min( x + radius + 1, lastColumn ) * 4;
+    const uint8_t* outgoing = in + std::max( x - radius, 0 ) * 4;
+    for( int channel = 0; channel < 4; ++channel )
+    {
+      out[channel] = static_cast<uint8_t>( std::min( ( sum[channel] * reciprocal + rounding ) >> BOX_PRECISION_BITS, 255u ) );
+      sum[channel] += incoming[channel];
+      sum[channel] -= outgoing[channel];
+    }
+  }
+}
+
+/**
+ * @brief Applies the box filters to rows [startRow, endRow), writing each output row as a column.
+ *
+ * If given, prepareRow is called on each row just before it is filtered, while the row is in the cache.
+ */
+void BoxBlurRowsAndTranspose( const int ( &boxRadii )[BOX_PASS_COUNT],
+                              uint8_t* inBuffer,
+                              uint8_t* outBuffer,
+                              unsigned int bufferWidth,
+                              unsigned int bufferHeight,
+                              unsigned int startRow,
+                              unsigned int endRow,
+                              const PrepareRowFunction* prepareRow )
+{
+  const int width = static_cast<int>( bufferWidth );
+  std::vector< uint8_t > scratch( bufferWidth * 4u * 2u );
+  uint8_t* rows[2] = { scratch.data(), scratch.data() + bufferWidth * 4u };
 
-      targetPixelIndex += bufferHeight;
+  for( unsigned int y = startRow; y < endRow; ++y )
+  {
+    const uint8_t* in = inBuffer + y * bufferWidth * 4u;
+    if( prepareRow )
+    {
+      ( *prepareRow )( inBuffer + y * bufferWidth * 4u, y );
+    }
+    for( unsigned int pass = 0; pass + 1u < BOX_PASS_COUNT; ++pass )
+    {
+      BoxBlurRow( in, rows[pass % 2u], width, 4u, boxRadii[pass] );
+      in = rows[pass % 2u];
     }
+    BoxBlurRow( in, outBuffer + y * 4u, width, bufferHeight * 4u, boxRadii[BOX_PASS_COUNT - 1u] );
+  }
+}
+
+/**
+ * @brief Blurs horizontally and transposes, choosing the exact or the approximated kernel from the radius.
+ */
+void BlurAndTranspose( uint8_t* inBuffer,
+                       uint8_t* outBuffer,
+                       unsigned int bufferWidth,
+                       unsigned int bufferHeight,
+                       float blurRadius,
+                       const PrepareRowFunction* prepareRow )
+{
+  if( static_cast<int>( std::ceil( blurRadius ) ) >= BOX_BLUR_MIN_RADIUS )
+  {
+    int boxRadii[BOX_PASS_COUNT];
+    CalculateBoxRadii( blurRadius, boxRadii );
+    ImageProcessingThreadPool::ProcessRowsInParallel( bufferWidth, bufferHeight, [&]( unsigned int startRow, unsigned int endRow )
+    {
+      BoxBlurRowsAndTranspose( boxRadii, inBuffer, outBuffer, bufferWidth, bufferHeight, startRow, endRow, prepareRow );
+    } );
+  }
+  else
+  {
+    GaussianKernelPtr kernel = GetKernel( blurRadius );
+    ImageProcessingThreadPool::ProcessRowsInParallel( bufferWidth, bufferHeight, [&]( unsigned int startRow, unsigned int endRow )
+    {
+      ConvoluteRowsAndTranspose( *kernel, inBuffer, outBuffer, bufferWidth, bufferHeight, startRow, endRow, prepareRow );
+    } );
   }
+}
 
-  delete [] weightMatrix;
+} // unnamed namespace
+
+void ConvoluteAndTranspose( unsigned char* inBuffer,
+                            unsigned char* outBuffer,
+                            const unsigned int bufferWidth,
+                            const unsigned int bufferHeight,
+                            const float blurRadius )
+{
+  GaussianKernelPtr kernel = GetKernel( blurRadius );
+  ImageProcessingThreadPool::ProcessRowsInParallel( bufferWidth, bufferHeight, [&]( unsigned int startRow, unsigned int endRow )
+  {
+    ConvoluteRowsAndTranspose( *kernel, inBuffer, outBuffer, bufferWidth, bufferHeight, startRow, endRow, nullptr );
+  } );
 }
 
 void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius )
+{
+  PerformGaussianBlurRGBA( buffer, blurRadius, PrepareRowFunction() );
+}
+
+void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius, const PrepareRowFunction& prepareRow )
 {
   unsigned int bufferWidth = buffer.GetWidth();
   unsigned int bufferHeight = buffer.GetHeight();
 
   // Create a temporary buffer for the two-pass blur
   PixelBufferPtr softShadowImageBuffer = PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
-  memcpy( softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), 4u * bufferWidth * bufferHeight );
 
   // We perform the blur first but write its output image buffer transposed, so that we
   // can just do it in two passes. The first pass blurs horizontally and transposes, the
   // second pass does the same, but as the image is now transposed, it's really doing a
   // vertical blur. The second transposition makes the image the right way up again. This
   // is much faster than doing a 2D convolution.
-  ConvoluteAndTranspose( buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, blurRadius );
-  ConvoluteAndTranspose( softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, blurRadius );
+  // The rows are prepared by the first pass, as it reads them in order.
+  BlurAndTranspose( buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, blurRadius, prepareRow ? &prepareRow : nullptr );
+  BlurAndTranspose( softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, blurRadius, nullptr );
 
   // On leaving scope, softShadowImageBuffer will get destroyed.
 }
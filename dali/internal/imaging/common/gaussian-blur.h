@@ -17,6 +17,11 @@
  * limitations under the License.
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+
+// INTERNAL INCLUDES
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 namespace Dali
@@ -28,9 +33,18 @@ namespace Internal
 namespace Adaptor
 {
 
+/**
+ * Called with a row of the buffer and its index just before the row is blurred, possibly on several threads at once.
+ * The row may be modified in place.
+ */
+typedef std::function< void( uint8_t*, unsigned int ) > PrepareRowFunction;
+
 /**
  * Perform a one dimension Gaussian blur convolution and write its output buffer transposed.
  *
+ * The weights are cached per radius and applied in fixed point. Large buffers are split into
+ * bands of rows which are convolved in parallel.
+ *
  * @param[in] inBuffer The input buffer with the source image
  * @param[in] outBuffer The output buffer with the Gaussian blur applied and transposed
  * @param[in] bufferWidth The width of the buffer
@@ -45,6 +59,9 @@ void ConvoluteAndTranspose( unsigned char* inBuffer, unsigned char* outBuffer, c
  * A Gaussian blur is generated by replacing each pixel’s color values with the average of the surrounding pixels’
  * colors. This region is a circle with the given radius. Thus, a bigger radius yields a blurrier image.
  *
+ * For large radii the Gaussian is approximated by three successive box filters, whose cost
+ * does not depend on the radius.
+ *
  * @note The pixel format of the buffer must be RGBA8888
  *
  * @param[in] buffer The buffer to apply the Gaussian blur to
@@ -52,6 +69,19 @@ void ConvoluteAndTranspose( unsigned char* inBuffer, unsigned char* outBuffer, c
  */
 void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius );
 
+/**
+ * Perform Gaussian blur on a buffer, preparing each row just before it is blurred.
+ *
+ * This lets per pixel operations be done while the row is in the cache, instead of in a separate pass over the buffer.
+ *
+ * @note The pixel format of the buffer must be RGBA8888
+ *
+ * @param[in] buffer The buffer to apply the Gaussian blur to
+ * @param[in] blurRadius The radius for Gaussian blur
+ * @param[in] prepareRow Called on each row of the buffer before it is blurred, may be empty
+ */
+void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius, const PrepareRowFunction& prepareRow );
+
 } //namespace Adaptor
 
 } //namespace Internal
@@ -27,10 +27,14 @@
 #include <unistd.h>
 #include <gif_lib.h>
 #include <cstring>
+#include <list>
+#include <vector>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/devel-api/threading/mutex.h>
 #include <dali/internal/imaging/common/file-download.h>
 #include <dali/internal/system/common/file-reader.h>
+#include <dali/internal/system/common/mapped-file.h>
 
 #define IMG_TOO_BIG( w, h )                                                        \
   ( ( static_cast<unsigned long long>(w) * static_cast<unsigned long long>(h) ) >= \
@@ -60,6 +64,12 @@ Debug::Filter *gGifLoadingLogFilter = Debug::Filter::New( Debug::NoLogging, fals
 const int IMG_MAX_SIZE = 65000;
 constexpr size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE  = 50 * 1024 * 1024;
 
+// The decoded frames are kept as palette indices, which are composed into full frames when loaded.
+constexpr size_t DEFAULT_STORED_FRAMES_MEMORY_BUDGET = 16 * 1024 * 1024;  ///< Default maximum bytes of palette indices kept for the frames.
+constexpr size_t DEFAULT_COMPOSED_FRAMES_MEMORY_BUDGET = 4 * 1024 * 1024; ///< Default maximum bytes of composed keyframes kept, at least one is kept.
+constexpr int KEYFRAME_INTERVAL = 16;                             ///< The composed frames are kept every KEYFRAME_INTERVAL frames.
+constexpr int PALETTE_SIZE = 256;
+
 #if GIFLIB_MAJOR < 5
 const int DISPOSE_BACKGROUND = 2;       /* Set area too background color */
 const int DISPOSE_PREVIOUS = 3;         /* Restore to previous content */
@@ -90,7 +100,10 @@ struct ImageFrame
 {
   ImageFrame()
   : index( 0 ),
-    data( nullptr ),
+    indices(),
+    palette(),
+    background( 0 ),
+    lastUsed( 0 ),
     info(),
     loaded( false )
   {
@@ -101,9 +114,18 @@ struct ImageFrame
   }
 
   int       index;
-  uint32_t  *data;     /* frame decoding data */
+  std::vector<uint8_t>  indices;  /* palette indices of the part of the frame inside the image */
+  std::vector<uint32_t> palette;  /* ABGR colors of the local color map, empty when the global one is used */
+  uint32_t  background;           /* ABGR background color, looked up in the frame's color map */
+  unsigned int lastUsed;          /* when the frame was last decoded or composed */
   FrameInfo  info;     /* special image type info */
-  bool loaded : 1;
+  bool loaded : 1;     /* whether the indices are decoded */
+};
+
+struct ComposedFrame
+{
+  int index;
+  std::vector<uint32_t> pixels;   /* the whole ABGR image */
 };
 
 struct GifAnimationData
@@ -113,7 +135,18 @@ struct GifAnimationData
     frameCount( 0 ),
     loopCount( 0 ),
     currentFrame( 0 ),
-    animated( false )
+    animated( false ),
+    globalPalette(),
+    composedFrames(),
+    canvas(),
+    preserved(),
+    canvasFrame( 0 ),
+    preservedFrame( 0 ),
+    storedBytes( 0 ),
+    composedBytes( 0 ),
+    storedBytesBudget( DEFAULT_STORED_FRAMES_MEMORY_BUDGET ),
+    composedBytesBudget( DEFAULT_COMPOSED_FRAMES_MEMORY_BUDGET ),
+    useCount( 0 )
   {
   }
 
@@ -122,6 +155,18 @@ struct GifAnimationData
   int loopCount;
   int currentFrame;
   bool animated;
+
+  std::vector<uint32_t> globalPalette;      /* ABGR colors of the global color map */
+  std::list<ComposedFrame> composedFrames;  /* composed keyframes, the most recently used first */
+  std::vector<uint32_t> canvas;             /* the last composed frame */
+  std::vector<uint32_t> preserved;          /* the composed frame restored after a DISPOSE_PREVIOUS frame */
+  int canvasFrame;                          /* index of the frame in canvas, 0 if none */
+  int preservedFrame;                       /* index of the frame in preserved, 0 if none */
+  size_t storedBytes;                       /* bytes used by the indices and palettes of the frames */
+  size_t composedBytes;                     /* bytes used by the composed keyframes */
+  size_t storedBytesBudget;                 /* maximum bytes of indices and palettes kept for the frames */
+  size_t composedBytesBudget;               /* maximum bytes of composed keyframes kept, at least one is kept */
+  unsigned int useCount;
 };
 
 struct LoaderInfo
@@ -142,8 +187,18 @@ struct LoaderInfo
     {
     }
 
+    /**
+     * @brief Retrieves the entire contents of the file.
+     * @return The mapped file if a local file could be mapped, otherwise the contents read into globalMap.
+     */
+    const unsigned char* GetMap() const
+    {
+      return mappedFile.IsMapped() ? mappedFile.GetData() : globalMap;
+    }
+
     const char *fileName;  /**< The absolute path of the file. */
-    unsigned char *globalMap ;      /**< A pointer to the entire contents of the file that have been mapped with mmap(2). */
+    unsigned char *globalMap ;      /**< A pointer to the entire contents of the file that have been read into memory. */
+    Internal::Platform::MappedFile mappedFile; /**< The local file mapped with mmap(2), shared with the page cache. */
     long long length;  /**< The length of the file in bytes. */
     bool isLocalResource; /**< The flag whether the file is a local resource */
   };
@@ -157,7 +212,7 @@ struct LoaderInfo
     {
     }
 
-    unsigned char *map;
+    const unsigned char *map;
     int position, length; // yes - gif uses ints for file sizes.
   };
 
@@ -199,6 +254,24 @@ inline int PixelLookup( ColorMapObject *colorMap, int index )
   return CombinePixelABGR( 0xFF, colorMap->Colors[index].Red, colorMap->Colors[index].Green, colorMap->Colors[index].Blue );
 }
 
+/**
+ * @brief Look up all the colors of a color map, the entries past its end are opaque black.
+ *
+ * @param[in] colorMap The color map, it may be NULL
+ * @param[out] palette The ABGR colors of all the possible indices
+ */
+void BuildPalette( ColorMapObject *colorMap, std::vector<uint32_t> &palette )
+{
+  palette.assign( PALETTE_SIZE, CombinePixelABGR( 0xFF, 0, 0, 0 ) );
+  if( colorMap )
+  {
+    for( int i = 0; ( i < colorMap->ColorCount ) && ( i < PALETTE_SIZE ); i++ )
+    {
+      palette[i] = PixelLookup( colorMap, i );
+    }
+  }
+}
+
 /**
  * @brief Brute force find frame index - gifs are normally small so ok for now.
  *
@@ -363,61 +436,82 @@ void ClipCoordinates( int imageWidth, int imageHeight, int *xin, int *yin, int x
 }
 
 /**
- * @brief Flush out rgba frame images to save memory but skip current,
- * previous and lastPreservedFrame frames (needed for dispose mode DISPOSE_PREVIOUS)
+ * @brief Retrieves the bytes used by the decoded indices and the palette of a frame.
+ *
+ * @param[in] frame The frame
+ * @return The number of bytes.
+ */
+size_t GetStoredSize( const ImageFrame &frame )
+{
+  return frame.indices.capacity() + frame.palette.capacity() * sizeof( uint32_t );
+}
+
+/**
+ * @brief Flush out the decoded indices of the least recently used frames to save memory,
+ * but skip the frames between first and last which are being composed.
  *
  * @param[in] animated A structure containing GIF animation data
- * @param[in] width Width of the image
- * @param[in] height Height of the image
- * @param[in] thisframe The current frame
- * @param[in] prevframe The previous frame
- * @param[in] lastPreservedFrame The last preserved frame
+ * @param[in] first The first frame being composed
+ * @param[in] last The last frame being composed
  */
-void FlushFrames( GifAnimationData &animated, int width, int height, ImageFrame *thisframe, ImageFrame *prevframe, ImageFrame *lastPreservedFrame )
+void FlushFrames( GifAnimationData &animated, int first, int last )
 {
   DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "FlushFrames() START \n" );
+  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "Total used frame size: %zu\n", animated.storedBytes );
 
-  // target is the amount of memory we want to be under for stored frames
-  int total = 0, target = 512 * 1024;
-
-  // total up the amount of memory used by stored frames for this image
-  for( auto &&frame : animated.frames )
+  while( animated.storedBytes > animated.storedBytesBudget )
   {
-    if( frame.data )
+    ImageFrame *oldest = nullptr;
+    for( auto &&frame : animated.frames )
     {
-      total++;
+      if( frame.loaded && ( (frame.index < first) || (frame.index > last) ) &&
+          ( !oldest || (frame.lastUsed < oldest->lastUsed) ) )
+      {
+        oldest = &frame;
+      }
     }
+
+    if( !oldest )
+    {
+      break;
+    }
+
+    // it will be decoded again from the file if needed
+    animated.storedBytes -= GetStoredSize( *oldest );
+    std::vector<uint8_t>().swap( oldest->indices );
+    std::vector<uint32_t>().swap( oldest->palette );
+    oldest->loaded = false;
   }
-  total *= ( width * height * sizeof( uint32_t ) );
 
-  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "Total used frame size: %d\n", total );
+  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "FlushFrames() END \n" );
+}
 
-  // If we use more than target (512k) for frames - flush
-  if( total > target )
+/**
+ * @brief Keep a copy of the composed canvas as a keyframe, evicting the least recently used
+ * keyframes above the memory budget.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ */
+void AddComposedFrame( GifAnimationData &animated )
+{
+  for( auto &&composedFrame : animated.composedFrames )
   {
-    // Clean frames (except current and previous) until below target
-    for( auto &&frame : animated.frames )
+    if( composedFrame.index == animated.canvasFrame )
     {
-      if( (frame.index != thisframe->index) && (!prevframe || frame.index != prevframe->index) &&
-          (!lastPreservedFrame || frame.index != lastPreservedFrame->index) )
-      {
-        if( frame.data != nullptr )
-        {
-          delete[] frame.data;
-          frame.data = nullptr;
-
-          // subtract memory used and if below target - stop flush
-          total -= ( width * height * sizeof( uint32_t ) );
-          if( total < target )
-          {
-            break;
-          }
-        }
-      }
+      return;
     }
   }
 
-  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "FlushFrames() END \n" );
+  animated.composedFrames.push_front( ComposedFrame() );
+  animated.composedFrames.front().index = animated.canvasFrame;
+  animated.composedFrames.front().pixels = animated.canvas;
+  animated.composedBytes += animated.canvas.size() * sizeof( uint32_t );
+
+  while( ( animated.composedBytes > animated.composedBytesBudget ) && ( animated.composedFrames.size() > 1u ) )
+  {
+    animated.composedBytes -= animated.composedFrames.back().pixels.size() * sizeof( uint32_t );
+    animated.composedFrames.pop_back();
+  }
 }
 
 /**
@@ -477,19 +571,16 @@ int FileRead( GifFileType *gifFileType, GifByteType *buffer, int length )
 }
 
 /**
- * @brief Decode a gif image into rows then expand to 32bit into the destination
- * data pointer.
+ * @brief Decode a gif image into rows and keep the palette indices of the
+ * clipped part in indices.
  */
-bool DecodeImage( GifFileType *gif, uint32_t *data, int rowpix, int xin, int yin,
-                  int transparent, int x, int y, int w, int h, bool fill )
+bool DecodeIndices( GifFileType *gif, int xin, int yin, int w, int h, std::vector<uint8_t> &indices )
 {
   int intoffset[] = {0, 4, 2, 1};
   int intjump[] = {8, 8, 4, 2};
-  int i, xx, yy, pix, gifW, gifH;
+  int i, yy, gifW, gifH;
   GifRowType *rows = NULL;
   bool ret = false;
-  ColorMapObject *colorMap;
-  uint32_t *p;
 
   // what we need is image size.
   SavedImage *sp;
@@ -544,80 +635,99 @@ bool DecodeImage( GifFileType *gif, uint32_t *data, int rowpix, int xin, int yin
     }
   }
 
-  // work out what colormap to use
-  if( gif->Image.ColorMap )
+  // keep the part inside the image only
+  indices.clear();
+  if( (w > 0) && (h > 0) )
   {
-    colorMap = gif->Image.ColorMap;
+    indices.resize( w * h );
+    for( yy = 0; yy < h; yy++ )
+    {
+      memcpy( &indices[yy * w], rows[yin + yy] + xin, w );
+    }
   }
-  else
+  ret = true;
+
+on_error:
+  if( rows )
   {
-    colorMap = gif->SColorMap;
+    free( rows );
   }
+  return ret;
+}
 
-  // if we need to deal with transparent pixels at all...
-  if( transparent >= 0 )
+/**
+ * @brief Expand palette indices to 32bit into the destination data pointer.
+ */
+void DrawIndices( uint32_t *data, int rowpix, const uint8_t *indices, const uint32_t *palette,
+                  int transparent, int x, int y, int w, int h, bool fill )
+{
+  int xx, yy, pix;
+  uint32_t *p;
+
+  for( yy = 0; yy < h; yy++ )
   {
-    // if we are told to FILL (overwrite with transparency kept)
-    if( fill )
+    p = data + ((y + yy) * rowpix) + x;
+    for( xx = 0; xx < w; xx++ )
     {
-      for( yy = 0; yy < h; yy++ )
+      pix = *indices++;
+      if( pix != transparent )
       {
-        p = data + ((y + yy) * rowpix) + x;
-        for( xx = 0; xx < w; xx++ )
-        {
-          pix = rows[yin + yy][xin + xx];
-          if( pix != transparent )
-          {
-            *p = PixelLookup( colorMap, pix );
-          }
-          else
-          {
-            *p = 0;
-          }
-          p++;
-        }
+        *p = palette[pix];
       }
-    }
-    // paste on top with transparent pixels untouched
-    else
-    {
-      for( yy = 0; yy < h; yy++ )
+      // if we are told to FILL (overwrite with transparency kept)
+      else if( fill )
       {
-        p = data + ((y + yy) * rowpix) + x;
-        for( xx = 0; xx < w; xx++ )
-        {
-          pix = rows[yin + yy][xin + xx];
-          if( pix != transparent )
-          {
-            *p = PixelLookup( colorMap, pix );
-          }
-          p++;
-        }
+        *p = 0;
       }
+      // otherwise paste on top with transparent pixels untouched
+      p++;
     }
   }
-  else
+}
+
+/**
+ * @brief Decode a gif image into rows then expand to 32bit into the destination
+ * data pointer.
+ */
+bool DecodeImage( GifFileType *gif, uint32_t *data, int rowpix, int xin, int yin,
+                  int transparent, int x, int y, int w, int h, bool fill )
+{
+  std::vector<uint8_t> indices;
+  std::vector<uint32_t> palette;
+
+  if( !DecodeIndices( gif, xin, yin, w, h, indices ) )
   {
-    // walk pixels without worring about transparency at all
-    for( yy = 0; yy < h; yy++ )
-    {
-      p = data + ((y + yy) * rowpix) + x;
-      for( xx = 0; xx < w; xx++ )
-      {
-        pix = rows[yin + yy][xin + xx];
-        *p = PixelLookup( colorMap, pix );
-        p++;
-      }
-    }
+    return false;
   }
-  ret = true;
 
-on_error:
-  if( rows )
+  // work out what colormap to use
+  BuildPalette( gif->Image.ColorMap ? gif->Image.ColorMap : gif->SColorMap, palette );
+
+  DrawIndices( data, rowpix, indices.data(), palette.data(), transparent, x, y, w, h, fill );
+  return true;
+}
+
+/**
+ * @brief Draw the decoded indices of a frame onto a whole image.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] prop A ImageProperties structure containing information about gif data.
+ * @param[in] frame The frame to draw
+ * @param[in] data The image to draw on
+ * @param[in] fill Whether the transparent pixels are cleared rather than left untouched
+ */
+void DrawFrame( const GifAnimationData &animated, const ImageProperties &prop, const ImageFrame &frame, uint32_t *data, bool fill )
+{
+  int xin = 0, yin = 0, x = 0, y = 0, w = 0, h = 0;
+  ClipCoordinates( prop.w, prop.h, &xin, &yin,
+                   frame.info.x, frame.info.y, frame.info.w, frame.info.h,
+                   &x, &y, &w, &h );
+
+  if( (w > 0) && (h > 0) && (frame.indices.size() >= static_cast<size_t>( w * h )) )
   {
-    free( rows );
+    const std::vector<uint32_t> &palette = frame.palette.empty() ? animated.globalPalette : frame.palette;
+    DrawIndices( data, prop.w, frame.indices.data(), palette.data(), frame.info.transparent, x, y, w, h, fill );
   }
-  return ret;
 }
 
 /**
@@ -654,26 +764,36 @@ bool ReadHeader( LoaderInfo &loaderInfo,
       return false;
     }
 
-    if( fseek( fp, 0, SEEK_END ) <= -1 )
+    // The frames are decoded from the file while the animation plays, so map it rather than keeping a copy unless it is small.
+    fileData.mappedFile = Internal::Platform::MappedFile( fp, Internal::Platform::MappedFile::MINIMUM_IMAGE_SIZE );
+    if( fileData.mappedFile.IsMapped() )
     {
-      return false;
-    }
-
-    fileData.length = ftell( fp );
-    if( fileData.length <= -1 )
-    {
-      return false;
-    }
-
-    if( ( ! fseek( fp, 0, SEEK_SET ) ) )
-    {
-      fileData.globalMap = reinterpret_cast<GifByteType*>( malloc(sizeof( GifByteType ) * fileData.length ) );
-      fileData.length = fread( fileData.globalMap, sizeof( GifByteType ), fileData.length, fp);
-      fileInfo.map = fileData.globalMap;
+      fileData.length = static_cast<long long>( fileData.mappedFile.GetSize() );
+      fileInfo.map = fileData.mappedFile.GetData();
     }
     else
     {
-      return false;
+      if( fseek( fp, 0, SEEK_END ) <= -1 )
+      {
+        return false;
+      }
+
+      fileData.length = ftell( fp );
+      if( fileData.length <= -1 )
+      {
+        return false;
+      }
+
+      if( ( ! fseek( fp, 0, SEEK_SET ) ) )
+      {
+        fileData.globalMap = reinterpret_cast<GifByteType*>( malloc(sizeof( GifByteType ) * fileData.length ) );
+        fileData.length = fread( fileData.globalMap, sizeof( GifByteType ), fileData.length, fp);
+        fileInfo.map = fileData.globalMap;
+      }
+      else
+      {
+        return false;
+      }
     }
   }
   else
@@ -890,9 +1010,132 @@ on_error: // jump here on any errors to clean up
   return ret;
 }
 
+/**
+ * @brief Prepare the canvas to compose a frame on, from the last composed frame
+ * or the nearest composed keyframe before it, whichever is closer.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] prop A ImageProperties structure containing information about gif data.
+ * @param[in] index The frame to compose
+ * @return The first frame to draw on the canvas; it is past index if the canvas holds the frame already.
+ */
+int PrepareCanvas( GifAnimationData &animated, const ImageProperties &prop, int index )
+{
+  auto keyframe = animated.composedFrames.end();
+  for( auto iter = animated.composedFrames.begin(); iter != animated.composedFrames.end(); ++iter )
+  {
+    if( (iter->index <= index) && ( (keyframe == animated.composedFrames.end()) || (iter->index > keyframe->index) ) )
+    {
+      keyframe = iter;
+    }
+  }
+
+  const bool hasKeyframe = keyframe != animated.composedFrames.end();
+  if( (animated.canvasFrame > 0) && (animated.canvasFrame <= index) &&
+      ( !hasKeyframe || (keyframe->index <= animated.canvasFrame) ) )
+  {
+    return animated.canvasFrame + 1;
+  }
+
+  if( hasKeyframe )
+  {
+    // keyframes never have the DISPOSE_PREVIOUS mode so the next frames don't need the preserved one
+    animated.canvas = keyframe->pixels;
+    animated.canvasFrame = keyframe->index;
+    animated.preservedFrame = 0;
+    animated.composedFrames.splice( animated.composedFrames.begin(), animated.composedFrames, keyframe );
+    return animated.canvasFrame + 1;
+  }
+
+  // nothing to build on - start from the first frame
+  animated.canvas.resize( prop.w * prop.h );
+  animated.canvasFrame = 0;
+  animated.preservedFrame = 0;
+  return 1;
+}
+
+/**
+ * @brief Compose the frames from first to last on the canvas, applying the dispose
+ * mode of each previous frame.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] prop A ImageProperties structure containing information about gif data.
+ * @param[in] first The first frame to draw, the one after the frame on the canvas
+ * @param[in] last The last frame to draw
+ * @return The true or false whether composing was successful or not.
+ */
+bool ComposeFrames( GifAnimationData &animated, const ImageProperties &prop, int first, int last )
+{
+  for( int index = first; index <= last; index++ )
+  {
+    ImageFrame *thisFrame = FindFrame( animated, index );
+    if( (!thisFrame) || (!thisFrame->loaded) )
+    {
+      DALI_LOG_ERROR( "LOAD_ERROR_CORRUPT_FILE" );
+      return false;
+    }
+
+    // if we have no prior frame... empty
+    if( animated.canvasFrame == 0 )
+    {
+      memset( animated.canvas.data(), 0, animated.canvas.size() * sizeof(uint32_t) );
+      DrawFrame( animated, prop, *thisFrame, animated.canvas.data(), true );
+    }
+    // we have a prior frame to build on...
+    else
+    {
+      const FrameInfo &previousInfo = FindFrame( animated, animated.canvasFrame )->info;
+
+      if( previousInfo.dispose == DISPOSE_PREVIOUS ) // GIF_DISPOSE_RESTORE
+      {
+        if( animated.preservedFrame == 0 )
+        {
+          DALI_LOG_ERROR( "LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND" );
+          return false;
+        }
+        animated.canvas = animated.preserved;
+      }
+      else
+      {
+        // keep the previous frame if this one has to be undone
+        if( thisFrame->info.dispose == DISPOSE_PREVIOUS )
+        {
+          animated.preserved = animated.canvas;
+          animated.preservedFrame = animated.canvasFrame;
+        }
+
+        // if dispose mode is "background" then fill with bg
+        if( previousInfo.dispose == DISPOSE_BACKGROUND )
+        {
+          int xin = 0, yin = 0, x = 0, y = 0, w = 0, h = 0;
+          ClipCoordinates( prop.w, prop.h, &xin, &yin,
+                           previousInfo.x, previousInfo.y, previousInfo.w, previousInfo.h,
+                           &x, &y, &w, &h );
+          FillImage( animated.canvas.data(), prop.w, (previousInfo.transparent < 0) ? thisFrame->background : 0, x, y, w, h );
+        }
+      }
+
+      // now draw this frame on top
+      DrawFrame( animated, prop, *thisFrame, animated.canvas.data(), false );
+    }
+
+    animated.canvasFrame = index;
+    thisFrame->lastUsed = ++animated.useCount;
+
+    if( (index % KEYFRAME_INTERVAL == 0) && (thisFrame->info.dispose != DISPOSE_PREVIOUS) )
+    {
+      AddComposedFrame( animated );
+    }
+  }
+  return true;
+}
+
 /**
  * @brief Reader next frame of the gif file and populates structures accordingly.
  *
+ * The frames of an animated gif are decoded into palette indices, and composed from
+ * the last composed frame or the nearest keyframe.
+ *
  * @param[in] loaderInfo A LoaderInfo structure containing file descriptor and other data about GIF.
  * @param[in/out] prop A ImageProperties structure containing information about gif data.
  * @param[out] pixels A pointer to buffer which will contain all pixel data of the frame on return.
@@ -907,10 +1150,9 @@ bool ReadNextFrame( LoaderInfo &loaderInfo, ImageProperties &prop, //  use for w
   bool ret = false;
   GifRecordType rec;
   GifFileType *gif = NULL;
-  int index = 0, imageNumber = 0;
+  int index = 0, imageNumber = 0, composeFrom = 0, decodeFrom = 0;
   FrameInfo *frameInfo;
   ImageFrame *frame = NULL;
-  ImageFrame *lastPreservedFrame = NULL;
 
   index = animated.currentFrame;
 
@@ -922,17 +1164,30 @@ bool ReadNextFrame( LoaderInfo &loaderInfo, ImageProperties &prop, //  use for w
 
   // find the given frame index
   frame = FindFrame( animated, index );
-  if( frame )
+  if( !frame )
   {
-    if( (frame->loaded) && (frame->data) )
-    {
-      // frame is already there and decoded - jump to end
-      goto on_ok;
-    }
+    LOADERR("LOAD_ERROR_CORRUPT_FILE");
   }
-  else
+
+  decodeFrom = index;
+  if( animated.animated )
   {
-    LOADERR("LOAD_ERROR_CORRUPT_FILE");
+    // only the frames drawn on top of the canvas need to be decoded
+    composeFrom = PrepareCanvas( animated, prop, index );
+    for( decodeFrom = composeFrom; decodeFrom <= index; decodeFrom++ )
+    {
+      ImageFrame *composedFrame = FindFrame( animated, decodeFrom );
+      if( (!composedFrame) || (!composedFrame->loaded) )
+      {
+        break;
+      }
+    }
+
+    if( decodeFrom > index )
+    {
+      // all the frames are decoded already - just compose
+      goto on_compose;
+    }
   }
 
 open_file:
@@ -940,7 +1195,7 @@ open_file:
   gif = loaderInfo.gif;
   if( !gif )
   {
-    loaderInfo.fileInfo.map = fileData.globalMap ;
+    loaderInfo.fileInfo.map = fileData.GetMap();
     if( !loaderInfo.fileInfo.map )
     {
       LOADERR("LOAD_ERROR_CORRUPT_FILE");
@@ -960,11 +1215,16 @@ open_file:
     }
     loaderInfo.gif = gif;
     loaderInfo.imageNumber = 1;
+
+    if( animated.globalPalette.empty() )
+    {
+      BuildPalette( gif->SColorMap, animated.globalPalette );
+    }
   }
 
-  // if we want to go backwards, we likely need/want to re-decode from the
-  // start as we have nothing to build on
-  if( (index > 0) && (index < loaderInfo.imageNumber) && (animated.animated) )
+  // if we want to go backwards, we need to re-decode from the start
+  // as the file can only be read forwards
+  if( (decodeFrom > 0) && (decodeFrom < loaderInfo.imageNumber) && (animated.animated) )
   {
 #if (GIFLIB_MAJOR > 5) || ((GIFLIB_MAJOR == 5) && (GIFLIB_MINOR >= 1))
     if( loaderInfo.gif )
@@ -1007,7 +1267,6 @@ open_file:
       int xin = 0, yin = 0, x = 0, y = 0, w = 0, h = 0;
       int img_code;
       GifByteType *img;
-      ImageFrame *previousFrame = NULL;
       ImageFrame *thisFrame = NULL;
 
       // get image desc
@@ -1016,115 +1275,57 @@ open_file:
         LOADERR("LOAD_ERROR_UNKNOWN_FORMAT");
       }
 
-      // get the previous frame entry AND the current one to fill in
-      previousFrame = FindFrame(animated, imageNumber - 1);
+      // get the current frame entry to fill in
       thisFrame = FindFrame(animated, imageNumber);
 
-      // if we have a frame AND we're animated AND we have no data...
-      if( (thisFrame) && (!thisFrame->data) && (animated.animated) )
+      // if we have a frame AND we're animated AND we have no indices...
+      if( (thisFrame) && (!thisFrame->loaded) && (imageNumber >= decodeFrom) && (animated.animated) )
       {
-        bool first = false;
-
-        // allocate it
-        thisFrame->data = new uint32_t[prop.w * prop.h];
-
-        if( !thisFrame->data )
-        {
-          LOADERR("LOAD_ERROR_RESOURCE_ALLOCATION_FAILED");
-        }
-
-        // if we have no prior frame OR prior frame data... empty
-        if( (!previousFrame) || (!previousFrame->data) )
-        {
-          first = true;
-          frameInfo = &(thisFrame->info);
-          memset( thisFrame->data, 0, prop.w * prop.h * sizeof(uint32_t) );
-        }
-        // we have a prior frame to copy data from...
-        else
-        {
-          frameInfo = &( previousFrame->info );
-
-          // fix coords of sub image in case it goes out...
-          ClipCoordinates( prop.w, prop.h, &xin, &yin,
-                           frameInfo->x, frameInfo->y, frameInfo->w, frameInfo->h,
-                           &x, &y, &w, &h );
-
-          // if dispose mode is not restore - then copy pre frame
-          if( frameInfo->dispose != DISPOSE_PREVIOUS )
-          {
-            memcpy( thisFrame->data, previousFrame->data, prop.w * prop.h * sizeof(uint32_t) );
-          }
-
-          // if dispose mode is "background" then fill with bg
-          if( frameInfo->dispose == DISPOSE_BACKGROUND )
-          {
-            FillFrame( thisFrame->data, prop.w, gif, frameInfo, x, y, w, h );
-          }
-          else if( frameInfo->dispose == DISPOSE_PREVIOUS ) // GIF_DISPOSE_RESTORE
-          {
-            int prevIndex = 2;
-            do
-            {
-              // Find last preserved frame.
-              lastPreservedFrame = FindFrame( animated, imageNumber - prevIndex );
-              if( ! lastPreservedFrame )
-              {
-                LOADERR( "LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND" );
-              }
-              prevIndex++;
-            } while( lastPreservedFrame && lastPreservedFrame->info.dispose == DISPOSE_PREVIOUS );
-
-            if ( lastPreservedFrame )
-            {
-              memcpy( thisFrame->data, lastPreservedFrame->data, prop.w * prop.h * sizeof(uint32_t) );
-            }
-          }
-        }
-        // now draw this frame on top
+        // keep the palette indices of the part inside the image
         frameInfo = &( thisFrame->info );
         ClipCoordinates( prop.w, prop.h, &xin, &yin,
                          frameInfo->x, frameInfo->y, frameInfo->w, frameInfo->h,
                          &x, &y, &w, &h );
-        if( !DecodeImage( gif, thisFrame->data, prop.w,
-                          xin, yin, frameInfo->transparent,
-                          x, y, w, h, first) )
+        if( !DecodeIndices( gif, xin, yin, w, h, thisFrame->indices ) )
         {
           LOADERR("LOAD_ERROR_CORRUPT_FILE");
         }
 
+        // and the colors if the frame has its own color map
+        if( gif->Image.ColorMap )
+        {
+          BuildPalette( gif->Image.ColorMap, thisFrame->palette );
+        }
+        const std::vector<uint32_t> &palette = thisFrame->palette.empty() ? animated.globalPalette : thisFrame->palette;
+        thisFrame->background = palette[gif->SBackGroundColor % PALETTE_SIZE];
+
         // mark as loaded and done
         thisFrame->loaded = true;
-
-        FlushFrames( animated, prop.w, prop.h, thisFrame, previousFrame, lastPreservedFrame );
+        thisFrame->lastUsed = ++animated.useCount;
+        animated.storedBytes += GetStoredSize( *thisFrame );
       }
       // if we have a frame BUT the image is not animated. different
       // path
-      else if( (thisFrame) && (!thisFrame->data) && (!animated.animated) )
+      else if( (thisFrame) && (!animated.animated) )
       {
-        // if we don't have the data decoded yet - decode it
-        if( (!thisFrame->loaded) || (!thisFrame->data) )
-        {
-          // use frame info but we WONT allocate frame pixels
-          frameInfo = &( thisFrame->info );
-          ClipCoordinates( prop.w, prop.h, &xin, &yin,
-                           frameInfo->x, frameInfo->y, frameInfo->w, frameInfo->h,
-                           &x, &y, &w, &h );
-
-          // clear out all pixels
-          FillFrame( reinterpret_cast<uint32_t *>(pixels), prop.w, gif, frameInfo, 0, 0, prop.w, prop.h );
+        // use frame info but we WONT allocate frame pixels
+        frameInfo = &( thisFrame->info );
+        ClipCoordinates( prop.w, prop.h, &xin, &yin,
+                         frameInfo->x, frameInfo->y, frameInfo->w, frameInfo->h,
+                         &x, &y, &w, &h );
 
-          // and decode the gif with overwriting
-          if( !DecodeImage( gif, reinterpret_cast<uint32_t *>(pixels), prop.w,
-                            xin, yin, frameInfo->transparent, x, y, w, h, true) )
-          {
-            LOADERR("LOAD_ERROR_CORRUPT_FILE");
-          }
+        // clear out all pixels
+        FillFrame( reinterpret_cast<uint32_t *>(pixels), prop.w, gif, frameInfo, 0, 0, prop.w, prop.h );
 
-          // mark as loaded and done
-          thisFrame->loaded = true;
+        // and decode the gif with overwriting
+        if( !DecodeImage( gif, reinterpret_cast<uint32_t *>(pixels), prop.w,
+                          xin, yin, frameInfo->transparent, x, y, w, h, true) )
+        {
+          LOADERR("LOAD_ERROR_CORRUPT_FILE");
         }
-        // flush mem we don't need (at expense of decode cpu)
+
+        // mark as loaded and done
+        thisFrame->loaded = true;
       }
       else
       {
@@ -1170,18 +1371,24 @@ open_file:
     loaderInfo.imageNumber = 0;
   }
 
-on_ok:
+on_compose:
+  // if it was an animated image we need to compose the frame
+  // and copy it to the pixels for the image
+  if( animated.animated )
+  {
+    if( !ComposeFrames( animated, prop, composeFrom, index ) )
+    {
+      goto on_error;
+    }
+    memcpy( pixels, animated.canvas.data(), prop.w * prop.h * sizeof( uint32_t ) );
+
+    FlushFrames( animated, composeFrom, index );
+  }
+
   // no errors in header scan etc. so set err and return value
   *error = 0;
   ret = true;
 
-  // if it was an animated image we need to copy the data to the
-  // pixels for the image from the frame holding the data
-  if( animated.animated && frame->data )
-  {
-    memcpy( pixels, frame->data, prop.w * prop.h * sizeof( uint32_t ) );
-  }
-
 on_error: // jump here on any errors to clean up
   return ret;
 }
@@ -1216,22 +1423,12 @@ public:
       free( loaderInfo.fileData.globalMap );
       loaderInfo.fileData.globalMap  = nullptr;
     }
-
-    // Delete all image frames
-    for( auto &&frame : loaderInfo.animated.frames )
-    {
-      if( frame.data != nullptr )
-      {
-        // De-allocate memory of the frame data.
-        delete[] frame.data;
-        frame.data = nullptr;
-      }
-    }
   }
 
   std::string mUrl;
   LoaderInfo loaderInfo;
   ImageProperties imageProperties;
+  Mutex mMutex; ///< Serializes the decoding, which the streaming worker thread also does
 };
 
 AnimatedImageLoadingPtr GifLoading::New( const std::string &url, bool isLocalResource )
@@ -1247,6 +1444,8 @@ GifLoading::GifLoading( const std::string &url, bool isLocalResource )
 
 GifLoading::~GifLoading()
 {
+  // The worker thread decodes with mImpl.
+  StopStreaming();
   delete mImpl;
 }
 
@@ -1259,6 +1458,8 @@ bool GifLoading::LoadNextNFrames( uint32_t frameStartIndex, int count, std::vect
 
   DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "LoadNextNFrames( frameStartIndex:%d, count:%d )\n", frameStartIndex, count );
 
+  Mutex::ScopedLock lock( mImpl->mMutex );
+
   for( int i = 0; i < count; ++i )
   {
     auto pixelBuffer = new unsigned char[ bufferSize ];
@@ -1287,6 +1488,8 @@ Dali::Devel::PixelBuffer GifLoading::LoadFrame( uint32_t frameIndex )
 
   DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "LoadFrame( frameIndex:%d )\n", frameIndex );
 
+  Mutex::ScopedLock lock( mImpl->mMutex );
+
   pixelBuffer = Dali::Devel::PixelBuffer::New( mImpl->imageProperties.w, mImpl->imageProperties.h, Dali::Pixel::RGBA8888 );
 
   mImpl->loaderInfo.animated.currentFrame = 1 + ( frameIndex % mImpl->loaderInfo.animated.frameCount );
@@ -1311,6 +1514,7 @@ uint32_t GifLoading::GetImageCount() const
 
 uint32_t GifLoading::GetFrameInterval( uint32_t frameIndex ) const
 {
+  Mutex::ScopedLock lock( mImpl->mMutex );
   return mImpl->loaderInfo.animated.frames[frameIndex].info.delay * 10;
 }
 
@@ -1319,6 +1523,13 @@ std::string GifLoading::GetUrl() const
   return mImpl->mUrl;
 }
 
+void GifLoading::SetMemoryBudget( size_t storedFramesBudget, size_t composedFramesBudget )
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  mImpl->loaderInfo.animated.storedBytesBudget = storedFramesBudget;
+  mImpl->loaderInfo.animated.composedBytesBudget = composedFramesBudget;
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
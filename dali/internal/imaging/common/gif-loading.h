@@ -18,6 +18,7 @@
  *
  */
 // EXTERNAL INCLUDES
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <dali/public-api/math/rect.h>
@@ -121,6 +122,17 @@ public:
    */
   std::string GetUrl() const override;
 
+  /**
+   * @brief Set the memory the decoded frames may keep.
+   *
+   * Above these budgets the least recently used frames are evicted, and decoded or composed again
+   * from the file when they are loaded. The defaults are 16MB of stored frames and 4MB of composed frames.
+   *
+   * @param[in] storedFramesBudget The maximum bytes of palette indices kept for the frames
+   * @param[in] composedFramesBudget The maximum bytes of composed keyframes kept, at least one is kept
+   */
+  void SetMemoryBudget( size_t storedFramesBudget, size_t composedFramesBudget );
+
 private:
   struct Impl;
   Impl* mImpl;
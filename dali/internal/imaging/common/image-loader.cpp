@@ -31,6 +31,7 @@
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
 #include <dali/internal/imaging/common/image-loader-plugin-proxy.h>
 #include <dali/internal/system/common/file-reader.h>
+#include <dali/internal/system/common/mapped-file.h>
 
 using namespace Dali::Integration;
 
@@ -272,7 +273,11 @@ bool ConvertStreamToBitmap( const BitmapResourceType& resource, std::string path
                                    path ) )
     {
       const Dali::ImageLoader::ScalingParameters scalingParameters( resource.size, resource.scalingMode, resource.samplingMode );
-      const Dali::ImageLoader::Input input( fp, scalingParameters, resource.orientationCorrection );
+      // Let the decoders read a large local file straight from the page cache. Other streams are read as before.
+      const Internal::Platform::MappedFile mappedFile( fp, Internal::Platform::MappedFile::MINIMUM_IMAGE_SIZE );
+      Dali::ImageLoader::Input input( fp, scalingParameters, resource.orientationCorrection );
+      input.data = mappedFile.GetData();
+      input.dataSize = mappedFile.GetSize();
 
       // Run the image type decoder:
       result = function( input, pixelBuffer );
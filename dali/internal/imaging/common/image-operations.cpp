@@ -20,9 +20,11 @@
 // EXTERNAL INCLUDES
 #include <cstring>
 #include <stddef.h>
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <vector>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/math/vector2.h>
@@ -30,6 +32,8 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/imaging/common/image-processing-thread-pool.h>
+#include <dali/internal/imaging/common/simd-pixel.h>
 
 namespace Dali
 {
@@ -1249,6 +1253,90 @@ void DownscaleInPlacePow2Generic( unsigned char * const pixels,
   outHeight = scaledHeight;
 }
 
+#if defined( DALI_SIMD_PIXEL_NEON )
+
+/**
+ * @brief Average each pair of RGB565 pixels in two vectors of eight.
+ *
+ * Clearing the lowest bit of each field before shifting keeps the fields from
+ * spilling into each other, so the result matches AveragePixelRGB565().
+ */
+inline uint16x8_t AveragePixelsRGB565( uint16x8_t a, uint16x8_t b )
+{
+  return vaddq_u16( vandq_u16( a, b ), vshrq_n_u16( vandq_u16( veorq_u16( a, b ), vdupq_n_u16( 0xf7de ) ), 1 ) );
+}
+
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+
+/**
+ * @brief Average the corresponding bytes of two vectors, rounding down like AverageComponent().
+ *
+ * _mm_avg_epu8 rounds up, so one is taken away wherever the sum of the two bytes is odd.
+ */
+inline __m128i AverageBytes( __m128i a, __m128i b )
+{
+  return _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi8( 1 ) ) );
+}
+
+/**
+ * @brief Average each pair of RGB565 pixels in two vectors of eight.
+ *
+ * Clearing the lowest bit of each field before shifting keeps the fields from
+ * spilling into each other, so the result matches AveragePixelRGB565().
+ */
+inline __m128i AveragePixelsRGB565( __m128i a, __m128i b )
+{
+  return _mm_add_epi16( _mm_and_si128( a, b ), _mm_srli_epi16( _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi16( static_cast<short>( 0xf7de ) ) ), 1 ) );
+}
+
+/**
+ * @brief Pack the low 16 bits of each 32 bit lane of two vectors into one vector.
+ *
+ * SSE2 only has a signed saturating pack, so the values are sign extended first to get through it unchanged.
+ */
+inline __m128i PackLow16( __m128i low, __m128i high )
+{
+  return _mm_packs_epi32( _mm_srai_epi32( _mm_slli_epi32( low, 16 ), 16 ), _mm_srai_epi32( _mm_slli_epi32( high, 16 ), 16 ) );
+}
+
+inline __m128i LoadVector( const void* address )
+{
+  return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+}
+
+inline void StoreVector( void* address, __m128i value )
+{
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value );
+}
+
+#endif
+
+/**
+ * @brief Average as many components of two scanlines as possible with vector instructions.
+ *
+ * The output may be the same as the first scanline as each block of components is loaded before it is stored.
+ * @return The number of components averaged. The caller averages the remaining ones.
+ */
+inline unsigned int AverageComponentsVector( const unsigned char * const scanline1,
+                                             const unsigned char * const __restrict__ scanline2,
+                                             unsigned char* const outputScanline,
+                                             const unsigned int numComponents )
+{
+  unsigned int component = 0;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; component + 16u <= numComponents; component += 16u )
+  {
+    vst1q_u8( &outputScanline[component], vhaddq_u8( vld1q_u8( &scanline1[component] ), vld1q_u8( &scanline2[component] ) ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  for( ; component + 16u <= numComponents; component += 16u )
+  {
+    StoreVector( &outputScanline[component], AverageBytes( LoadVector( &scanline1[component] ), LoadVector( &scanline2[component] ) ) );
+  }
+#endif
+  return component;
+}
+
 }
 
 void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned int width )
@@ -1256,8 +1344,36 @@ void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned in
   DebugAssertScanlineParameters( pixels, width );
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
+
+#if defined( DALI_SIMD_PIXEL_NEON )
+  // Split sixteen pixels into their channels and add the neighbouring pairs in each channel:
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const uint8x16x3_t in = vld3q_u8( &pixels[pixel * 3] );
+    uint8x8x3_t out;
+    out.val[0] = vshrn_n_u16( vpaddlq_u8( in.val[0] ), 1 );
+    out.val[1] = vshrn_n_u16( vpaddlq_u8( in.val[1] ), 1 );
+    out.val[2] = vshrn_n_u16( vpaddlq_u8( in.val[2] ), 1 );
+    vst3_u8( &pixels[outPixel * 3], out );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Average each pixel with the one after it, keep the results for pixels 0 and 2 of every
+  // four and close the gap between them. Sixteen bytes are read for every twelve consumed.
+  const __m128i firstPixel = _mm_setr_epi8( -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+  const __m128i secondPixel = _mm_setr_epi8( 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+  for( ; pixel + 6u <= width; pixel += 4u, outPixel += 2u )
+  {
+    const __m128i in = LoadVector( &pixels[pixel * 3] );
+    const __m128i averaged = AverageBytes( in, _mm_srli_si128( in, 3 ) );
+    const __m128i out = _mm_or_si128( _mm_and_si128( averaged, firstPixel ), _mm_and_si128( _mm_srli_si128( averaged, 3 ), secondPixel ) );
+    uint8_t outBytes[16];
+    StoreVector( outBytes, out );
+    memcpy( &pixels[outPixel * 3], outBytes, 6u );
+  }
+#endif
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c11 = pixels[pixel * 3];
@@ -1282,8 +1398,26 @@ void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned
   uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
+
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; pixel + 8u <= width; pixel += 8u, outPixel += 4u )
+  {
+    const uint32x4x2_t in = vld2q_u32( &alignedPixels[pixel] );
+    vst1q_u32( &alignedPixels[outPixel], vreinterpretq_u32_u8( vhaddq_u8( vreinterpretq_u8_u32( in.val[0] ), vreinterpretq_u8_u32( in.val[1] ) ) ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  for( ; pixel + 8u <= width; pixel += 8u, outPixel += 4u )
+  {
+    const __m128 in1 = _mm_castsi128_ps( LoadVector( &alignedPixels[pixel] ) );
+    const __m128 in2 = _mm_castsi128_ps( LoadVector( &alignedPixels[pixel + 4u] ) );
+    const __m128i even = _mm_castps_si128( _mm_shuffle_ps( in1, in2, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m128i odd = _mm_castps_si128( _mm_shuffle_ps( in1, in2, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    StoreVector( &alignedPixels[outPixel], AverageBytes( even, odd ) );
+  }
+#endif
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     const uint32_t averaged = AveragePixelRGBA8888( alignedPixels[pixel], alignedPixels[pixel + 1] );
     alignedPixels[outPixel] = averaged;
@@ -1298,8 +1432,25 @@ void HalveScanlineInPlaceRGB565( unsigned char * pixels, unsigned int width )
   uint16_t* const alignedPixels = reinterpret_cast<uint16_t*>(pixels);
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const uint16x8x2_t in = vld2q_u16( &alignedPixels[pixel] );
+    vst1q_u16( &alignedPixels[outPixel], AveragePixelsRGB565( in.val[0], in.val[1] ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Average the two pixels in the halves of each 32 bit lane, then pack the results together:
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const __m128i in1 = LoadVector( &alignedPixels[pixel] );
+    const __m128i in2 = LoadVector( &alignedPixels[pixel + 8u] );
+    StoreVector( &alignedPixels[outPixel], PackLow16( AveragePixelsRGB565( in1, _mm_srli_epi32( in1, 16 ) ), AveragePixelsRGB565( in2, _mm_srli_epi32( in2, 16 ) ) ) );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     const uint32_t averaged = AveragePixelRGB565( alignedPixels[pixel], alignedPixels[pixel + 1] );
     alignedPixels[outPixel] = averaged;
@@ -1311,8 +1462,25 @@ void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned in
   DebugAssertScanlineParameters( pixels, width );
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const uint16x8x2_t in = vld2q_u16( reinterpret_cast<const uint16_t*>( &pixels[pixel * 2] ) );
+    vst1q_u8( &pixels[outPixel * 2], vhaddq_u8( vreinterpretq_u8_u16( in.val[0] ), vreinterpretq_u8_u16( in.val[1] ) ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Average the two pixels in the halves of each 32 bit lane, then pack the results together:
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const __m128i in1 = LoadVector( &pixels[pixel * 2] );
+    const __m128i in2 = LoadVector( &pixels[pixel * 2 + 16u] );
+    StoreVector( &pixels[outPixel * 2], PackLow16( AverageBytes( in1, _mm_srli_epi32( in1, 16 ) ), AverageBytes( in2, _mm_srli_epi32( in2, 16 ) ) ) );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c11 = pixels[pixel * 2];
@@ -1331,8 +1499,28 @@ void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int
   DebugAssertScanlineParameters( pixels, width );
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; pixel + 32u <= width; pixel += 32u, outPixel += 16u )
+  {
+    const uint8x16x2_t in = vld2q_u8( &pixels[pixel] );
+    vst1q_u8( &pixels[outPixel], vhaddq_u8( in.val[0], in.val[1] ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Add the pairs of bytes in 16 bit lanes where the sums can't overflow:
+  const __m128i lowBytes = _mm_set1_epi16( 0xff );
+  for( ; pixel + 32u <= width; pixel += 32u, outPixel += 16u )
+  {
+    const __m128i in1 = LoadVector( &pixels[pixel] );
+    const __m128i in2 = LoadVector( &pixels[pixel + 16u] );
+    const __m128i averaged1 = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( in1, lowBytes ), _mm_srli_epi16( in1, 8 ) ), 1 );
+    const __m128i averaged2 = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( in2, lowBytes ), _mm_srli_epi16( in2, 8 ) ), 1 );
+    StoreVector( &pixels[outPixel], _mm_packus_epi16( averaged1, averaged2 ) );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c1 = pixels[pixel];
@@ -1343,10 +1531,6 @@ void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int
   }
 }
 
-/**
- * @ToDo: Optimise for ARM using a 4 bytes at a time loop wrapped around the single ARMV6 instruction: UHADD8  R4, R0, R5. Note, this is not neon. It runs in the normal integer pipeline so there is no downside like a stall moving between integer and copro, or extra power for clocking-up the idle copro.
- * if (widthInComponents >= 7) { word32* aligned1 = scanline1 + 3 & 3; word32* aligned1_end = scanline1 + widthInPixels & 3; while(aligned1 < aligned1_end) { UHADD8  *aligned1++, *aligned2++, *alignedoutput++ } .. + 0 to 3 spare pixels at each end.
- */
 void AverageScanlines1( const unsigned char * const scanline1,
                         const unsigned char * const __restrict__ scanline2,
                         unsigned char* const outputScanline,
@@ -1354,7 +1538,7 @@ void AverageScanlines1( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width );
 
-  for( unsigned int component = 0; component < width; ++component )
+  for( unsigned int component = AverageComponentsVector( scanline1, scanline2, outputScanline, width ); component < width; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1367,7 +1551,7 @@ void AverageScanlines2( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
 
-  for( unsigned int component = 0; component < width * 2; ++component )
+  for( unsigned int component = AverageComponentsVector( scanline1, scanline2, outputScanline, width * 2 ); component < width * 2; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1380,7 +1564,7 @@ void AverageScanlines3( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 3 );
 
-  for( unsigned int component = 0; component < width * 3; ++component )
+  for( unsigned int component = AverageComponentsVector( scanline1, scanline2, outputScanline, width * 3 ); component < width * 3; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1400,7 +1584,8 @@ void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
   const uint32_t* const alignedScanline2 = reinterpret_cast<const uint32_t*>(scanline2);
   uint32_t* const alignedOutput = reinterpret_cast<uint32_t*>(outputScanline);
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  // The channels are averaged separately, so the vector loop can treat the pixels as bytes:
+  for( unsigned int pixel = AverageComponentsVector( scanline1, scanline2, outputScanline, width * 4 ) / 4u; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGBA8888( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -1420,7 +1605,21 @@ void AverageScanlinesRGB565( const unsigned char * const scanline1,
   const uint16_t* const alignedScanline2 = reinterpret_cast<const uint16_t*>(scanline2);
   uint16_t* const alignedOutput = reinterpret_cast<uint16_t*>(outputScanline);
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  unsigned int pixel = 0;
+
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; pixel + 8u <= width; pixel += 8u )
+  {
+    vst1q_u16( &alignedOutput[pixel], AveragePixelsRGB565( vld1q_u16( &alignedScanline1[pixel] ), vld1q_u16( &alignedScanline2[pixel] ) ) );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  for( ; pixel + 8u <= width; pixel += 8u )
+  {
+    StoreVector( &alignedOutput[pixel], AveragePixelsRGB565( LoadVector( &alignedScanline1[pixel] ), LoadVector( &alignedScanline2[pixel] ) ) );
+  }
+#endif
+
+  for( ; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGB565( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -1785,6 +1984,122 @@ inline Pixel4Bytes BilinearFilter4Bytes( Pixel4Bytes tl, Pixel4Bytes tr, Pixel4B
   return pixel;
 }
 
+#if defined( DALI_SIMD_PIXEL_NEON ) || defined( DALI_SIMD_PIXEL_SSE2 )
+
+/**
+ * @brief Blend four 4 channel pixels with the same weights as BilinearFilter1Component(), all channels at once.
+ *
+ * The pixels are read and returned as words holding one channel in each byte. The vertical blend needs 48 bits
+ * of precision, so it is done in 64 bit lanes: the even channels first, then the odd ones.
+ */
+inline uint32_t BilinearFilterChannels( uint32_t tl, uint32_t tr, uint32_t bl, uint32_t br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+{
+  DALI_ASSERT_DEBUG( fractBlendHorizontal <= 65535u && "Factor should be in 0.16 fixed-point." );
+  DALI_ASSERT_DEBUG( fractBlendVertical   <= 65535u && "Factor should be in 0.16 fixed-point." );
+
+#if defined( DALI_SIMD_PIXEL_NEON )
+  // Horizontal blend of each row into 16.16 fixed-point:
+  const uint16x8_t top = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( tr, vdup_n_u32( tl ), 1 ) ) );
+  const uint16x8_t bottom = vmovl_u8( vreinterpret_u8_u32( vset_lane_u32( br, vdup_n_u32( bl ), 1 ) ) );
+  const uint16x4_t leftWeight = vdup_n_u16( static_cast<uint16_t>( 65535u - fractBlendHorizontal ) );
+  const uint16x4_t rightWeight = vdup_n_u16( static_cast<uint16_t>( fractBlendHorizontal ) );
+  const uint32x4_t topBlend = vmlal_u16( vmull_u16( vget_low_u16( top ), leftWeight ), vget_high_u16( top ), rightWeight );
+  const uint32x4_t bottomBlend = vmlal_u16( vmull_u16( vget_low_u16( bottom ), leftWeight ), vget_high_u16( bottom ), rightWeight );
+
+  // Vertical blend into 16.32 fixed-point, then round:
+  const uint32x2_t topWeight = vdup_n_u32( 65535u - fractBlendVertical );
+  const uint32x2_t bottomWeight = vdup_n_u32( fractBlendVertical );
+  const uint64x2_t rounding = vdupq_n_u64( 1ull << 31u );
+  const uint64x2_t blendedLow = vmlal_u32( vmlal_u32( rounding, vget_low_u32( topBlend ), topWeight ), vget_low_u32( bottomBlend ), bottomWeight );
+  const uint64x2_t blendedHigh = vmlal_u32( vmlal_u32( rounding, vget_high_u32( topBlend ), topWeight ), vget_high_u32( bottomBlend ), bottomWeight );
+
+  const uint16x4_t narrow = vmovn_u32( vcombine_u32( vshrn_n_u64( blendedLow, 32 ), vshrn_n_u64( blendedHigh, 32 ) ) );
+  return vget_lane_u32( vreinterpret_u32_u8( vmovn_u16( vcombine_u16( narrow, narrow ) ) ), 0 );
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Horizontal blend of each row into 16.16 fixed-point, building the 32 bit products from their 16 bit halves:
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i horizontalWeights = _mm_unpacklo_epi64( _mm_set1_epi16( static_cast<short>( 65535u - fractBlendHorizontal ) ),
+                                                        _mm_set1_epi16( static_cast<short>( fractBlendHorizontal ) ) );
+  const __m128i top = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( static_cast<int>( tl ) ), _mm_cvtsi32_si128( static_cast<int>( tr ) ) ), zero );
+  const __m128i bottom = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( static_cast<int>( bl ) ), _mm_cvtsi32_si128( static_cast<int>( br ) ) ), zero );
+  const __m128i topLow = _mm_mullo_epi16( top, horizontalWeights );
+  const __m128i topHigh = _mm_mulhi_epu16( top, horizontalWeights );
+  const __m128i bottomLow = _mm_mullo_epi16( bottom, horizontalWeights );
+  const __m128i bottomHigh = _mm_mulhi_epu16( bottom, horizontalWeights );
+  const __m128i topBlend = _mm_add_epi32( _mm_unpacklo_epi16( topLow, topHigh ), _mm_unpackhi_epi16( topLow, topHigh ) );
+  const __m128i bottomBlend = _mm_add_epi32( _mm_unpacklo_epi16( bottomLow, bottomHigh ), _mm_unpackhi_epi16( bottomLow, bottomHigh ) );
+
+  // Vertical blend into 16.32 fixed-point, then round:
+  const __m128i topWeight = _mm_set1_epi32( static_cast<int>( 65535u - fractBlendVertical ) );
+  const __m128i bottomWeight = _mm_set1_epi32( static_cast<int>( fractBlendVertical ) );
+  const __m128i rounding = _mm_set1_epi64x( 1ll << 31u );
+  const __m128i blendedEven = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( topBlend, topWeight ), _mm_mul_epu32( bottomBlend, bottomWeight ) ), rounding );
+  const __m128i blendedOdd = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( topBlend, 32 ), topWeight ),
+                                                           _mm_mul_epu32( _mm_srli_epi64( bottomBlend, 32 ), bottomWeight ) ), rounding );
+
+  // The integer parts of the even channels are in the high halves of the 64 bit lanes and need moving down; the odd ones are already in place:
+  const __m128i channels = _mm_or_si128( _mm_srli_epi64( blendedEven, 32 ), _mm_and_si128( blendedOdd, _mm_set_epi32( -1, 0, -1, 0 ) ) );
+  const __m128i narrow = _mm_packs_epi32( channels, zero );
+  return static_cast<uint32_t>( _mm_cvtsi128_si32( _mm_packus_epi16( narrow, narrow ) ) );
+#endif
+}
+
+/** @copydoc BilinearFilter1BPPByte */
+inline Pixel2Bytes BilinearFilter2BytesVector( Pixel2Bytes tl, Pixel2Bytes tr, Pixel2Bytes bl, Pixel2Bytes br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+{
+  const uint32_t blended = BilinearFilterChannels( tl.l | ( tl.a << 8u ), tr.l | ( tr.a << 8u ), bl.l | ( bl.a << 8u ), br.l | ( br.a << 8u ), fractBlendHorizontal, fractBlendVertical );
+  Pixel2Bytes pixel;
+  pixel.l = static_cast<uint8_t>( blended );
+  pixel.a = static_cast<uint8_t>( blended >> 8u );
+  return pixel;
+}
+
+/** @return The channels of an RGB888 pixel in the low three bytes of a word. */
+inline uint32_t ChannelsRGB888( Pixel3Bytes pixel )
+{
+  return pixel.r | ( pixel.g << 8u ) | ( pixel.b << 16u );
+}
+
+/** @copydoc BilinearFilter1BPPByte */
+inline Pixel3Bytes BilinearFilterRGB888Vector( Pixel3Bytes tl, Pixel3Bytes tr, Pixel3Bytes bl, Pixel3Bytes br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+{
+  const uint32_t blended = BilinearFilterChannels( ChannelsRGB888( tl ), ChannelsRGB888( tr ), ChannelsRGB888( bl ), ChannelsRGB888( br ), fractBlendHorizontal, fractBlendVertical );
+  Pixel3Bytes pixel;
+  pixel.r = static_cast<uint8_t>( blended );
+  pixel.g = static_cast<uint8_t>( blended >> 8u );
+  pixel.b = static_cast<uint8_t>( blended >> 16u );
+  return pixel;
+}
+
+/** @return The three fields of an RGB565 pixel, one in each of the low three bytes of a word. */
+inline uint32_t ChannelsRGB565( PixelRGB565 pixel )
+{
+  return ( pixel & 31u ) | ( ( ( pixel >> 5u ) & 63u ) << 8u ) | ( ( pixel >> 11u ) << 16u );
+}
+
+/** @copydoc BilinearFilter1BPPByte */
+inline PixelRGB565 BilinearFilterRGB565Vector( PixelRGB565 tl, PixelRGB565 tr, PixelRGB565 bl, PixelRGB565 br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+{
+  const uint32_t blended = BilinearFilterChannels( ChannelsRGB565( tl ), ChannelsRGB565( tr ), ChannelsRGB565( bl ), ChannelsRGB565( br ), fractBlendHorizontal, fractBlendVertical );
+  return static_cast<PixelRGB565>( ( ( blended >> 16u ) << 11u ) + ( ( ( blended >> 8u ) & 0xffu ) << 5u ) + ( blended & 0xffu ) );
+}
+
+/** @copydoc BilinearFilter1BPPByte */
+inline Pixel4Bytes BilinearFilter4BytesVector( Pixel4Bytes tl, Pixel4Bytes tr, Pixel4Bytes bl, Pixel4Bytes br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
+{
+  uint32_t tlChannels, trChannels, blChannels, brChannels;
+  memcpy( &tlChannels, &tl, sizeof( uint32_t ) );
+  memcpy( &trChannels, &tr, sizeof( uint32_t ) );
+  memcpy( &blChannels, &bl, sizeof( uint32_t ) );
+  memcpy( &brChannels, &br, sizeof( uint32_t ) );
+  const uint32_t blended = BilinearFilterChannels( tlChannels, trChannels, blChannels, brChannels, fractBlendHorizontal, fractBlendVertical );
+  Pixel4Bytes pixel;
+  memcpy( &pixel, &blended, sizeof( uint32_t ) );
+  return pixel;
+}
+
+#endif
+
 /**
  * @brief Generic version of bilinear sampling image resize function.
  * @note Limited to one compilation unit and exposed through type-specific
@@ -1823,44 +2138,48 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  // Each output scanline only depends on the input, so bands of them can be sampled in parallel:
+  Adaptor::ImageProcessingThreadPool::ProcessRowsInParallel( desiredWidth, desiredHeight, [=]( unsigned int startRow, unsigned int endRow )
   {
-    PIXEL* const outScanline = &outAligned[desiredWidth * outY];
-
-    // Find the two scanlines to blend and the weight to blend with:
-    const unsigned int integerY1 = inY >> 16u;
-    const unsigned int integerY2 = integerY1 >= inputHeight ? integerY1 : integerY1 + 1;
-    const unsigned int inputYWeight = inY & 65535u;
-
-    DALI_ASSERT_DEBUG( integerY1 < inputHeight );
-    DALI_ASSERT_DEBUG( integerY2 < inputHeight );
-
-    const PIXEL* const inScanline1 = &inAligned[inputWidth * integerY1];
-    const PIXEL* const inScanline2 = &inAligned[inputWidth * integerY2];
-
-    unsigned int inX = 0;
-    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+    unsigned int inY = startRow * deltaY;
+    for( unsigned int outY = startRow; outY < endRow; ++outY )
     {
-      // Work out the two pixel scanline offsets for this cluster of four samples:
-      const unsigned int integerX1 = inX >> 16u;
-      const unsigned int integerX2 = integerX1 >= inputWidth ? integerX1 : integerX1 + 1;
+      PIXEL* const outScanline = &outAligned[desiredWidth * outY];
 
-      // Execute the loads:
-      const PIXEL pixel1 = inScanline1[integerX1];
-      const PIXEL pixel2 = inScanline2[integerX1];
-      const PIXEL pixel3 = inScanline1[integerX2];
-      const PIXEL pixel4 = inScanline2[integerX2];
-      ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
+      // Find the two scanlines to blend and the weight to blend with:
+      const unsigned int integerY1 = inY >> 16u;
+      const unsigned int integerY2 = integerY1 >= inputHeight ? integerY1 : integerY1 + 1;
+      const unsigned int inputYWeight = inY & 65535u;
 
-      // Weighted bilinear filter:
-      const unsigned int inputXWeight = inX & 65535u;
-      outScanline[outX] = BilinearFilter( pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight );
+      DALI_ASSERT_DEBUG( integerY1 < inputHeight );
+      DALI_ASSERT_DEBUG( integerY2 < inputHeight );
 
-      inX += deltaX;
+      const PIXEL* const inScanline1 = &inAligned[inputWidth * integerY1];
+      const PIXEL* const inScanline2 = &inAligned[inputWidth * integerY2];
+
+      unsigned int inX = 0;
+      for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+      {
+        // Work out the two pixel scanline offsets for this cluster of four samples:
+        const unsigned int integerX1 = inX >> 16u;
+        const unsigned int integerX2 = integerX1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+        // Execute the loads:
+        const PIXEL pixel1 = inScanline1[integerX1];
+        const PIXEL pixel2 = inScanline2[integerX1];
+        const PIXEL pixel3 = inScanline1[integerX2];
+        const PIXEL pixel4 = inScanline2[integerX2];
+        ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
+
+        // Weighted bilinear filter:
+        const unsigned int inputXWeight = inX & 65535u;
+        outScanline[outX] = BilinearFilter( pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight );
+
+        inX += deltaX;
+      }
+      inY += deltaY;
     }
-    inY += deltaY;
-  }
+  } );
 }
 
 }
@@ -1880,7 +2199,11 @@ void LinearSample2BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
+#if defined( DALI_SIMD_PIXEL_NEON ) || defined( DALI_SIMD_PIXEL_SSE2 )
+  LinearSampleGeneric<Pixel2Bytes, BilinearFilter2BytesVector, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#else
   LinearSampleGeneric<Pixel2Bytes, BilinearFilter2Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#endif
 }
 
 void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
@@ -1888,7 +2211,11 @@ void LinearSampleRGB565( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
+#if defined( DALI_SIMD_PIXEL_NEON ) || defined( DALI_SIMD_PIXEL_SSE2 )
+  LinearSampleGeneric<PixelRGB565, BilinearFilterRGB565Vector, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#else
   LinearSampleGeneric<PixelRGB565, BilinearFilterRGB565, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#endif
 }
 
 void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
@@ -1896,7 +2223,11 @@ void LinearSample3BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
+#if defined( DALI_SIMD_PIXEL_NEON ) || defined( DALI_SIMD_PIXEL_SSE2 )
+  LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888Vector, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#else
   LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888, false>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#endif
 }
 
 void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
@@ -1904,30 +2235,30 @@ void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
                        unsigned char * __restrict__ outPixels,
                        ImageDimensions desiredDimensions )
 {
+#if defined( DALI_SIMD_PIXEL_NEON ) || defined( DALI_SIMD_PIXEL_SSE2 )
+  LinearSampleGeneric<Pixel4Bytes, BilinearFilter4BytesVector, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#else
   LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>( inPixels, inputDimensions, outPixels, desiredDimensions );
+#endif
 }
 
 
-void Resample( const unsigned char * __restrict__ inPixels,
-               ImageDimensions inputDimensions,
-               unsigned char * __restrict__ outPixels,
-               ImageDimensions desiredDimensions,
-               Resampler::Filter filterType,
-               int numChannels, bool hasAlpha )
+namespace
 {
-  // Got from the test.cpp of the ImageResampler lib.
-  const float ONE_DIV_255 = 1.0f / 255.0f;
-  const int MAX_UNSIGNED_CHAR = std::numeric_limits<uint8_t>::max();
-  const int LINEAR_TO_SRGB_TABLE_SIZE = 4096;
-  const int ALPHA_CHANNEL = hasAlpha ? (numChannels-1) : 0;
 
-  static bool loadColorSpaces = true;
-  static float srgbToLinear[MAX_UNSIGNED_CHAR + 1];
-  static unsigned char linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE];
+const int LINEAR_TO_SRGB_TABLE_SIZE = 4096; ///< The number of entries of the table converting linear samples back to sRGB.
+const int MAXIMUM_CHANNELS = 4;             ///< Resample() only supports formats with up to four 8 bit channels.
 
-  if( loadColorSpaces ) // Only create the color space conversions on the first execution
+/**
+ * @brief The color space conversions of the resampler, built once on first use.
+ */
+struct ColorSpaceTables
+{
+  ColorSpaceTables()
   {
-    loadColorSpaces = false;
+    // Got from the test.cpp of the ImageResampler lib.
+    const float ONE_DIV_255 = 1.0f / 255.0f;
+    const int MAX_UNSIGNED_CHAR = std::numeric_limits<uint8_t>::max();
 
     for( int i = 0; i <= MAX_UNSIGNED_CHAR; ++i )
     {
@@ -1952,138 +2283,301 @@ void Resample( const unsigned char * __restrict__ inPixels,
     }
   }
 
-  std::vector<Resampler*> resamplers( numChannels );
-  std::vector<Vector<float>> samples(numChannels);
+  float srgbToLinear[256];                               ///< sRGB byte to linear sample
+  unsigned char linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE]; ///< Linear sample to sRGB byte
+};
 
-  const int srcWidth = inputDimensions.GetWidth();
-  const int srcHeight = inputDimensions.GetHeight();
-  const int dstWidth = desiredDimensions.GetWidth();
-  const int dstHeight = desiredDimensions.GetHeight();
+/**
+ * @brief Resamples an image with the contributor lists of a Resampler, a band of destination rows at a time.
+ *
+ * The filtering is done in the same order and with the same arithmetic as Resampler::put_line() and
+ * Resampler::get_line(), so the result doesn't depend on how the image is split into bands. Each band keeps
+ * the source rows its vertical filter reads in a small ring, like the scan buffer of the Resampler.
+ */
+class BandResampler
+{
+public:
+
+  BandResampler( const unsigned char* inPixels,
+                 unsigned char* outPixels,
+                 int srcWidth, int srcHeight,
+                 int dstWidth, int dstHeight,
+                 int numChannels, bool hasAlpha,
+                 const Resampler::Contrib_List* contributorsX,
+                 const Resampler::Contrib_List* contributorsY,
+                 const ColorSpaceTables& tables )
+  : mInPixels( inPixels ),
+    mOutPixels( outPixels ),
+    mSrcWidth( srcWidth ),
+    mDstWidth( dstWidth ),
+    mNumChannels( numChannels ),
+    mAlphaChannel( hasAlpha ? numChannels - 1 : -1 ),
+    mContributorsX( contributorsX ),
+    mContributorsY( contributorsY ),
+    mTables( tables ),
+    mDelayX( false )
+  {
+    DALI_ASSERT_DEBUG( numChannels > 0 && numChannels <= MAXIMUM_CHANNELS );
+
+    // Choose which axis to resample first the same way as the Resampler, by comparing the number of multiplies.
+    int xOps = 0;
+    for( int i = 0; i < dstWidth; ++i )
+    {
+      xOps += contributorsX[i].n;
+    }
+    int yOps = 0;
+    for( int i = 0; i < dstHeight; ++i )
+    {
+      yOps += contributorsY[i].n;
+    }
+    const int xyOps = xOps * srcHeight + ( 4 * yOps * dstWidth ) / 3;
+    const int yxOps = ( 4 * yOps * srcWidth ) / 3 + xOps * dstHeight;
+    mDelayX = ( xyOps > yxOps ) || ( ( xyOps == yxOps ) && ( srcWidth < dstWidth ) );
+  }
+
+  /**
+   * @brief Resamples the destination rows [startRow, endRow).
+   */
+  void ResampleRows( unsigned int startRow, unsigned int endRow ) const
+  {
+    const int rowLength = ( mDelayX ? mSrcWidth : mDstWidth ) * mNumChannels;
+
+    // The ring holds enough rows for the tallest vertical filter in the band.
+    int ringSize = 1;
+    for( unsigned int dstY = startRow; dstY < endRow; ++dstY )
+    {
+      const Resampler::Contrib_List& contributors = mContributorsY[dstY];
+      int lowest = std::numeric_limits<int>::max();
+      int highest = 0;
+      for( int i = 0; i < contributors.n; ++i )
+      {
+        lowest = std::min( lowest, static_cast<int>( contributors.p[i].pixel ) );
+        highest = std::max( highest, static_cast<int>( contributors.p[i].pixel ) );
+      }
+      ringSize = std::max( ringSize, highest - lowest + 1 );
+    }
 
-  // Now create a Resampler instance for each component to process. The first instance will create new contributor tables, which are shared by the resamplers
-  // used for the other components (a memory and slight cache efficiency optimization).
-  resamplers[0] = new Resampler( srcWidth,
-                                 srcHeight,
-                                 dstWidth,
-                                 dstHeight,
-                                 Resampler::BOUNDARY_CLAMP,
-                                 0.0f,           // sample_low,
-                                 1.0f,           // sample_high. Clamp output samples to specified range, or disable clamping if sample_low >= sample_high.
-                                 filterType,    // The type of filter.
-                                 NULL,           // Pclist_x,
-                                 NULL,           // Pclist_y. Optional pointers to contributor lists from another instance of a Resampler.
-                                 FILTER_SCALE,   // src_x_ofs,
-                                 FILTER_SCALE ); // src_y_ofs. Offset input image by specified amount (fractional values okay).
-  samples[0].Resize( srcWidth );
-  for( int i = 1; i < numChannels; ++i )
-  {
-    resamplers[i] = new Resampler( srcWidth,
-                                   srcHeight,
-                                   dstWidth,
-                                   dstHeight,
-                                   Resampler::BOUNDARY_CLAMP,
-                                   0.0f,
-                                   1.0f,
-                                   filterType,
-                                   resamplers[0]->get_clist_x(),
-                                   resamplers[0]->get_clist_y(),
-                                   FILTER_SCALE,
-                                   FILTER_SCALE );
-    samples[i].Resize( srcWidth );
-  }
-
-  const int srcPitch = srcWidth * numChannels;
-  const int dstPitch = dstWidth * numChannels;
-  int dstY = 0;
-
-  for( int srcY = 0; srcY < srcHeight; ++srcY )
-  {
-    const unsigned char* pSrc = &inPixels[srcY * srcPitch];
-
-    for( int x = 0; x < srcWidth; ++x )
-    {
-      for( int c = 0; c < numChannels; ++c )
+    std::vector<float> ring( ringSize * rowLength );
+    std::vector<int> ringRows( ringSize, -1 );
+    std::vector<float> sourceRow( mDelayX ? 0 : mSrcWidth * mNumChannels );
+    std::vector<float> blended( rowLength );
+    std::vector<float> resampled( mDelayX ? mDstWidth * mNumChannels : 0 );
+
+    for( unsigned int dstY = startRow; dstY < endRow; ++dstY )
+    {
+      const Resampler::Contrib_List& contributors = mContributorsY[dstY];
+      for( int i = 0; i < contributors.n; ++i )
       {
-        if( c == ALPHA_CHANNEL && hasAlpha )
+        // The rows of one filter are consecutive apart from the clamped ones, so they never share a slot.
+        const int srcY = contributors.p[i].pixel;
+        const int slot = srcY % ringSize;
+        float* row = &ring[slot * rowLength];
+        if( ringRows[slot] != srcY )
         {
-          samples[c][x] = *pSrc++ * ONE_DIV_255;
+          ringRows[slot] = srcY;
+          if( mDelayX )
+          {
+            ConvertRow( srcY, row );
+          }
+          else
+          {
+            ConvertRow( srcY, sourceRow.data() );
+            ResampleX( sourceRow.data(), row );
+          }
+        }
+
+        const float weight = contributors.p[i].weight;
+        if( i == 0 )
+        {
+          for( int x = 0; x < rowLength; ++x )
+          {
+            blended[x] = row[x] * weight;
+          }
         }
         else
         {
-          samples[c][x] = srgbToLinear[*pSrc++];
+          for( int x = 0; x < rowLength; ++x )
+          {
+            blended[x] += row[x] * weight;
+          }
         }
       }
+
+      const float* samples = blended.data();
+      if( mDelayX )
+      {
+        ResampleX( blended.data(), resampled.data() );
+        samples = resampled.data();
+      }
+      WriteRow( samples, dstY );
     }
+  }
+
+private:
 
-    for( int c = 0; c < numChannels; ++c )
+  /**
+   * @brief Converts a source row to linear samples.
+   */
+  void ConvertRow( int srcY, float* samples ) const
+  {
+    const float ONE_DIV_255 = 1.0f / 255.0f;
+    const unsigned char* source = &mInPixels[srcY * mSrcWidth * mNumChannels];
+    for( int x = 0; x < mSrcWidth; ++x )
     {
-      if( !resamplers[c]->put_line( &samples[c][0] ) )
+      for( int c = 0; c < mNumChannels; ++c, ++source, ++samples )
       {
-        DALI_ASSERT_DEBUG( !"Out of memory" );
+        *samples = ( c == mAlphaChannel ) ? *source * ONE_DIV_255 : mTables.srgbToLinear[*source];
       }
     }
+  }
+
+  /**
+   * @brief Filters a row of samples horizontally.
+   */
+  void ResampleX( const float* samples, float* resampled ) const
+  {
+    if( mNumChannels == 1 )
+    {
+      for( int x = 0; x < mDstWidth; ++x )
+      {
+        const Resampler::Contrib_List& contributors = mContributorsX[x];
+        float total = 0.0f;
+        for( int i = 0; i < contributors.n; ++i )
+        {
+          total += samples[contributors.p[i].pixel] * contributors.p[i].weight;
+        }
+        resampled[x] = total;
+      }
+      return;
+    }
 
-    for(;;)
+    for( int x = 0; x < mDstWidth; ++x, resampled += mNumChannels )
     {
-      int compIndex;
-      for( compIndex = 0; compIndex < numChannels; ++compIndex )
+      // All the channels are summed in one pass over the contributors, each in the same order as the Resampler.
+      const Resampler::Contrib_List& contributors = mContributorsX[x];
+      float totals[MAXIMUM_CHANNELS] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      for( int i = 0; i < contributors.n; ++i )
       {
-        const float* pOutputSamples = resamplers[compIndex]->get_line();
-        if( !pOutputSamples )
+        const float* sample = &samples[contributors.p[i].pixel * mNumChannels];
+        const float weight = contributors.p[i].weight;
+        for( int c = 0; c < mNumChannels; ++c )
         {
-          break;
+          totals[c] += sample[c] * weight;
         }
+      }
+      std::copy( totals, totals + mNumChannels, resampled );
+    }
+  }
 
-        const bool isAlphaChannel = ( compIndex == ALPHA_CHANNEL && hasAlpha );
-        DALI_ASSERT_DEBUG( dstY < dstHeight );
-        unsigned char* pDst = &outPixels[dstY * dstPitch + compIndex];
+  /**
+   * @brief Clamps a row of resampled samples and writes it to the destination as bytes.
+   */
+  void WriteRow( const float* samples, unsigned int dstY ) const
+  {
+    const int MAX_UNSIGNED_CHAR = std::numeric_limits<uint8_t>::max();
+    unsigned char* destination = &mOutPixels[dstY * mDstWidth * mNumChannels];
+    for( int x = 0; x < mDstWidth; ++x )
+    {
+      for( int c = 0; c < mNumChannels; ++c, ++samples, ++destination )
+      {
+        float sample = *samples;
+        if( sample < 0.0f )
+        {
+          sample = 0.0f;
+        }
+        else if( sample > 1.0f )
+        {
+          sample = 1.0f;
+        }
 
-        for( int x = 0; x < dstWidth; ++x )
+        if( c == mAlphaChannel )
         {
-          if( isAlphaChannel )
+          int value = static_cast<int>( 255.0f * sample + 0.5f );
+          if( value < 0 )
           {
-            int c = static_cast<int>( 255.0f * pOutputSamples[x] + 0.5f );
-            if( c < 0 )
-            {
-              c = 0;
-            }
-            else if( c > MAX_UNSIGNED_CHAR )
-            {
-              c = MAX_UNSIGNED_CHAR;
-            }
-            *pDst = static_cast<unsigned char>( c );
+            value = 0;
           }
-          else
+          else if( value > MAX_UNSIGNED_CHAR )
           {
-            int j = static_cast<int>( LINEAR_TO_SRGB_TABLE_SIZE * pOutputSamples[x] + 0.5f );
-            if( j < 0 )
-            {
-              j = 0;
-            }
-            else if( j >= LINEAR_TO_SRGB_TABLE_SIZE )
-            {
-              j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
-            }
-            *pDst = linearToSrgb[j];
+            value = MAX_UNSIGNED_CHAR;
           }
-
-          pDst += numChannels;
+          *destination = static_cast<unsigned char>( value );
+        }
+        else
+        {
+          int j = static_cast<int>( LINEAR_TO_SRGB_TABLE_SIZE * sample + 0.5f );
+          if( j < 0 )
+          {
+            j = 0;
+          }
+          else if( j >= LINEAR_TO_SRGB_TABLE_SIZE )
+          {
+            j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
+          }
+          *destination = mTables.linearToSrgb[j];
         }
       }
-      if( compIndex < numChannels )
-      {
-        break;
-      }
-
-      ++dstY;
     }
   }
 
-  // Delete the resamplers.
-  for( int i = 0; i < numChannels; ++i )
-  {
-    delete resamplers[i];
+private:
+
+  const unsigned char*           mInPixels;      ///< The source image
+  unsigned char*                 mOutPixels;     ///< The destination image
+  int                            mSrcWidth;      ///< The width of the source image
+  int                            mDstWidth;      ///< The width of the destination image
+  int                            mNumChannels;   ///< The number of channels of both images
+  int                            mAlphaChannel;  ///< The channel which isn't gamma corrected, or -1
+  const Resampler::Contrib_List* mContributorsX; ///< The horizontal filter of each destination column
+  const Resampler::Contrib_List* mContributorsY; ///< The vertical filter of each destination row
+  const ColorSpaceTables&        mTables;        ///< The color space conversions
+  bool                           mDelayX;        ///< Whether the vertical filter is applied first
+};
+
+} // unnamed namespace
+
+void Resample( const unsigned char * __restrict__ inPixels,
+               ImageDimensions inputDimensions,
+               unsigned char * __restrict__ outPixels,
+               ImageDimensions desiredDimensions,
+               Resampler::Filter filterType,
+               int numChannels, bool hasAlpha )
+{
+  static const ColorSpaceTables tables;
+
+  const int srcWidth = inputDimensions.GetWidth();
+  const int srcHeight = inputDimensions.GetHeight();
+  const int dstWidth = desiredDimensions.GetWidth();
+  const int dstHeight = desiredDimensions.GetHeight();
+
+  // The Resampler is only used to compute the filter weights of each destination column and row. They are
+  // shared by all the channels and all the bands.
+  Resampler resampler( srcWidth,
+                       srcHeight,
+                       dstWidth,
+                       dstHeight,
+                       Resampler::BOUNDARY_CLAMP,
+                       0.0f,           // sample_low,
+                       1.0f,           // sample_high. Clamp output samples to specified range, or disable clamping if sample_low >= sample_high.
+                       filterType,     // The type of filter.
+                       NULL,           // Pclist_x,
+                       NULL,           // Pclist_y. Optional pointers to contributor lists from another instance of a Resampler.
+                       FILTER_SCALE,   // filter_x_scale,
+                       FILTER_SCALE ); // filter_y_scale. Filter scale - values < 1.0 cause aliasing, but create sharper looking mips.
+  if( resampler.status() != Resampler::STATUS_OKAY )
+  {
+    DALI_LOG_ERROR( "Failed to create the resampler: %d\n", static_cast<int>( resampler.status() ) );
+    return;
   }
+
+  const BandResampler bandResampler( inPixels, outPixels, srcWidth, srcHeight, dstWidth, dstHeight, numChannels, hasAlpha,
+                                     resampler.get_clist_x(), resampler.get_clist_y(), tables );
+
+  // The horizontal filter reads the wider of the two images, so that is what decides whether splitting is worthwhile.
+  Adaptor::ImageProcessingThreadPool::ProcessRowsInParallel( std::max( srcWidth, dstWidth ), dstHeight, [&bandResampler]( unsigned int startRow, unsigned int endRow )
+  {
+    bandResampler.ResampleRows( startRow, endRow );
+  } );
 }
 
 void LanczosSample4BPP( const unsigned char * __restrict__ inPixels,
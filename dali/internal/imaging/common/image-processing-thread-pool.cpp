@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/image-processing-thread-pool.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int PARALLEL_MINIMUM_PIXELS = 256u * 256u;  ///< Images smaller than this are not worth splitting across threads.
+const unsigned int PARALLEL_MINIMUM_ROWS_PER_THREAD = 32u; ///< Avoids waking threads which would only process a few rows.
+const unsigned int DEFAULT_MAXIMUM_THREADS = 4u;           ///< Used if DALI_IMAGE_PROCESSING_THREADS is not set.
+} // unnamed namespace
+
+ImageProcessingThreadPool& ImageProcessingThreadPool::Get()
+{
+  static ImageProcessingThreadPool threadPool( GetMaximumThreadCount() - 1u );
+  return threadPool;
+}
+
+unsigned int ImageProcessingThreadPool::GetMaximumThreadCount()
+{
+  static const unsigned int maximumThreadCount = []()
+  {
+    const char* environmentValue = EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_IMAGE_PROCESSING_THREADS );
+    if( environmentValue )
+    {
+      return static_cast<unsigned int>( std::max( 1, std::atoi( environmentValue ) ) );
+    }
+    return std::max( 1u, std::min( std::thread::hardware_concurrency(), DEFAULT_MAXIMUM_THREADS ) );
+  }();
+  return maximumThreadCount;
+}
+
+void ImageProcessingThreadPool::ProcessRowsInParallel( unsigned int width, unsigned int height, const RowFunction& processRows )
+{
+  unsigned int bandCount = 1u;
+  if( width * height >= PARALLEL_MINIMUM_PIXELS )
+  {
+    bandCount = std::min( GetMaximumThreadCount(), std::max( 1u, height / PARALLEL_MINIMUM_ROWS_PER_THREAD ) );
+  }
+
+  if( bandCount == 1u )
+  {
+    processRows( 0u, height );
+    return;
+  }
+
+  Get().ProcessBands( height, bandCount, processRows );
+}
+
+ImageProcessingThreadPool::ImageProcessingThreadPool( unsigned int numberOfThreads )
+: mConditionalWait(),
+  mBands(),
+  mThreads(),
+  mTerminate( false )
+{
+  mThreads.reserve( numberOfThreads );
+  for( unsigned int i = 0u; i < numberOfThreads; ++i )
+  {
+    mThreads.emplace_back( &ImageProcessingThreadPool::Run, this );
+  }
+}
+
+ImageProcessingThreadPool::~ImageProcessingThreadPool()
+{
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+
+  for( auto&& thread : mThreads )
+  {
+    thread.join();
+  }
+}
+
+void ImageProcessingThreadPool::ProcessBands( unsigned int height, unsigned int bandCount, const RowFunction& processRows )
+{
+  bandCount = std::max( 1u, std::min( bandCount, height ) );
+  const unsigned int rowsPerBand = ( height + bandCount - 1u ) / bandCount;
+
+  // The first band is counted here as the calling thread processes it itself. Rounding up the band
+  // size may leave fewer bands than asked for, so the others are counted as they are queued.
+  Job job = { &processRows, 1u };
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    for( unsigned int startRow = rowsPerBand; startRow < height; startRow += rowsPerBand )
+    {
+      mBands.push_back( Band{ &job, startRow, std::min( startRow + rowsPerBand, height ) } );
+      ++job.remainingBands;
+    }
+    mConditionalWait.Notify( lock );
+  }
+
+  processRows( 0u, std::min( rowsPerBand, height ) );
+  FinishBand( job );
+
+  // Help with any queued band rather than just waiting for the workers.
+  while( true )
+  {
+    Band band = { nullptr, 0u, 0u };
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      if( job.remainingBands == 0u )
+      {
+        break;
+      }
+
+      if( mBands.empty() )
+      {
+        mConditionalWait.Wait( lock );
+        continue;
+      }
+
+      band = mBands.front();
+      mBands.pop_front();
+    }
+
+    ( *band.job->processRows )( band.startRow, band.endRow );
+    FinishBand( *band.job );
+  }
+}
+
+void ImageProcessingThreadPool::FinishBand( Job& job )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( --job.remainingBands == 0u )
+  {
+    // Wakes up the thread waiting for the job. The job must not be used after this as that thread may return.
+    mConditionalWait.Notify( lock );
+  }
+}
+
+void ImageProcessingThreadPool::Run()
+{
+  while( true )
+  {
+    Band band = { nullptr, 0u, 0u };
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      while( !mTerminate && mBands.empty() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      if( mTerminate )
+      {
+        break;
+      }
+
+      band = mBands.front();
+      mBands.pop_front();
+    }
+
+    ( *band.job->processRows )( band.startRow, band.endRow );
+    FinishBand( *band.job );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
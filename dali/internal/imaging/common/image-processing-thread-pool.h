@@ -0,0 +1,143 @@
+#ifndef DALI_INTERNAL_ADAPTOR_IMAGE_PROCESSING_THREAD_POOL_H
+#define DALI_INTERNAL_ADAPTOR_IMAGE_PROCESSING_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief A pool of threads shared by the image processing operations which split their work into bands of rows.
+ *
+ * The threads are started the first time the pool is used and live until the process exits. The number of
+ * threads, counting the calling one, is the number of cores up to four, and can be changed with the
+ * DALI_IMAGE_PROCESSING_THREADS environment variable.
+ *
+ * The pool can be used from several threads at once, including from inside a band: a thread waiting for
+ * its bands to finish processes the queued bands of any caller, so nested use can't deadlock.
+ */
+class ImageProcessingThreadPool
+{
+public:
+
+  typedef std::function< void( unsigned int, unsigned int ) > RowFunction; ///< Called with the first and one past the last row of a band
+
+  /**
+   * @brief Retrieves the pool, starting its threads on first use.
+   */
+  static ImageProcessingThreadPool& Get();
+
+  /**
+   * @brief Retrieves the maximum number of threads processing the bands of one image, counting the calling thread.
+   */
+  static unsigned int GetMaximumThreadCount();
+
+  /**
+   * @brief Splits the rows of an image into bands and processes them in parallel, returning when they are all done.
+   *
+   * Small images are processed on the calling thread without using the pool.
+   *
+   * @param[in] width The width of the image, used with the height to decide whether splitting is worthwhile
+   * @param[in] height The number of rows of the image
+   * @param[in] processRows Called for each band, possibly on several threads at once
+   */
+  static void ProcessRowsInParallel( unsigned int width, unsigned int height, const RowFunction& processRows );
+
+  /**
+   * @brief Splits the rows into the given number of bands and processes them in parallel.
+   *
+   * @param[in] height The number of rows
+   * @param[in] bandCount The number of bands, at least one
+   * @param[in] processRows Called for each band, possibly on several threads at once
+   */
+  void ProcessBands( unsigned int height, unsigned int bandCount, const RowFunction& processRows );
+
+  /**
+   * @brief Destructor. Stops the threads.
+   */
+  ~ImageProcessingThreadPool();
+
+private:
+
+  /**
+   * @brief Constructor. Starts the threads.
+   *
+   * @param[in] numberOfThreads The number of threads to start
+   */
+  explicit ImageProcessingThreadPool( unsigned int numberOfThreads );
+
+  // Undefined
+  ImageProcessingThreadPool( const ImageProcessingThreadPool& ) = delete;
+  ImageProcessingThreadPool& operator=( const ImageProcessingThreadPool& ) = delete;
+
+  /**
+   * @brief The bands of one call of ProcessBands().
+   */
+  struct Job
+  {
+    const RowFunction* processRows;   ///< The function processing the bands
+    unsigned int       remainingBands; ///< The bands which are queued or being processed
+  };
+
+  /**
+   * @brief A band waiting to be processed.
+   */
+  struct Band
+  {
+    Job*         job;      ///< The call the band belongs to
+    unsigned int startRow; ///< The first row of the band
+    unsigned int endRow;   ///< One past the last row of the band
+  };
+
+  /**
+   * @brief Marks a band of the job as done, waking up the thread waiting for the job if it was the last one.
+   */
+  void FinishBand( Job& job );
+
+  /**
+   * @brief The loop of a worker thread.
+   */
+  void Run();
+
+private:
+
+  ConditionalWait            mConditionalWait; ///< Guards the queue; waited on for bands to process or to finish
+  std::deque< Band >         mBands;           ///< The bands waiting to be processed
+  std::vector< std::thread > mThreads;         ///< The worker threads
+  bool                       mTerminate;       ///< Whether the worker threads should stop
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_IMAGE_PROCESSING_THREAD_POOL_H
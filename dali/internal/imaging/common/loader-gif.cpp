@@ -21,6 +21,8 @@
 
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 // We need to check if giflib has the new open and close API (including error parameter).
@@ -85,6 +87,14 @@ const InterlacePair INTERLACE_PAIR_TABLE [] = {
 };
 const unsigned int INTERLACE_PAIR_TABLE_SIZE( sizeof( INTERLACE_PAIR_TABLE ) / sizeof( InterlacePair ) );
 
+/// The image file mapped in memory, and the position Gif_Lib has read up to.
+struct MemoryInput
+{
+  const GifByteType* data;
+  size_t             size;
+  size_t             position;
+};
+
 /// Function used by Gif_Lib to read from the image file.
 int ReadDataFromGif(GifFileType *gifInfo, GifByteType *data, int length)
 {
@@ -92,15 +102,41 @@ int ReadDataFromGif(GifFileType *gifInfo, GifByteType *data, int length)
   return fread( data, sizeof( GifByteType ), length, fp);
 }
 
-/// Loads the GIF Header.
-bool LoadGifHeader(FILE *fp, unsigned int &width, unsigned int &height, GifFileType** gifInfo)
+/// Function used by Gif_Lib to read from the image file mapped in memory.
+int ReadDataFromGifMemory(GifFileType *gifInfo, GifByteType *data, int length)
+{
+  MemoryInput *memoryInput = reinterpret_cast<MemoryInput*>(gifInfo->UserData);
+  if( length <= 0 )
+  {
+    return 0;
+  }
+
+  const size_t count = std::min( static_cast<size_t>( length ), memoryInput->size - memoryInput->position );
+  memcpy( data, memoryInput->data + memoryInput->position, count );
+  memoryInput->position += count;
+  return static_cast<int>( count );
+}
+
+/// Loads the GIF Header, reading from the mapped file if there is one.
+bool LoadGifHeader(const Dali::ImageLoader::Input& input, MemoryInput& memoryInput, unsigned int &width, unsigned int &height, GifFileType** gifInfo)
 {
   int errorCode = 0; //D_GIF_SUCCEEDED is 0
 
+  void* userData = reinterpret_cast<void*>(input.file);
+  InputFunc readFunction = ReadDataFromGif;
+  if( input.data != nullptr )
+  {
+    memoryInput.data = input.data;
+    memoryInput.size = input.dataSize;
+    memoryInput.position = 0u;
+    userData = &memoryInput;
+    readFunction = ReadDataFromGifMemory;
+  }
+
 #ifdef LIBGIF_VERSION_5_1_OR_ABOVE
-  *gifInfo = DGifOpen( reinterpret_cast<void*>(fp), ReadDataFromGif, &errorCode );
+  *gifInfo = DGifOpen( userData, readFunction, &errorCode );
 #else
-  *gifInfo = DGifOpen( reinterpret_cast<void*>(fp), ReadDataFromGif );
+  *gifInfo = DGifOpen( userData, readFunction );
 #endif
 
   if ( !(*gifInfo) || errorCode )
@@ -273,22 +309,22 @@ bool HandleExtensionRecordType( GifFileType* gifInfo )
 
 bool LoadGifHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height )
 {
+  MemoryInput memoryInput = MemoryInput();
   GifFileType* gifInfo = NULL;
   AutoCleanupGif autoCleanupGif(gifInfo);
-  FILE* const fp = input.file;
 
-  return LoadGifHeader(fp, width, height, &gifInfo);
+  return LoadGifHeader(input, memoryInput, width, height, &gifInfo);
 }
 
 bool LoadBitmapFromGif( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
 {
-  FILE* const fp = input.file;
   // Load the GIF Header file.
 
+  MemoryInput memoryInput = MemoryInput();
   GifFileType* gifInfo( NULL );
   unsigned int width( 0 );
   unsigned int height( 0 );
-  if ( !LoadGifHeader( fp, width, height, &gifInfo ) )
+  if ( !LoadGifHeader( input, memoryInput, width, height, &gifInfo ) )
   {
     return false;
   }
@@ -19,10 +19,12 @@
 #include <dali/internal/imaging/common/loader-jpeg.h>
 
 // EXTERNAL HEADERS
+#include <algorithm>
 #include <functional>
 #include <array>
 #include <utility>
 #include <memory>
+#include <vector>
 #include <libexif/exif-data.h>
 #include <libexif/exif-loader.h>
 #include <libexif/exif-tag.h>
@@ -122,11 +124,43 @@ ExifHandle MakeNullExifData()
   return ExifHandle{nullptr, exif_data_free};
 }
 
-ExifHandle MakeExifDataFromData(unsigned char* data, unsigned int size)
+ExifHandle MakeExifDataFromData(const unsigned char* data, unsigned int size)
 {
   return ExifHandle{exif_data_new_from_data(data, size), exif_data_free};
 }
 
+/**
+ * @brief Retrieves the downscaling factors supported by TurboJPEG which are cheaper than a full decode.
+ *
+ * Reducing by 1/2, 1/4 or 1/8 skips the high frequency coefficients of the IDCT, so the decode time
+ * and memory drop with the output size. The other factors TurboJPEG offers (e.g. 15/8 or 3/8) would
+ * upscale or cost as much as a full decode followed by our own resampling.
+ * @return The factors 1/1, 1/2, 1/4 and 1/8, largest first, or an empty list on error.
+ */
+const std::vector<tjscalingfactor>& GetDownscalingFactors()
+{
+  static const std::vector<tjscalingfactor> downscalingFactors = []()
+  {
+    std::vector<tjscalingfactor> result;
+    int numFactors = 0;
+    const tjscalingfactor* factors = tjGetScalingFactors( &numFactors );
+    for( int i = 0; factors != NULL && i < numFactors; ++i )
+    {
+      const int denominator = factors[i].denom;
+      if( factors[i].num == 1 && denominator <= 8 && ( denominator & ( denominator - 1 ) ) == 0 )
+      {
+        result.push_back( factors[i] );
+      }
+    }
+    std::sort( result.begin(), result.end(), []( const tjscalingfactor& lhs, const tjscalingfactor& rhs )
+    {
+      return lhs.denom < rhs.denom;
+    } );
+    return result;
+  }();
+  return downscalingFactors;
+}
+
 // Helpers for safe Jpeg memory handling
 using JpegHandle = std::unique_ptr<void /*tjhandle*/, decltype(tjDestroy)*>;
 
@@ -533,52 +567,60 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
   const int flags= 0;
   FILE* const fp = input.file;
 
-  if( fseek(fp,0,SEEK_END) )
-  {
-    DALI_LOG_ERROR("Error seeking to end of file\n");
-    return false;
-  }
+  // Decode straight from the mapped file when there is one, otherwise read the file into memory.
+  const unsigned char* jpegBufferPtr = input.data;
+  unsigned int jpegBufferSize = static_cast<unsigned int>( input.dataSize );
+  Vector<unsigned char> jpegBuffer;
 
-  long positionIndicator = ftell(fp);
-  unsigned int jpegBufferSize = 0u;
-  if( positionIndicator > -1L )
+  if( jpegBufferPtr == nullptr )
   {
-    jpegBufferSize = static_cast<unsigned int>(positionIndicator);
-  }
+    if( fseek(fp,0,SEEK_END) )
+    {
+      DALI_LOG_ERROR("Error seeking to end of file\n");
+      return false;
+    }
 
-  if( 0u == jpegBufferSize )
-  {
-    return false;
-  }
+    long positionIndicator = ftell(fp);
+    jpegBufferSize = 0u;
+    if( positionIndicator > -1L )
+    {
+      jpegBufferSize = static_cast<unsigned int>(positionIndicator);
+    }
 
-  if( fseek(fp, 0, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
-    return false;
-  }
+    if( 0u == jpegBufferSize )
+    {
+      return false;
+    }
 
-  Vector<unsigned char> jpegBuffer;
-  try
-  {
-    jpegBuffer.Resize( jpegBufferSize );
-  }
-  catch(...)
-  {
-    DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
-    return false;
-  }
-  unsigned char * const jpegBufferPtr = jpegBuffer.Begin();
+    if( fseek(fp, 0, SEEK_SET) )
+    {
+      DALI_LOG_ERROR("Error seeking to start of file\n");
+      return false;
+    }
 
-  // Pull the compressed JPEG image bytes out of a file and into memory:
-  if( fread( jpegBufferPtr, 1, jpegBufferSize, fp ) != jpegBufferSize )
-  {
-    DALI_LOG_WARNING("Error on image file read.\n");
-    return false;
-  }
+    try
+    {
+      jpegBuffer.Resize( jpegBufferSize );
+    }
+    catch(...)
+    {
+      DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
+      return false;
+    }
 
-  if( fseek(fp, 0, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
+    // Pull the compressed JPEG image bytes out of a file and into memory:
+    if( fread( jpegBuffer.Begin(), 1, jpegBufferSize, fp ) != jpegBufferSize )
+    {
+      DALI_LOG_WARNING("Error on image file read.\n");
+      return false;
+    }
+
+    if( fseek(fp, 0, SEEK_SET) )
+    {
+      DALI_LOG_ERROR("Error seeking to start of file\n");
+    }
+
+    jpegBufferPtr = jpegBuffer.Begin();
   }
 
   auto jpeg = MakeJpegDecompressor();
@@ -819,7 +861,8 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
 }
 
 bool EncodeToJpeg( const unsigned char* const pixelBuffer, Vector< unsigned char >& encodedPixels,
-                   const std::size_t width, const std::size_t height, const Pixel::Format pixelFormat, unsigned quality )
+                   const std::size_t width, const std::size_t height, const Pixel::Format pixelFormat, unsigned quality,
+                   EncodingOptions::JpegSubsampling subsampling )
 {
 
   if( !pixelBuffer )
@@ -869,6 +912,30 @@ bool EncodeToJpeg( const unsigned char* const pixelBuffer, Vector< unsigned char
     quality = 100;
   }
 
+  int jpegSubsampling = TJSAMP_444;
+  switch( subsampling )
+  {
+    case EncodingOptions::JpegSubsampling::SUBSAMPLING_422:
+    {
+      jpegSubsampling = TJSAMP_422;
+      break;
+    }
+    case EncodingOptions::JpegSubsampling::SUBSAMPLING_420:
+    {
+      jpegSubsampling = TJSAMP_420;
+      break;
+    }
+    case EncodingOptions::JpegSubsampling::GRAYSCALE:
+    {
+      jpegSubsampling = TJSAMP_GRAY;
+      break;
+    }
+    case EncodingOptions::JpegSubsampling::SUBSAMPLING_444:
+    {
+      break;
+    }
+  }
+
   // Initialise a JPEG codec:
   {
     auto jpeg = MakeJpegCompressor();
@@ -892,7 +959,7 @@ bool EncodeToJpeg( const unsigned char* const pixelBuffer, Vector< unsigned char
                      const_cast<unsigned char*>(pixelBuffer),
                      width, 0, height,
                      jpegPixelFormat, SetPointer(dstBuffer), &dstBufferSize,
-                     TJSAMP_444, quality, flags ) )
+                     jpegSubsampling, quality, flags ) )
     {
       DALI_LOG_ERROR("JPEG Compression failed: %s\n", tjGetErrorStr());
       return false;
@@ -986,12 +1053,11 @@ bool TransformSize( int requiredWidth, int requiredHeight,
   requiredHeight = correctedDesired.GetHeight();
 
   // Rescale image during decode using one of the decoder's built-in rescaling
-  // ratios (expected to be powers of 2), keeping the final image at least as
-  // wide and high as was requested:
-
-  int numFactors = 0;
-  tjscalingfactor* factors = tjGetScalingFactors( &numFactors );
-  if( factors == NULL )
+  // ratios (powers of 2), keeping the final image at least as wide and high as
+  // was requested. The resampler then only has to scale the much smaller image:
+  const std::vector<tjscalingfactor>& factors = GetDownscalingFactors();
+  const int numFactors = static_cast<int>( factors.size() );
+  if( numFactors == 0 )
   {
     DALI_LOG_WARNING("TurboJpeg tjGetScalingFactors error!\n");
     success = false;
@@ -1021,10 +1087,11 @@ bool TransformSize( int requiredWidth, int requiredHeight,
       }
     }
 
+    // The first factor is 1/1, i.e. the image is never upscaled while decoding.
     int scaleFactorIndex( 0 );
     if( downscale )
     {
-      // Find nearest supported scaling factor (factors are in sequential order, getting smaller)
+      // Find the largest reduction (factors are in order, getting smaller) which keeps the image within our fitting mode constraint
       for( int i = 1; i < numFactors; ++i )
       {
         bool widthLessRequired  = TJSCALED( postXformImageWidth,  factors[i]) < requiredWidth;
@@ -23,6 +23,7 @@
 #include <dali/public-api/images/pixel.h>
 #include <dali/internal/legacy/tizen/image-encoder.h>
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
 
 namespace Dali
 {
@@ -73,8 +74,9 @@ bool LoadJpegHeader( const Dali::ImageLoader::Input& input, unsigned int& width,
  * @param[in]  height         Image height
  * @param[in]  pixelFormat    Input pixel format (must be Pixel::RGB888)
  * @param[in]  quality        JPEG quality on usual 1 to 100 scale.
+ * @param[in]  subsampling    The chroma subsampling
  */
-bool EncodeToJpeg(const unsigned char* pixelBuffer, Vector< unsigned char >& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, unsigned quality = 80);
+bool EncodeToJpeg(const unsigned char* pixelBuffer, Vector< unsigned char >& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, unsigned quality = 80, EncodingOptions::JpegSubsampling subsampling = EncodingOptions::JpegSubsampling::SUBSAMPLING_444);
 
 } // namespace TizenPlatform
 
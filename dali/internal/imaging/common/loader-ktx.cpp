@@ -555,18 +555,31 @@ bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
 
   // Skip the key-values:
   const long int imageSizeOffset = sizeof(KtxFileHeader) + fileHeader.bytesOfKeyValueData;
-  if(fseek(fp, imageSizeOffset, SEEK_SET))
+  uint32_t imageByteCount = 0;
+  if( input.data != nullptr )
   {
-    DALI_LOG_ERROR( "Seek past key/vals in KTX compressed bitmap file failed.\n" );
-    return false;
+    // Load the size of the image data from the mapped file:
+    if( input.dataSize < static_cast<size_t>( imageSizeOffset ) + 4u )
+    {
+      DALI_LOG_ERROR( "Read of image size failed.\n" );
+      return false;
+    }
+    memcpy( &imageByteCount, input.data + imageSizeOffset, 4 );
   }
-
-  // Load the size of the image data:
-  uint32_t imageByteCount = 0;
-  if ( fread( &imageByteCount, 1, 4, fp ) != 4 )
+  else
   {
-    DALI_LOG_ERROR( "Read of image size failed.\n" );
-    return false;
+    if(fseek(fp, imageSizeOffset, SEEK_SET))
+    {
+      DALI_LOG_ERROR( "Seek past key/vals in KTX compressed bitmap file failed.\n" );
+      return false;
+    }
+
+    // Load the size of the image data:
+    if ( fread( &imageByteCount, 1, 4, fp ) != 4 )
+    {
+      DALI_LOG_ERROR( "Read of image size failed.\n" );
+      return false;
+    }
   }
   // Sanity-check the image size:
   if( imageByteCount > MAX_IMAGE_DATA_SIZE ||
@@ -604,11 +617,25 @@ bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
     return false;
   }
 
-  const size_t bytesRead = fread(pixels, 1, imageByteCount, fp);
-  if(bytesRead != imageByteCount)
+  if( input.data != nullptr )
   {
-    DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
-    return false;
+    // Copy the image bytes straight from the mapped file:
+    const size_t imageDataOffset = static_cast<size_t>( imageSizeOffset ) + 4u;
+    if( input.dataSize - imageDataOffset < imageByteCount )
+    {
+      DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
+      return false;
+    }
+    memcpy( pixels, input.data + imageDataOffset, imageByteCount );
+  }
+  else
+  {
+    const size_t bytesRead = fread(pixels, 1, imageByteCount, fp);
+    if(bytesRead != imageByteCount)
+    {
+      DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
+      return false;
+    }
   }
 
   return true;
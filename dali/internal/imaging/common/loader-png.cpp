@@ -17,6 +17,7 @@
 
 #include <dali/internal/imaging/common/loader-png.h>
 
+#include <algorithm>
 #include <cstring>
 
 #include <zlib.h>
@@ -402,7 +403,7 @@ namespace
  * 7. If caller asks for no compression, bypass libpng and blat raw data to
  *    disk, topped and tailed with header/tail blocks.
  */
-bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat )
+bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, const EncodingOptions& options )
 {
   // Translate pixel format enum:
   int pngPixelFormat = -1;
@@ -465,24 +466,41 @@ bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>&
   // Vector buffer each time it calls back to flush data to "file":
   png_set_write_fn(png_ptr, &encodedPixels, WriteData, FlushData);
 
-  // png_set_compression_level( png_ptr, Z_BEST_COMPRESSION);
-  png_set_compression_level(png_ptr, Z_BEST_SPEED);
-  // png_set_compression_level( png_ptr, Z_NO_COMPRESSION); //! We could just generate png directly without libpng in this case.
-
-  // Explicitly limit the number of filters used per scanline to speed us up:
-  // png_set_filter(png_ptr, 0, PNG_FILTER_NONE); ///!ToDo: Try this once baseline profile is in place.
-       // PNG_FILTER_SUB   |
-       // PNG_FILTER_UP    |
-       // PNG_FILTER_AVE   |
-       // PNG_FILTER_PAETH |
-       // PNG_ALL_FILTERS);
-  // Play with Zlib parameters in optimisation phase:
-    // png_set_compression_mem_level(png_ptr, 8);
-    // png_set_compression_strategy(png_ptr,
-        // Z_DEFAULT_STRATEGY);
-    // png_set_compression_window_bits(png_ptr, 15);
-    // png_set_compression_method(png_ptr, 8);
-    // png_set_compression_buffer_size(png_ptr, 8192)
+  png_set_compression_level( png_ptr, std::min( std::max( options.pngCompressionLevel, Z_NO_COMPRESSION ), Z_BEST_COMPRESSION ) );
+
+  // Without a filter set, libpng tries all of them for every row.
+  switch( options.pngFilter )
+  {
+    case EncodingOptions::PngFilter::NONE:
+    {
+      png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE );
+      break;
+    }
+    case EncodingOptions::PngFilter::SUB:
+    {
+      png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB );
+      break;
+    }
+    case EncodingOptions::PngFilter::UP:
+    {
+      png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_UP );
+      break;
+    }
+    case EncodingOptions::PngFilter::AVERAGE:
+    {
+      png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_AVG );
+      break;
+    }
+    case EncodingOptions::PngFilter::PAETH:
+    {
+      png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_PAETH );
+      break;
+    }
+    case EncodingOptions::PngFilter::ADAPTIVE:
+    {
+      break;
+    }
+  }
 
   // Let lib_png know if the pixel bytes are in BGR(A) order:
   if(!rgbaOrder)
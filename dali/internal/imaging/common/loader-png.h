@@ -23,6 +23,7 @@
 #include <dali/public-api/images/pixel.h>
 #include <dali/internal/legacy/tizen/image-encoder.h>
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
 
 namespace Dali
 {
@@ -68,8 +69,9 @@ bool LoadPngHeader( const Dali::ImageLoader::Input& input, unsigned int& width,
  * @param[in]  width          Image width
  * @param[in]  height         Image height
  * @param[in]  pixelFormat    Input pixel format (must be Pixel::RGB888)
+ * @param[in]  options        The zlib compression level and the row filter
  */
-bool EncodeToPng( const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat );
+bool EncodeToPng( const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, const EncodingOptions& options = EncodingOptions() );
 
 } // namespace TizenPlatform
 
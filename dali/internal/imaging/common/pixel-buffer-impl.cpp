@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <stdlib.h>
+#include <algorithm>
 #include <cstring>
 
 // INTERNAL INCLUDES
@@ -27,6 +28,9 @@
 #include <dali/internal/imaging/common/alpha-mask.h>
 #include <dali/internal/imaging/common/gaussian-blur.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/image-processing-thread-pool.h>
+#include <dali/internal/imaging/common/pixel-buffer-pool.h>
+#include <dali/internal/imaging/common/pixel-converters.h>
 
 namespace Dali
 {
@@ -40,6 +44,241 @@ namespace Adaptor
 namespace
 {
 const float TWO_PI = 2.f * Math::PI; ///< 360 degrees in radians
+const uint8_t OPAQUE_BYTE = 4u;      ///< The index of the constant opaque byte in RowOperations::ProcessPixels()
+
+/**
+ * @brief Whether PixelBuffer::ConvertPixelFormat() can convert from a pixel format: the formats whose
+ * channels are read by ConvertColorChannelsToRGBA8888() and ConvertAlphaChannelToA8().
+ */
+bool IsConversionSource( Pixel::Format pixelFormat )
+{
+  switch( pixelFormat )
+  {
+    case Pixel::A8:
+    case Pixel::L8:
+    case Pixel::LA88:
+    case Pixel::RGB565:
+    case Pixel::BGR565:
+    case Pixel::RGBA4444:
+    case Pixel::BGRA4444:
+    case Pixel::RGBA5551:
+    case Pixel::BGRA5551:
+    case Pixel::RGB888:
+    case Pixel::RGB8888:
+    case Pixel::BGR8888:
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Whether PixelBuffer::ConvertPixelFormat() can convert to a pixel format.
+ */
+bool IsConversionTarget( Pixel::Format pixelFormat )
+{
+  switch( pixelFormat )
+  {
+    case Pixel::A8:
+    case Pixel::RGB888:
+    case Pixel::RGB8888:
+    case Pixel::BGR8888:
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief The per pixel operations of PixelBuffer::ApplyOperations(), done together on each row of a
+ * RGBA8888 or BGRA8888 buffer.
+ *
+ * The results are the same as the ones of ApplyMaskToAlphaChannel(), PixelBuffer::MultiplyColorByAlpha()
+ * and PixelBuffer::ConvertPixelFormat(), but the channels are read once per pixel instead of through
+ * ReadChannel() and WriteChannel() once per channel and per operation.
+ */
+class RowOperations
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] buffer The buffer processed
+   * @param[in] mask The mask to apply, of the size of the buffer, or nullptr
+   * @param[in] multiplyColorByAlpha Whether to multiply the color values by the alpha value
+   * @param[in] pixelFormat The pixel format of the rows written
+   */
+  RowOperations( const PixelBuffer& buffer, const PixelBuffer* mask, bool multiplyColorByAlpha, Pixel::Format pixelFormat )
+  : mMask( nullptr ),
+    mMaskStride( 0u ),
+    mMaskBytesPerPixel( 0u ),
+    mMaskAlphaMask( 0 ),
+    mWidth( buffer.GetWidth() ),
+    mOutputBytesPerPixel( Pixel::GetBytesPerPixel( pixelFormat ) ),
+    mMultiplyColorByAlpha( multiplyColorByAlpha ),
+    mIsConverting( pixelFormat != buffer.GetPixelFormat() )
+  {
+    if( mask )
+    {
+      // The same alpha channel as ApplyMaskToAlphaChannel() reads.
+      const Pixel::Format maskFormat = mask->GetPixelFormat();
+      int maskAlphaByteOffset = 0;
+      if( Pixel::HasAlpha( maskFormat ) )
+      {
+        Pixel::GetAlphaOffsetAndMask( maskFormat, maskAlphaByteOffset, mMaskAlphaMask );
+      }
+      else if( maskFormat == Pixel::L8 )
+      {
+        mMaskAlphaMask = 0xFF;
+      }
+
+      mMaskBytesPerPixel = Pixel::GetBytesPerPixel( maskFormat );
+      mMaskStride = mMaskBytesPerPixel * mask->GetWidth();
+      mMask = mask->GetBuffer() + maskAlphaByteOffset;
+
+      for( unsigned int alpha = 0u; alpha < 256u; ++alpha )
+      {
+        mMaskScale[alpha] = float( alpha ) / 255.0f;
+      }
+    }
+
+    // The byte of the pixel, as it is after masking and multiplying, written to each byte of the output.
+    const bool isBgra = buffer.GetPixelFormat() == Pixel::BGRA8888;
+    const uint8_t red = isBgra ? 2u : 0u;
+    const uint8_t blue = isBgra ? 0u : 2u;
+    switch( pixelFormat )
+    {
+      case Pixel::A8:
+      {
+        SetLayout( 3u, 0u, 0u, 0u );
+        break;
+      }
+      case Pixel::RGB888:
+      {
+        SetLayout( red, 1u, blue, 0u );
+        break;
+      }
+      case Pixel::RGB8888:
+      {
+        SetLayout( red, 1u, blue, OPAQUE_BYTE );
+        break;
+      }
+      case Pixel::BGR8888:
+      {
+        SetLayout( blue, 1u, red, OPAQUE_BYTE );
+        break;
+      }
+      case Pixel::BGRA8888:
+      {
+        SetLayout( blue, 1u, red, 3u );
+        break;
+      }
+      default:
+      {
+        SetLayout( red, 1u, blue, 3u );
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Whether there's anything to do.
+   */
+  bool IsEmpty() const
+  {
+    return !mMask && !mMultiplyColorByAlpha && !mIsConverting;
+  }
+
+  /**
+   * @brief Processes a row. Thread safe.
+   * @param[in] in The row read
+   * @param[out] out The row written, which may be the row read if the pixel format doesn't change
+   * @param[in] y The index of the row
+   */
+  void Process( const uint8_t* in, uint8_t* out, unsigned int y ) const
+  {
+    const uint8_t* mask = mMask ? mMask + y * mMaskStride : nullptr;
+    if( mMultiplyColorByAlpha )
+    {
+      mask ? ProcessPixels< true, true >( in, out, mask ) : ProcessPixels< false, true >( in, out, mask );
+    }
+    else
+    {
+      mask ? ProcessPixels< true, false >( in, out, mask ) : ProcessPixels< false, false >( in, out, mask );
+    }
+  }
+
+private:
+
+  /**
+   * @brief Sets the byte of the pixel written to each byte of the output pixel.
+   */
+  void SetLayout( uint8_t first, uint8_t second, uint8_t third, uint8_t fourth )
+  {
+    mLayout[0] = first;
+    mLayout[1] = second;
+    mLayout[2] = third;
+    mLayout[3] = fourth;
+  }
+
+  /**
+   * @brief Processes the pixels of a row, with the operations known at compile time so the loop doesn't test them.
+   */
+  template< bool MASK, bool MULTIPLY >
+  void ProcessPixels( const uint8_t* in, uint8_t* out, const uint8_t* mask ) const
+  {
+    uint8_t pixel[5];
+    pixel[OPAQUE_BYTE] = 0xFF;
+
+    for( unsigned int x = 0u; x < mWidth; ++x, in += 4u )
+    {
+      unsigned int alpha = in[3];
+      if( MASK )
+      {
+        alpha = static_cast<uint8_t>( std::min( float( alpha ) * mMaskScale[*mask & mMaskAlphaMask], 255.0f ) );
+        mask += mMaskBytesPerPixel;
+      }
+
+      for( unsigned int channel = 0u; channel < 3u; ++channel )
+      {
+        pixel[channel] = MULTIPLY ? static_cast<uint8_t>( in[channel] * alpha / 255u ) : in[channel];
+      }
+      pixel[3] = static_cast<uint8_t>( alpha );
+
+      // The pixel is read before it's written, so the output may be the input.
+      for( unsigned int byte = 0u; byte < mOutputBytesPerPixel; ++byte )
+      {
+        *out++ = pixel[mLayout[byte]];
+      }
+    }
+  }
+
+private:
+
+  const uint8_t* mMask;                ///< The alpha channel of the first pixel of the mask, or nullptr
+  unsigned int   mMaskStride;          ///< The size of a row of the mask in bytes
+  unsigned int   mMaskBytesPerPixel;   ///< The size of a pixel of the mask in bytes
+  int            mMaskAlphaMask;       ///< The bits of the alpha channel of the mask
+  float          mMaskScale[256];      ///< The value of each mask alpha from 0 to 1
+  unsigned int   mWidth;               ///< The width of the buffer in pixels
+  unsigned int   mOutputBytesPerPixel; ///< The size of an output pixel in bytes
+  uint8_t        mLayout[4];           ///< The byte of the pixel written to each byte of the output pixel
+  bool           mMultiplyColorByAlpha;///< Whether to multiply the color values by the alpha value
+  bool           mIsConverting;        ///< Whether the output format is not the format of the buffer
+};
+
 } // namespace
 
 PixelBuffer::PixelBuffer( unsigned char* buffer,
@@ -53,7 +292,8 @@ PixelBuffer::PixelBuffer( unsigned char* buffer,
   mWidth( width ),
   mHeight( height ),
   mPixelFormat( pixelFormat ),
-  mPreMultiplied( false )
+  mPreMultiplied( false ),
+  mIsBufferPooled( false )
 {
 }
 
@@ -70,9 +310,11 @@ PixelBufferPtr PixelBuffer::New( unsigned int width,
   unsigned char* buffer = NULL;
   if( bufferSize > 0 )
   {
-    buffer = static_cast<unsigned char*>( malloc ( bufferSize ) );
+    buffer = PixelBufferPool::Get().Allocate( bufferSize );
   }
-  return new PixelBuffer( buffer, bufferSize, width, height, pixelFormat );
+  PixelBufferPtr pixelBuffer = new PixelBuffer( buffer, bufferSize, width, height, pixelFormat );
+  pixelBuffer->mIsBufferPooled = true;
+  return pixelBuffer;
 }
 
 PixelBufferPtr PixelBuffer::New( unsigned char* buffer,
@@ -92,10 +334,12 @@ Dali::PixelData PixelBuffer::Convert( PixelBuffer& pixelBuffer )
                                                     pixelBuffer.mHeight,
                                                     pixelBuffer.mPixelFormat,
                                                     Dali::PixelData::FREE );
+  // The pooled buffers are allocated with malloc(), so they can be freed by the PixelData.
   pixelBuffer.mBuffer = NULL;
   pixelBuffer.mWidth = 0;
   pixelBuffer.mHeight = 0;
   pixelBuffer.mBufferSize = 0;
+  pixelBuffer.mIsBufferPooled = false;
 
   return pixelData;
 }
@@ -148,31 +392,30 @@ Dali::PixelData PixelBuffer::CreatePixelData() const
 }
 
 void PixelBuffer::ApplyMask( const PixelBuffer& inMask, float contentScale, bool cropToMask )
+{
+  PixelBufferPtr resizedMask;
+  ApplyMaskInternal( FitMask( inMask, contentScale, cropToMask, resizedMask ) );
+}
+
+const PixelBuffer& PixelBuffer::FitMask( const PixelBuffer& inMask, float contentScale, bool cropToMask, PixelBufferPtr& resizedMask )
 {
   if( cropToMask )
   {
     // First scale this buffer by the contentScale, and crop to the mask size
     // If it's too small, then scale the mask to match the image size
-    // Then apply the mask
     ScaleAndCrop( contentScale, ImageDimensions( inMask.GetWidth(), inMask.GetHeight() ) );
 
     if( inMask.mWidth > mWidth || inMask.mHeight > mHeight )
     {
-      PixelBufferPtr mask = NewResize( inMask, ImageDimensions( mWidth, mHeight ) );
-      ApplyMaskInternal( *mask );
-    }
-    else
-    {
-      ApplyMaskInternal( inMask );
+      resizedMask = NewResize( inMask, ImageDimensions( mWidth, mHeight ) );
+      return *resizedMask;
     }
+    return inMask;
   }
-  else
-  {
-    // First, scale the mask to match the image size,
-    // then apply the mask.
-    PixelBufferPtr mask = NewResize( inMask, ImageDimensions( mWidth, mHeight ) );
-    ApplyMaskInternal( *mask );
-  }
+
+  // Scale the mask to match the image size
+  resizedMask = NewResize( inMask, ImageDimensions( mWidth, mHeight ) );
+  return *resizedMask;
 }
 
 void PixelBuffer::ApplyMaskInternal( const PixelBuffer& mask )
@@ -204,21 +447,31 @@ void PixelBuffer::TakeOwnershipOfBuffer( PixelBuffer& pixelBuffer )
   mWidth = pixelBuffer.mWidth;
   mHeight = pixelBuffer.mHeight;
   mPixelFormat = pixelBuffer.mPixelFormat;
+  mIsBufferPooled = pixelBuffer.mIsBufferPooled;
 }
 
 void PixelBuffer::ReleaseBuffer()
 {
   if( mBuffer )
   {
-    free( mBuffer );
+    if( mIsBufferPooled )
+    {
+      PixelBufferPool::Get().Release( mBuffer, mBufferSize );
+    }
+    else
+    {
+      free( mBuffer );
+    }
+    mBuffer = NULL;
   }
 }
 
 void PixelBuffer::AllocateFixedSize( uint32_t size )
 {
   ReleaseBuffer();
-  mBuffer = reinterpret_cast<unsigned char*>(malloc( size ));
+  mBuffer = PixelBufferPool::Get().Allocate( size );
   mBufferSize = size;
+  mIsBufferPooled = true;
 }
 
 bool PixelBuffer::Rotate( Degree angle )
@@ -291,6 +544,7 @@ bool PixelBuffer::Rotate( Degree angle )
     mBuffer = pixelsOut;
     pixelsOut = nullptr;
     mBufferSize = mWidth * mHeight * pixelSize;
+    mIsBufferPooled = false;
   }
 
   return success;
@@ -442,29 +696,18 @@ void PixelBuffer::ApplyGaussianBlur( const float blurRadius )
 
 void PixelBuffer::MultiplyColorByAlpha()
 {
-  auto bytesPerPixel = Pixel::GetBytesPerPixel( mPixelFormat );
-
   // Compressed textures have unknown size of the pixel. Alpha premultiplication
   // must be skipped in such case
   if( Pixel::GetBytesPerPixel(mPixelFormat) && Pixel::HasAlpha(mPixelFormat) )
   {
-    unsigned char* pixel = mBuffer;
-    const unsigned int bufferSize = mWidth * mHeight;
-
-    for( unsigned int i=0; i<bufferSize; ++i )
+    MultiplyColorByAlphaRowFunction multiplyRow = GetMultiplyColorByAlphaRowFunction( mPixelFormat );
+    if( multiplyRow )
     {
-      unsigned int alpha = ReadChannel( pixel, mPixelFormat, Adaptor::ALPHA );
-      {
-        auto red       = ReadChannel( pixel, mPixelFormat, Adaptor::RED);
-        auto green     = ReadChannel( pixel, mPixelFormat, Adaptor::GREEN);
-        auto blue      = ReadChannel( pixel, mPixelFormat, Adaptor::BLUE);
-        auto luminance = ReadChannel( pixel, mPixelFormat, Adaptor::LUMINANCE);
-        WriteChannel( pixel, mPixelFormat, Adaptor::RED, red*alpha / 255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::GREEN, green*alpha/255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::BLUE, blue*alpha/255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::LUMINANCE, luminance*alpha/255 );
-      }
-      pixel += bytesPerPixel;
+      multiplyRow( mBuffer, mWidth * mHeight );
+    }
+    else
+    {
+      MultiplyColorByAlphaRow( mBuffer, mPixelFormat, mWidth * mHeight );
     }
   }
   mPreMultiplied = true;
@@ -475,6 +718,169 @@ bool PixelBuffer::IsAlphaPreMultiplied() const
   return mPreMultiplied;
 }
 
+void PixelBuffer::ApplyOperations( const Dali::Devel::PixelBuffer::Operations& operations )
+{
+  // The geometry changes first, as they change the number of pixels the other operations process.
+  if( operations.width > 0u && operations.height > 0u )
+  {
+    Resize( ImageDimensions( operations.width, operations.height ) );
+  }
+
+  PixelBufferPtr resizedMask;
+  const PixelBuffer* mask = nullptr;
+  if( operations.mask )
+  {
+    mask = &FitMask( GetImplementation( operations.mask ), operations.maskContentScale, operations.cropToMask, resizedMask );
+  }
+
+  // The format the fused operations write. When they aren't fused, masking may add an alpha channel,
+  // so the format is only converted if asked to.
+  const Pixel::Format pixelFormat = ( operations.pixelFormat == Pixel::INVALID ) ? mPixelFormat : operations.pixelFormat;
+
+  if( CanFuseOperations( mask, operations.blurRadius, pixelFormat ) )
+  {
+    ApplyFusedOperations( mask, operations.multiplyColorByAlpha, operations.blurRadius, pixelFormat );
+  }
+  else
+  {
+    if( mask )
+    {
+      ApplyMaskInternal( *mask );
+    }
+    if( operations.multiplyColorByAlpha )
+    {
+      MultiplyColorByAlpha();
+    }
+    if( operations.blurRadius > Math::MACHINE_EPSILON_1 )
+    {
+      ApplyGaussianBlur( operations.blurRadius );
+    }
+    if( operations.pixelFormat != Pixel::INVALID )
+    {
+      ConvertPixelFormat( operations.pixelFormat );
+    }
+  }
+}
+
+bool PixelBuffer::CanFuseOperations( const PixelBuffer* mask, float blurRadius, Pixel::Format pixelFormat ) const
+{
+  if( !mBuffer || mWidth == 0u || mHeight == 0u || ( mPixelFormat != Pixel::RGBA8888 && mPixelFormat != Pixel::BGRA8888 ) )
+  {
+    return false;
+  }
+
+  // Masking a premultiplied buffer scales the colors as well, which is left to ApplyMaskToAlphaChannel().
+  if( mask && ( mPreMultiplied || !mask->mBuffer || Pixel::GetBytesPerPixel( mask->mPixelFormat ) == 0u ) )
+  {
+    return false;
+  }
+
+  // Only RGBA8888 buffers are blurred.
+  if( blurRadius > Math::MACHINE_EPSILON_1 && mPixelFormat != Pixel::RGBA8888 )
+  {
+    return false;
+  }
+
+  return IsConversionTarget( pixelFormat );
+}
+
+void PixelBuffer::ApplyFusedOperations( const PixelBuffer* mask, bool multiplyColorByAlpha, float blurRadius, Pixel::Format pixelFormat )
+{
+  // Processes the rows in bands, in place if the pixel format doesn't change.
+  auto processRows = [this]( const RowOperations& rowOperations, Pixel::Format outFormat )
+  {
+    const unsigned int inStride = mWidth * Pixel::GetBytesPerPixel( mPixelFormat );
+    const unsigned int outStride = mWidth * Pixel::GetBytesPerPixel( outFormat );
+    const uint8_t* inPixels = mBuffer;
+    uint8_t* outPixels = mBuffer;
+
+    PixelBufferPtr outBuffer;
+    if( outFormat != mPixelFormat )
+    {
+      outBuffer = PixelBuffer::New( mWidth, mHeight, outFormat );
+      outPixels = outBuffer->mBuffer;
+    }
+
+    ImageProcessingThreadPool::ProcessRowsInParallel( mWidth, mHeight, [&]( unsigned int startRow, unsigned int endRow )
+    {
+      for( unsigned int y = startRow; y < endRow; ++y )
+      {
+        rowOperations.Process( inPixels + y * inStride, outPixels + y * outStride, y );
+      }
+    } );
+
+    if( outBuffer )
+    {
+      TakeOwnershipOfBuffer( *outBuffer );
+    }
+  };
+
+  if( blurRadius > Math::MACHINE_EPSILON_1 )
+  {
+    // The rows are masked and multiplied just before the first pass of the blur reads them. The
+    // format is converted after the blur, which only works on RGBA8888, in a pass of its own.
+    RowOperations rowOperations( *this, mask, multiplyColorByAlpha, mPixelFormat );
+    if( rowOperations.IsEmpty() )
+    {
+      PerformGaussianBlurRGBA( *this, blurRadius );
+    }
+    else
+    {
+      PerformGaussianBlurRGBA( *this, blurRadius, [&rowOperations]( uint8_t* row, unsigned int y )
+      {
+        rowOperations.Process( row, row, y );
+      } );
+    }
+
+    if( pixelFormat != mPixelFormat )
+    {
+      processRows( RowOperations( *this, nullptr, false, pixelFormat ), pixelFormat );
+    }
+  }
+  else
+  {
+    RowOperations rowOperations( *this, mask, multiplyColorByAlpha, pixelFormat );
+    if( !rowOperations.IsEmpty() )
+    {
+      processRows( rowOperations, pixelFormat );
+    }
+  }
+
+  if( multiplyColorByAlpha )
+  {
+    mPreMultiplied = true;
+  }
+}
+
+void PixelBuffer::ConvertPixelFormat( Pixel::Format pixelFormat )
+{
+  if( pixelFormat == mPixelFormat )
+  {
+    return;
+  }
+
+  if( !IsConversionSource( mPixelFormat ) || !IsConversionTarget( pixelFormat ) || !mBuffer )
+  {
+    DALI_LOG_ERROR( "Trying to convert a pixel buffer from or to an unsupported pixel format\n" );
+    return;
+  }
+
+  PixelBufferPtr outBuffer = PixelBuffer::New( mWidth, mHeight, pixelFormat );
+
+  // The rows are contiguous, so the whole buffer is converted as a single row.
+  ConvertRowFunction convertRow = GetConvertRowFunction( mPixelFormat, pixelFormat );
+  if( convertRow )
+  {
+    convertRow( mBuffer, outBuffer->mBuffer, mWidth * mHeight );
+  }
+  else
+  {
+    ConvertRow( mBuffer, mPixelFormat, outBuffer->mBuffer, pixelFormat, mWidth * mHeight );
+  }
+
+  TakeOwnershipOfBuffer( *outBuffer );
+}
+
 }// namespace Adaptor
 }// namespace Internal
 }// namespace Dali
@@ -47,7 +47,8 @@ public:
   /**
    * @brief Create a PixelBuffer object with a pre-allocated buffer.
    * The PixelBuffer object owns this buffer, which may be retrieved
-   * and modified using GetBuffer().
+   * and modified using GetBuffer(). The buffer is allocated from the
+   * PixelBufferPool.
    *
    * @param [in] width            Buffer width in pixels
    * @param [in] height           Buffer height in pixels
@@ -227,6 +228,18 @@ public:
    */
   bool IsAlphaPreMultiplied() const;
 
+  /**
+   * @copydoc Devel::PixelBuffer::ApplyOperations()
+   */
+  void ApplyOperations( const Dali::Devel::PixelBuffer::Operations& operations );
+
+  /**
+   * Converts the buffer to the given pixel format. The color channels are widened to 8 bits, and the
+   * alpha channel is opaque if this buffer has none.
+   * @param[in] pixelFormat The new pixel format, one of RGB888, RGB8888, BGR8888, RGBA8888, BGRA8888 or A8
+   */
+  void ConvertPixelFormat( Pixel::Format pixelFormat );
+
 private:
   /*
    * Undefined copy constructor.
@@ -243,13 +256,39 @@ private:
    */
   void ApplyMaskInternal( const PixelBuffer& mask );
 
+  /**
+   * Scales and crops this buffer, or scales the mask, as ApplyMask() does, so they have the same size.
+   * @param[in] mask The mask to apply to this pixel buffer
+   * @param[in] contentScale The scaling factor to apply to the content
+   * @param[in] cropToMask Whether to crop the output to the mask size (true) or scale the
+   * mask to the content size (false)
+   * @param[out] resizedMask Holds the scaled mask, if the mask needed scaling
+   * @return The mask to apply, either mask or resizedMask
+   */
+  const PixelBuffer& FitMask( const PixelBuffer& mask, float contentScale, bool cropToMask, PixelBufferPtr& resizedMask );
+
+  /**
+   * Whether ApplyFusedOperations() supports the given operations on this buffer.
+   */
+  bool CanFuseOperations( const PixelBuffer* mask, float blurRadius, Pixel::Format pixelFormat ) const;
+
+  /**
+   * Applies the mask, the multiplication by alpha and the conversion in a single traversal of the
+   * buffer, preparing the rows just before the blur reads them if the buffer is blurred.
+   * @param[in] mask The mask to apply, of the size of this buffer, or nullptr
+   * @param[in] multiplyColorByAlpha Whether to multiply the color values by the alpha value
+   * @param[in] blurRadius The radius of the Gaussian blur
+   * @param[in] pixelFormat The pixel format to convert to
+   */
+  void ApplyFusedOperations( const PixelBuffer* mask, bool multiplyColorByAlpha, float blurRadius, Pixel::Format pixelFormat );
+
   /**
    * Takes ownership of the other object's pixel buffer.
    */
   void TakeOwnershipOfBuffer( PixelBuffer& pixelBuffer );
 
   /**
-   * Release the buffer
+   * Release the buffer, returning it to the PixelBufferPool if it was allocated from it.
    */
   void ReleaseBuffer();
 
@@ -289,6 +328,7 @@ private:
   unsigned int                    mHeight;           ///< Buffer height in pixels
   Pixel::Format                   mPixelFormat;      ///< Pixel format
   bool                            mPreMultiplied; ///< PreMultiplied
+  bool                            mIsBufferPooled;   ///< Whether mBuffer was allocated from the PixelBufferPool
 };
 
 } // namespace Adaptor
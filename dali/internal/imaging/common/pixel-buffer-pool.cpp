@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/pixel-buffer-pool.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gPoolLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_PIXEL_BUFFER_POOL" );
+#endif
+
+const uint32_t MINIMUM_POOLED_SHIFT = 14u;         ///< Buffers up to 16 KB are not pooled.
+const uint32_t MAXIMUM_POOLED_SHIFT = 26u;         ///< Buffers above 64 MB are not pooled.
+const uint32_t CLASSES_PER_POWER_OF_TWO_SHIFT = 2u; ///< Four size classes per power of two, which wastes at most 20% of a buffer.
+const uint32_t CLASSES_PER_POWER_OF_TWO = 1u << CLASSES_PER_POWER_OF_TWO_SHIFT;
+const uint32_t CLASS_COUNT = ( MAXIMUM_POOLED_SHIFT - MINIMUM_POOLED_SHIFT ) * CLASSES_PER_POWER_OF_TWO;
+const size_t DEFAULT_MAXIMUM_CACHED_SIZE = 8u * 1024u * 1024u;
+
+} // unnamed namespace
+
+const uint32_t PixelBufferPool::NOT_POOLED;
+
+PixelBufferPool& PixelBufferPool::Get()
+{
+  // Never destroyed, as pixel buffers may be released by static objects at exit.
+  static PixelBufferPool* pool = []()
+  {
+    size_t maximumCachedSize = DEFAULT_MAXIMUM_CACHED_SIZE;
+    const char* environmentValue = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_PIXEL_BUFFER_POOL_SIZE );
+    if( environmentValue )
+    {
+      maximumCachedSize = static_cast<size_t>( std::strtoul( environmentValue, nullptr, 10 ) ) * 1024u;
+    }
+    return new PixelBufferPool( maximumCachedSize );
+  }();
+
+  return *pool;
+}
+
+PixelBufferPool::PixelBufferPool( size_t maximumCachedSize )
+: mMutex(),
+  mReleasedBuffers( CLASS_COUNT ),
+  mStatistics(),
+  mMaximumCachedSize( maximumCachedSize )
+{
+}
+
+PixelBufferPool::~PixelBufferPool()
+{
+  Trim();
+}
+
+unsigned char* PixelBufferPool::Allocate( size_t size )
+{
+  const uint32_t sizeClass = GetSizeClass( size );
+  if( NOT_POOLED == sizeClass )
+  {
+    return static_cast<unsigned char*>( malloc( size ) );
+  }
+
+  {
+    Mutex::ScopedLock lock( mMutex );
+    ++mStatistics.allocations;
+
+    std::vector<unsigned char*>& releasedBuffers = mReleasedBuffers[sizeClass];
+    if( !releasedBuffers.empty() )
+    {
+      unsigned char* buffer = releasedBuffers.back();
+      releasedBuffers.pop_back();
+
+      ++mStatistics.reuses;
+      --mStatistics.cachedBuffers;
+      mStatistics.cachedSize -= GetClassSize( sizeClass );
+      return buffer;
+    }
+  }
+
+  return static_cast<unsigned char*>( malloc( GetClassSize( sizeClass ) ) );
+}
+
+void PixelBufferPool::Release( unsigned char* buffer, size_t size )
+{
+  if( nullptr == buffer )
+  {
+    return;
+  }
+
+  const uint32_t sizeClass = GetSizeClass( size );
+  if( NOT_POOLED != sizeClass )
+  {
+    const size_t classSize = GetClassSize( sizeClass );
+
+    Mutex::ScopedLock lock( mMutex );
+    if( mStatistics.cachedSize + classSize <= mMaximumCachedSize )
+    {
+      mReleasedBuffers[sizeClass].push_back( buffer );
+
+      ++mStatistics.cachedBuffers;
+      mStatistics.cachedSize += classSize;
+      return;
+    }
+  }
+
+  free( buffer );
+}
+
+void PixelBufferPool::Trim()
+{
+  std::vector<std::vector<unsigned char*>> releasedBuffers( CLASS_COUNT );
+  {
+    Mutex::ScopedLock lock( mMutex );
+    releasedBuffers.swap( mReleasedBuffers );
+
+    DALI_LOG_INFO( gPoolLogFilter, Debug::General, "Trimming %u buffers, %u bytes\n", mStatistics.cachedBuffers, static_cast<uint32_t>( mStatistics.cachedSize ) );
+
+    mStatistics.cachedBuffers = 0u;
+    mStatistics.cachedSize = 0u;
+  }
+
+  for( auto& buffers : releasedBuffers )
+  {
+    for( auto buffer : buffers )
+    {
+      free( buffer );
+    }
+  }
+}
+
+PixelBufferPool::Statistics PixelBufferPool::GetStatistics() const
+{
+  Mutex::ScopedLock lock( mMutex );
+  return mStatistics;
+}
+
+uint32_t PixelBufferPool::GetSizeClass( size_t size )
+{
+  if( ( size <= ( size_t( 1u ) << MINIMUM_POOLED_SHIFT ) ) || ( size > ( size_t( 1u ) << MAXIMUM_POOLED_SHIFT ) ) )
+  {
+    return NOT_POOLED;
+  }
+
+  // The power of two below the size, and the quarter of it the size is rounded up to.
+  uint32_t shift = MINIMUM_POOLED_SHIFT;
+  while( ( size_t( 1u ) << ( shift + 1u ) ) < size )
+  {
+    ++shift;
+  }
+  const size_t step = size_t( 1u ) << ( shift - CLASSES_PER_POWER_OF_TWO_SHIFT );
+  const size_t quarters = ( size - ( size_t( 1u ) << shift ) + step - 1u ) / step;
+
+  return ( shift - MINIMUM_POOLED_SHIFT ) * CLASSES_PER_POWER_OF_TWO + static_cast<uint32_t>( quarters ) - 1u;
+}
+
+size_t PixelBufferPool::GetClassSize( uint32_t sizeClass )
+{
+  const uint32_t shift = MINIMUM_POOLED_SHIFT + sizeClass / CLASSES_PER_POWER_OF_TWO;
+  const size_t quarters = sizeClass % CLASSES_PER_POWER_OF_TWO + 1u;
+  return ( size_t( 1u ) << shift ) + quarters * ( size_t( 1u ) << ( shift - CLASSES_PER_POWER_OF_TWO_SHIFT ) );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
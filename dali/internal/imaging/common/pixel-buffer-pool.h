@@ -0,0 +1,141 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_POOL_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/mutex.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Recycles the memory of the pixel buffers, so the intermediate buffers of an image operation
+ * (resizing, cropping, masking, blurring...) reuse the memory released by the previous ones instead of
+ * allocating large blocks again.
+ *
+ * The sizes are rounded up to size classes, four per power of two, so a buffer released can be reused for
+ * any size of its class. The buffers are allocated with malloc(), so a buffer handed over to a PixelData
+ * can be released with free(). Small buffers, which the system allocator handles well, and very large ones
+ * are not pooled.
+ *
+ * The released buffers are kept up to a memory budget given by DALI_PIXEL_BUFFER_POOL_SIZE, and are freed
+ * by Trim(), which is called when the application is paused or the memory is low. The pool is thread safe.
+ */
+class PixelBufferPool
+{
+public:
+
+  /**
+   * @brief The use of the pool since the process started.
+   */
+  struct Statistics
+  {
+    uint32_t allocations{0u};   ///< The number of pooled sizes allocated
+    uint32_t reuses{0u};        ///< The number of those allocations reusing a released buffer
+    uint32_t cachedBuffers{0u}; ///< The number of released buffers kept
+    size_t   cachedSize{0u};    ///< The size of the released buffers kept, in bytes
+  };
+
+  /**
+   * @brief Retrieves the pool shared by the pixel buffers.
+   */
+  static PixelBufferPool& Get();
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] maximumCachedSize The maximum size of the released buffers kept, in bytes
+   */
+  explicit PixelBufferPool( size_t maximumCachedSize );
+
+  /**
+   * @brief Destructor. Frees the released buffers.
+   */
+  ~PixelBufferPool();
+
+  /**
+   * @brief Allocates a buffer, reusing a released buffer of the same size class if any.
+   *
+   * @param[in] size The size of the buffer in bytes
+   *
+   * @return The buffer, or nullptr if the allocation failed. It may be released with Release() or free().
+   */
+  unsigned char* Allocate( size_t size );
+
+  /**
+   * @brief Releases a buffer allocated by Allocate(), keeping it for reuse if the budget allows.
+   *
+   * @param[in] buffer The buffer, may be nullptr
+   * @param[in] size The size the buffer was allocated with
+   */
+  void Release( unsigned char* buffer, size_t size );
+
+  /**
+   * @brief Frees the released buffers.
+   */
+  void Trim();
+
+  /**
+   * @brief Retrieves the use of the pool.
+   */
+  Statistics GetStatistics() const;
+
+private:
+
+  // Undefined
+  PixelBufferPool( const PixelBufferPool& ) = delete;
+  PixelBufferPool& operator=( const PixelBufferPool& ) = delete;
+
+  /**
+   * @brief Retrieves the size class of a size.
+   *
+   * @param[in] size The size in bytes
+   *
+   * @return The index of the class, or NOT_POOLED if the size is not pooled.
+   */
+  static uint32_t GetSizeClass( size_t size );
+
+  /**
+   * @brief Retrieves the size of the buffers of a size class.
+   */
+  static size_t GetClassSize( uint32_t sizeClass );
+
+  static const uint32_t NOT_POOLED = 0xffffffffu;
+
+  mutable Mutex                             mMutex;             ///< Guards the members below
+  std::vector<std::vector<unsigned char*>>  mReleasedBuffers;   ///< The released buffers of each size class
+  Statistics                                mStatistics;        ///< The use of the pool
+  size_t                                    mMaximumCachedSize; ///< The maximum size of the released buffers kept
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_POOL_H
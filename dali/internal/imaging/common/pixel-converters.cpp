@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/pixel-converters.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/pixel-manipulation.h>
+#include <dali/internal/imaging/common/simd-pixel.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+/**
+ * @brief Divides a product of two channels by 255, rounding down as the integer division does.
+ *
+ * Exact for any product of two 8 bit values, and only needs additions and shifts so it vectorises.
+ */
+inline uint32_t DivideBy255( uint32_t product )
+{
+  return ( product + 1u + ( product >> 8u ) ) >> 8u;
+}
+
+/**
+ * @brief Writes a RGBA8888 pixel.
+ */
+inline void StoreRgba( uint8_t* out, uint32_t red, uint32_t green, uint32_t blue, uint32_t alpha )
+{
+  out[0] = static_cast<uint8_t>( red );
+  out[1] = static_cast<uint8_t>( green );
+  out[2] = static_cast<uint8_t>( blue );
+  out[3] = static_cast<uint8_t>( alpha );
+}
+
+/**
+ * @brief A row converter for a pair of formats known at compile time. Only the specializations are defined.
+ */
+template< Pixel::Format IN, Pixel::Format OUT >
+void ConvertRowTemplate( const uint8_t* in, uint8_t* out, unsigned int width );
+
+template<>
+void ConvertRowTemplate< Pixel::RGB888, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; x + 8u <= width; x += 8u, in += 24u, out += 32u )
+  {
+    const uint8x8x3_t rgb = vld3_u8( in );
+    uint8x8x4_t rgba;
+    rgba.val[0] = rgb.val[0];
+    rgba.val[1] = rgb.val[1];
+    rgba.val[2] = rgb.val[2];
+    rgba.val[3] = vdup_n_u8( 0xFF );
+    vst4_u8( out, rgba );
+  }
+#endif
+  for( ; x < width; ++x, in += 3u, out += 4u )
+  {
+    StoreRgba( out, in[0], in[1], in[2], 0xFF );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::RGBA8888, Pixel::RGB888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; x + 8u <= width; x += 8u, in += 32u, out += 24u )
+  {
+    const uint8x8x4_t rgba = vld4_u8( in );
+    uint8x8x3_t rgb;
+    rgb.val[0] = rgba.val[0];
+    rgb.val[1] = rgba.val[1];
+    rgb.val[2] = rgba.val[2];
+    vst3_u8( out, rgb );
+  }
+#endif
+  for( ; x < width; ++x, in += 4u, out += 3u )
+  {
+    out[0] = in[0];
+    out[1] = in[1];
+    out[2] = in[2];
+  }
+}
+
+/**
+ * @brief Converts 4 byte pixels stored as blue, green, red, then alpha or padding, to RGB888.
+ */
+void ConvertBgrxToRgb( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; x + 8u <= width; x += 8u, in += 32u, out += 24u )
+  {
+    const uint8x8x4_t bgrx = vld4_u8( in );
+    uint8x8x3_t rgb;
+    rgb.val[0] = bgrx.val[2];
+    rgb.val[1] = bgrx.val[1];
+    rgb.val[2] = bgrx.val[0];
+    vst3_u8( out, rgb );
+  }
+#elif defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+  // Four pixels are packed in three words: byte swapping a pixel gives its red, green and blue in the
+  // three lower bytes.
+  for( ; x + 4u <= width; x += 4u, in += 16u, out += 12u )
+  {
+    const uint32_t first = __builtin_bswap32( SimdPixel::LoadPixel( in ) ) >> 8u;
+    const uint32_t second = __builtin_bswap32( SimdPixel::LoadPixel( in + 4u ) ) >> 8u;
+    const uint32_t third = __builtin_bswap32( SimdPixel::LoadPixel( in + 8u ) ) >> 8u;
+    const uint32_t fourth = __builtin_bswap32( SimdPixel::LoadPixel( in + 12u ) ) >> 8u;
+    SimdPixel::StorePixel( out, first | ( second << 24u ) );
+    SimdPixel::StorePixel( out + 4u, ( second >> 8u ) | ( third << 16u ) );
+    SimdPixel::StorePixel( out + 8u, ( third >> 16u ) | ( fourth << 8u ) );
+  }
+#endif
+  for( ; x < width; ++x, in += 4u, out += 3u )
+  {
+    out[0] = in[2];
+    out[1] = in[1];
+    out[2] = in[0];
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::BGRA8888, Pixel::RGB888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  ConvertBgrxToRgb( in, out, width );
+}
+
+template<>
+void ConvertRowTemplate< Pixel::BGR8888, Pixel::RGB888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  ConvertBgrxToRgb( in, out, width );
+}
+
+/**
+ * @brief Swaps the red and blue channels of 4 byte pixels, which converts RGBA8888 to BGRA8888 and back.
+ */
+void SwapRedAndBlue( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, in += 4u, out += 4u )
+  {
+    const uint32_t pixel = SimdPixel::LoadPixel( in );
+    const uint8_t* channels = reinterpret_cast<const uint8_t*>( &pixel );
+    StoreRgba( out, channels[2], channels[1], channels[0], channels[3] );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::RGBA8888, Pixel::BGRA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  SwapRedAndBlue( in, out, width );
+}
+
+template<>
+void ConvertRowTemplate< Pixel::BGRA8888, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  SwapRedAndBlue( in, out, width );
+}
+
+template<>
+void ConvertRowTemplate< Pixel::L8, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; x + 8u <= width; x += 8u, in += 8u, out += 32u )
+  {
+    const uint8x8_t luminance = vld1_u8( in );
+    uint8x8x4_t rgba;
+    rgba.val[0] = luminance;
+    rgba.val[1] = luminance;
+    rgba.val[2] = luminance;
+    rgba.val[3] = vdup_n_u8( 0xFF );
+    vst4_u8( out, rgba );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  const __m128i opaque = _mm_set1_epi8( static_cast<char>( 0xFF ) );
+  for( ; x + 16u <= width; x += 16u, in += 16u, out += 64u )
+  {
+    const __m128i luminance = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+    const __m128i low = _mm_unpacklo_epi8( luminance, luminance );                  // LL for pixels 0 to 7
+    const __m128i high = _mm_unpackhi_epi8( luminance, luminance );                 // LL for pixels 8 to 15
+    const __m128i lowAlpha = _mm_unpacklo_epi8( luminance, opaque );                // LA for pixels 0 to 7
+    const __m128i highAlpha = _mm_unpackhi_epi8( luminance, opaque );               // LA for pixels 8 to 15
+    __m128i* pixels = reinterpret_cast<__m128i*>( out );
+    _mm_storeu_si128( pixels, _mm_unpacklo_epi16( low, lowAlpha ) );
+    _mm_storeu_si128( pixels + 1, _mm_unpackhi_epi16( low, lowAlpha ) );
+    _mm_storeu_si128( pixels + 2, _mm_unpacklo_epi16( high, highAlpha ) );
+    _mm_storeu_si128( pixels + 3, _mm_unpackhi_epi16( high, highAlpha ) );
+  }
+#endif
+  for( ; x < width; ++x, ++in, out += 4u )
+  {
+    StoreRgba( out, *in, *in, *in, 0xFF );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::A8, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  for( ; x + 8u <= width; x += 8u, in += 8u, out += 32u )
+  {
+    uint8x8x4_t rgba;
+    rgba.val[0] = vdup_n_u8( 0u );
+    rgba.val[1] = rgba.val[0];
+    rgba.val[2] = rgba.val[0];
+    rgba.val[3] = vld1_u8( in );
+    vst4_u8( out, rgba );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  const __m128i zero = _mm_setzero_si128();
+  for( ; x + 16u <= width; x += 16u, in += 16u, out += 64u )
+  {
+    const __m128i alpha = _mm_loadu_si128( reinterpret_cast<const __m128i*>( in ) );
+    const __m128i low = _mm_unpacklo_epi8( zero, alpha );  // 0A for pixels 0 to 7
+    const __m128i high = _mm_unpackhi_epi8( zero, alpha ); // 0A for pixels 8 to 15
+    __m128i* pixels = reinterpret_cast<__m128i*>( out );
+    _mm_storeu_si128( pixels, _mm_unpacklo_epi16( zero, low ) );
+    _mm_storeu_si128( pixels + 1, _mm_unpackhi_epi16( zero, low ) );
+    _mm_storeu_si128( pixels + 2, _mm_unpacklo_epi16( zero, high ) );
+    _mm_storeu_si128( pixels + 3, _mm_unpackhi_epi16( zero, high ) );
+  }
+#endif
+  for( ; x < width; ++x, ++in, out += 4u )
+  {
+    StoreRgba( out, 0u, 0u, 0u, *in );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::LA88, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, in += 2u, out += 4u )
+  {
+    StoreRgba( out, in[0], in[0], in[0], in[1] );
+  }
+}
+
+/**
+ * @brief Converts 16 bit pixels, with the first channel in the top bits of the first byte, to RGBA8888.
+ *
+ * The channels are widened the same way as ConvertColorChannelsToRGBA8888() does.
+ *
+ * @tparam SWAP Whether the first channel is blue, as in BGR565
+ */
+template< bool SWAP >
+void Convert565ToRgba( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, in += 2u, out += 4u )
+  {
+    const uint32_t first = ( in[0] & 0xF8u ) >> 3u;
+    const uint32_t green = ( ( in[0] & 0x07u ) << 3u ) | ( ( in[1] & 0xE0u ) >> 5u );
+    const uint32_t last = in[1] & 0x1Fu;
+
+    const uint32_t wideFirst = ( first << 3u ) | ( first & 0x07u );
+    const uint32_t wideGreen = ( green << 2u ) | ( green & 0x03u );
+    const uint32_t wideLast = ( last << 3u ) | ( last & 0x07u );
+    StoreRgba( out, SWAP ? wideLast : wideFirst, wideGreen, SWAP ? wideFirst : wideLast, 0xFF );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::RGB565, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  Convert565ToRgba< false >( in, out, width );
+}
+
+template<>
+void ConvertRowTemplate< Pixel::BGR565, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  Convert565ToRgba< true >( in, out, width );
+}
+
+template<>
+void ConvertRowTemplate< Pixel::RGB8888, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, in += 4u, out += 4u )
+  {
+    StoreRgba( out, in[0], in[1], in[2], 0xFF );
+  }
+}
+
+template<>
+void ConvertRowTemplate< Pixel::BGR8888, Pixel::RGBA8888 >( const uint8_t* in, uint8_t* out, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, in += 4u, out += 4u )
+  {
+    StoreRgba( out, in[2], in[1], in[0], 0xFF );
+  }
+}
+
+/**
+ * @brief Multiplies the first three channels of 4 byte pixels by the fourth one.
+ */
+void MultiplyColorByAlpha4Bytes( uint8_t* row, unsigned int width )
+{
+  unsigned int x = 0u;
+#if defined( DALI_SIMD_PIXEL_NEON )
+  const uint16x8_t one = vdupq_n_u16( 1u );
+  for( ; x + 8u <= width; x += 8u, row += 32u )
+  {
+    uint8x8x4_t pixels = vld4_u8( row );
+    for( int channel = 0; channel < 3; ++channel )
+    {
+      const uint16x8_t product = vmull_u8( pixels.val[channel], pixels.val[3] );
+      pixels.val[channel] = vshrn_n_u16( vaddq_u16( vaddq_u16( product, one ), vshrq_n_u16( product, 8 ) ), 8 );
+    }
+    vst4_u8( row, pixels );
+  }
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi16( 1 );
+  const __m128i alphaLanes = _mm_set_epi16( -1, 0, 0, 0, -1, 0, 0, 0 );
+  for( ; x + 4u <= width; x += 4u, row += 16u )
+  {
+    const __m128i pixels = _mm_loadu_si128( reinterpret_cast<const __m128i*>( row ) );
+    __m128i halves[2] = { _mm_unpacklo_epi8( pixels, zero ), _mm_unpackhi_epi8( pixels, zero ) };
+    for( __m128i& half : halves )
+    {
+      // Copies the alpha of each of the two pixels to its four lanes, and keeps the alpha lanes as they are.
+      const __m128i alpha = _mm_shufflehi_epi16( _mm_shufflelo_epi16( half, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+      const __m128i product = _mm_mullo_epi16( half, alpha );
+      const __m128i quotient = _mm_srli_epi16( _mm_add_epi16( _mm_add_epi16( product, one ), _mm_srli_epi16( product, 8 ) ), 8 );
+      half = _mm_or_si128( _mm_and_si128( alphaLanes, half ), _mm_andnot_si128( alphaLanes, quotient ) );
+    }
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( row ), _mm_packus_epi16( halves[0], halves[1] ) );
+  }
+#endif
+  for( ; x < width; ++x, row += 4u )
+  {
+    const uint32_t alpha = row[3];
+    row[0] = static_cast<uint8_t>( DivideBy255( row[0] * alpha ) );
+    row[1] = static_cast<uint8_t>( DivideBy255( row[1] * alpha ) );
+    row[2] = static_cast<uint8_t>( DivideBy255( row[2] * alpha ) );
+  }
+}
+
+/**
+ * @brief Multiplies the luminance of LA88 pixels by their alpha.
+ */
+void MultiplyColorByAlphaLa88( uint8_t* row, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, row += 2u )
+  {
+    row[0] = static_cast<uint8_t>( DivideBy255( row[0] * row[1] ) );
+  }
+}
+
+/**
+ * @brief Multiplies all the channels of pixels whose channels are all bytes by a factor per pixel.
+ *
+ * @tparam BYTES_PER_PIXEL The number of channels
+ */
+template< unsigned int BYTES_PER_PIXEL >
+void MultiplyBytes( uint8_t* row, const uint8_t* factors, unsigned int factorStride, unsigned int width )
+{
+  for( unsigned int x = 0u; x < width; ++x, row += BYTES_PER_PIXEL, factors += factorStride )
+  {
+    const uint32_t factor = *factors;
+    for( unsigned int channel = 0u; channel < BYTES_PER_PIXEL; ++channel )
+    {
+      row[channel] = static_cast<uint8_t>( DivideBy255( row[channel] * factor ) );
+    }
+  }
+}
+
+} // unnamed namespace
+
+void ConvertRow( const uint8_t* in, Pixel::Format inFormat, uint8_t* out, Pixel::Format outFormat, unsigned int width )
+{
+  const unsigned int inBytesPerPixel = Pixel::GetBytesPerPixel( inFormat );
+  const unsigned int outBytesPerPixel = Pixel::GetBytesPerPixel( outFormat );
+  const bool hasAlpha = Pixel::HasAlpha( inFormat );
+  const bool hasLuminance = HasChannel( inFormat, Adaptor::LUMINANCE );
+  const Channel channels[] = { Adaptor::RED, Adaptor::GREEN, Adaptor::BLUE, Adaptor::ALPHA };
+
+  // The padding of RGB8888 and BGR8888 is opaque.
+  memset( out, 0xFF, width * outBytesPerPixel );
+
+  unsigned char* inPixels = const_cast<unsigned char*>( in );
+  for( unsigned int x = 0u; x < width; ++x, out += outBytesPerPixel )
+  {
+    const int inOffset = static_cast<int>( x * inBytesPerPixel );
+
+    unsigned char rgba[4];
+    ConvertColorChannelsToRGBA8888( inPixels, inOffset, inFormat, rgba, 0 );
+    if( hasLuminance )
+    {
+      rgba[0] = rgba[1] = rgba[2] = static_cast<unsigned char>( ReadChannel( inPixels + inOffset, inFormat, Adaptor::LUMINANCE ) );
+    }
+    rgba[3] = hasAlpha ? static_cast<unsigned char>( ConvertAlphaChannelToA8( inPixels, inOffset, inFormat ) ) : 0xFF;
+
+    for( unsigned int channel = 0u; channel < 4u; ++channel )
+    {
+      if( HasChannel( outFormat, channels[channel] ) )
+      {
+        WriteChannel( out, outFormat, channels[channel], rgba[channel] );
+      }
+    }
+  }
+}
+
+ConvertRowFunction GetConvertRowFunction( Pixel::Format inFormat, Pixel::Format outFormat )
+{
+  if( outFormat == Pixel::RGBA8888 )
+  {
+    switch( inFormat )
+    {
+      case Pixel::RGB888:
+      {
+        return ConvertRowTemplate< Pixel::RGB888, Pixel::RGBA8888 >;
+      }
+      case Pixel::BGRA8888:
+      {
+        return ConvertRowTemplate< Pixel::BGRA8888, Pixel::RGBA8888 >;
+      }
+      case Pixel::L8:
+      {
+        return ConvertRowTemplate< Pixel::L8, Pixel::RGBA8888 >;
+      }
+      case Pixel::A8:
+      {
+        return ConvertRowTemplate< Pixel::A8, Pixel::RGBA8888 >;
+      }
+      case Pixel::LA88:
+      {
+        return ConvertRowTemplate< Pixel::LA88, Pixel::RGBA8888 >;
+      }
+      case Pixel::RGB565:
+      {
+        return ConvertRowTemplate< Pixel::RGB565, Pixel::RGBA8888 >;
+      }
+      case Pixel::BGR565:
+      {
+        return ConvertRowTemplate< Pixel::BGR565, Pixel::RGBA8888 >;
+      }
+      case Pixel::RGB8888:
+      {
+        return ConvertRowTemplate< Pixel::RGB8888, Pixel::RGBA8888 >;
+      }
+      case Pixel::BGR8888:
+      {
+        return ConvertRowTemplate< Pixel::BGR8888, Pixel::RGBA8888 >;
+      }
+      default:
+      {
+        return nullptr;
+      }
+    }
+  }
+
+  if( outFormat == Pixel::RGB888 )
+  {
+    switch( inFormat )
+    {
+      case Pixel::RGBA8888:
+      {
+        return ConvertRowTemplate< Pixel::RGBA8888, Pixel::RGB888 >;
+      }
+      case Pixel::BGRA8888:
+      {
+        return ConvertRowTemplate< Pixel::BGRA8888, Pixel::RGB888 >;
+      }
+      case Pixel::BGR8888:
+      {
+        return ConvertRowTemplate< Pixel::BGR8888, Pixel::RGB888 >;
+      }
+      default:
+      {
+        return nullptr;
+      }
+    }
+  }
+
+  if( inFormat == Pixel::RGBA8888 )
+  {
+    switch( outFormat )
+    {
+      case Pixel::BGRA8888:
+      {
+        return ConvertRowTemplate< Pixel::RGBA8888, Pixel::BGRA8888 >;
+      }
+      default:
+      {
+        return nullptr;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+void MultiplyColorByAlphaRow( uint8_t* row, Pixel::Format format, unsigned int width )
+{
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( format );
+  for( unsigned int x = 0u; x < width; ++x, row += bytesPerPixel )
+  {
+    const unsigned int alpha = ReadChannel( row, format, Adaptor::ALPHA );
+    const unsigned int red = ReadChannel( row, format, Adaptor::RED );
+    const unsigned int green = ReadChannel( row, format, Adaptor::GREEN );
+    const unsigned int blue = ReadChannel( row, format, Adaptor::BLUE );
+    const unsigned int luminance = ReadChannel( row, format, Adaptor::LUMINANCE );
+    WriteChannel( row, format, Adaptor::RED, red * alpha / 255 );
+    WriteChannel( row, format, Adaptor::GREEN, green * alpha / 255 );
+    WriteChannel( row, format, Adaptor::BLUE, blue * alpha / 255 );
+    WriteChannel( row, format, Adaptor::LUMINANCE, luminance * alpha / 255 );
+  }
+}
+
+MultiplyColorByAlphaRowFunction GetMultiplyColorByAlphaRowFunction( Pixel::Format format )
+{
+  switch( format )
+  {
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return MultiplyColorByAlpha4Bytes;
+    }
+    case Pixel::LA88:
+    {
+      return MultiplyColorByAlphaLa88;
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+}
+
+void MultiplyRow( uint8_t* row, Pixel::Format format, const uint8_t* factors, unsigned int factorStride, unsigned int width )
+{
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( format );
+  for( unsigned int x = 0u; x < width; ++x, row += bytesPerPixel, factors += factorStride )
+  {
+    const unsigned int factor = *factors;
+    const unsigned int red = ReadChannel( row, format, Adaptor::RED );
+    const unsigned int green = ReadChannel( row, format, Adaptor::GREEN );
+    const unsigned int blue = ReadChannel( row, format, Adaptor::BLUE );
+    const unsigned int luminance = ReadChannel( row, format, Adaptor::LUMINANCE );
+    const unsigned int alpha = ReadChannel( row, format, Adaptor::ALPHA );
+    WriteChannel( row, format, Adaptor::RED, red * factor / 255 );
+    WriteChannel( row, format, Adaptor::GREEN, green * factor / 255 );
+    WriteChannel( row, format, Adaptor::BLUE, blue * factor / 255 );
+    WriteChannel( row, format, Adaptor::LUMINANCE, luminance * factor / 255 );
+    WriteChannel( row, format, Adaptor::ALPHA, alpha * factor / 255 );
+  }
+}
+
+MultiplyRowFunction GetMultiplyRowFunction( Pixel::Format format )
+{
+  switch( format )
+  {
+    case Pixel::A8:
+    case Pixel::L8:
+    {
+      return MultiplyBytes< 1u >;
+    }
+    case Pixel::LA88:
+    {
+      return MultiplyBytes< 2u >;
+    }
+    case Pixel::RGB888:
+    {
+      return MultiplyBytes< 3u >;
+    }
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return MultiplyBytes< 4u >;
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+}
+
+void ConvertRgbaToI420( const uint8_t* rgba, unsigned int width, unsigned int height, uint8_t* y, uint8_t* u, uint8_t* v )
+{
+  for( unsigned int row = 0u; row < height; ++row )
+  {
+    const uint8_t* in = rgba + row * width * 4u;
+    uint8_t* out = y + row * width;
+    for( unsigned int x = 0u; x < width; ++x, in += 4u )
+    {
+      // The weights add up to 256, so white stays 255.
+      out[x] = static_cast<uint8_t>( ( 77u * in[0] + 150u * in[1] + 29u * in[2] + 128u ) >> 8u );
+    }
+  }
+
+  const unsigned int chromaWidth = ( width + 1u ) / 2u;
+  const unsigned int chromaHeight = ( height + 1u ) / 2u;
+  for( unsigned int chromaRow = 0u; chromaRow < chromaHeight; ++chromaRow )
+  {
+    const unsigned int rows = std::min( 2u, height - chromaRow * 2u );
+    for( unsigned int chromaX = 0u; chromaX < chromaWidth; ++chromaX )
+    {
+      const unsigned int columns = std::min( 2u, width - chromaX * 2u );
+      int red = 0, green = 0, blue = 0;
+      for( unsigned int blockRow = 0u; blockRow < rows; ++blockRow )
+      {
+        const uint8_t* in = rgba + ( ( chromaRow * 2u + blockRow ) * width + chromaX * 2u ) * 4u;
+        for( unsigned int blockX = 0u; blockX < columns; ++blockX, in += 4u )
+        {
+          red += in[0];
+          green += in[1];
+          blue += in[2];
+        }
+      }
+
+      // Averages rounded to nearest, then offset by 128 << 8 to keep the sums positive before shifting.
+      const int count = static_cast<int>( rows * columns );
+      red = ( red + count / 2 ) / count;
+      green = ( green + count / 2 ) / count;
+      blue = ( blue + count / 2 ) / count;
+      u[chromaRow * chromaWidth + chromaX] = static_cast<uint8_t>( std::min( 255, ( -43 * red - 85 * green + 128 * blue + 32896 ) >> 8 ) );
+      v[chromaRow * chromaWidth + chromaX] = static_cast<uint8_t>( std::min( 255, ( 128 * red - 107 * green - 21 * blue + 32896 ) >> 8 ) );
+    }
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,144 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_CONVERTERS_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_CONVERTERS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/images/pixel.h>
+#include <cstdint>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Converts a row of pixels from one pixel format to another.
+ *
+ * The color channels are widened to 8 bits, the luminance is copied to the color channels, and the alpha
+ * channel and the padding of RGB8888 and BGR8888 are opaque if the input has no alpha.
+ *
+ * @param[in] in The input pixels
+ * @param[out] out The output pixels, which don't overlap the input
+ * @param[in] width The number of pixels
+ */
+typedef void ( *ConvertRowFunction )( const uint8_t* in, uint8_t* out, unsigned int width );
+
+/**
+ * @brief Multiplies the color channels of a row of pixels by their alpha channel, in place.
+ *
+ * @param[in,out] row The pixels
+ * @param[in] width The number of pixels
+ */
+typedef void ( *MultiplyColorByAlphaRowFunction )( uint8_t* row, unsigned int width );
+
+/**
+ * @brief Multiplies all the channels of a row of pixels by a factor per pixel, in place.
+ *
+ * @param[in,out] row The pixels
+ * @param[in] factors The first factor, from 0 for 0 to 255 for 1
+ * @param[in] factorStride The distance between two factors in bytes
+ * @param[in] width The number of pixels
+ */
+typedef void ( *MultiplyRowFunction )( uint8_t* row, const uint8_t* factors, unsigned int factorStride, unsigned int width );
+
+/**
+ * @brief Converts a row of pixels with ReadChannel() and WriteChannel(). Works with any pair of formats
+ * supported by PixelBuffer::ConvertPixelFormat().
+ *
+ * @see ConvertRowFunction
+ * @param[in] in The input pixels
+ * @param[in] inFormat The format of the input pixels
+ * @param[out] out The output pixels
+ * @param[in] outFormat The format of the output pixels
+ * @param[in] width The number of pixels
+ */
+void ConvertRow( const uint8_t* in, Pixel::Format inFormat, uint8_t* out, Pixel::Format outFormat, unsigned int width );
+
+/**
+ * @brief Retrieves a converter specialized for a pair of formats, which gives the same output as ConvertRow().
+ *
+ * @param[in] inFormat The format of the input pixels
+ * @param[in] outFormat The format of the output pixels
+ * @return The converter, or nullptr if there is none for these formats.
+ */
+ConvertRowFunction GetConvertRowFunction( Pixel::Format inFormat, Pixel::Format outFormat );
+
+/**
+ * @brief Multiplies the color channels of a row of pixels by their alpha channel with ReadChannel() and WriteChannel().
+ *
+ * @see MultiplyColorByAlphaRowFunction
+ * @param[in,out] row The pixels
+ * @param[in] format The format of the pixels
+ * @param[in] width The number of pixels
+ */
+void MultiplyColorByAlphaRow( uint8_t* row, Pixel::Format format, unsigned int width );
+
+/**
+ * @brief Retrieves a function specialized for a format, which gives the same output as MultiplyColorByAlphaRow().
+ *
+ * @param[in] format The format of the pixels
+ * @return The function, or nullptr if there is none for this format.
+ */
+MultiplyColorByAlphaRowFunction GetMultiplyColorByAlphaRowFunction( Pixel::Format format );
+
+/**
+ * @brief Multiplies all the channels of a row of pixels by a factor per pixel with ReadChannel() and WriteChannel().
+ *
+ * @see MultiplyRowFunction
+ * @param[in,out] row The pixels
+ * @param[in] format The format of the pixels
+ * @param[in] factors The first factor
+ * @param[in] factorStride The distance between two factors in bytes
+ * @param[in] width The number of pixels
+ */
+void MultiplyRow( uint8_t* row, Pixel::Format format, const uint8_t* factors, unsigned int factorStride, unsigned int width );
+
+/**
+ * @brief Retrieves a function specialized for a format, which gives the same output as MultiplyRow().
+ *
+ * @param[in] format The format of the pixels
+ * @return The function, or nullptr if there is none for this format.
+ */
+MultiplyRowFunction GetMultiplyRowFunction( Pixel::Format format );
+
+/**
+ * @brief Converts RGBA8888 pixels to the planes of an I420 image, with the full range BT.601 coefficients of JFIF.
+ *
+ * The chroma planes are (width + 1) / 2 by (height + 1) / 2, each chroma sample taking the average color of its
+ * 2x2 block, or of the pixels of the block inside an odd sized image. The alpha channel is ignored.
+ *
+ * @param[in] rgba The tightly packed RGBA8888 pixels
+ * @param[in] width The width of the image
+ * @param[in] height The height of the image
+ * @param[out] y The luma plane, width by height
+ * @param[out] u The blue difference plane
+ * @param[out] v The red difference plane
+ */
+void ConvertRgbaToI420( const uint8_t* rgba, unsigned int width, unsigned int height, uint8_t* y, uint8_t* u, uint8_t* v );
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_CONVERTERS_H
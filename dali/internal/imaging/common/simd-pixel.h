@@ -0,0 +1,163 @@
+#ifndef DALI_INTERNAL_ADAPTOR_SIMD_PIXEL_H
+#define DALI_INTERNAL_ADAPTOR_SIMD_PIXEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <cstring>
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define DALI_SIMD_PIXEL_NEON 1
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define DALI_SIMD_PIXEL_SSE2 1
+#endif
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief A minimal portable abstraction over the SIMD instruction sets available on our targets.
+ *
+ * The operations work on one 4 channel, 8 bit per channel pixel at a time, which is enough to
+ * vectorise the channel arithmetic of the separable image filters. NEON is used on ARM, SSE2 on
+ * x86 and plain C++ everywhere else. All the variants produce bit identical results.
+ */
+namespace SimdPixel
+{
+
+/**
+ * @brief Four unsigned 32 bit accumulators, one per channel of a pixel.
+ */
+#if defined( DALI_SIMD_PIXEL_NEON )
+typedef uint32x4_t Accumulator;
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+typedef __m128i Accumulator;
+#else
+struct Accumulator
+{
+  uint32_t channel[4];
+};
+#endif
+
+/**
+ * @brief Reads the four bytes of a pixel as a single word.
+ * @param[in] pixel Pointer to the first channel of the pixel. Does not need to be aligned.
+ * @return The pixel.
+ */
+inline uint32_t LoadPixel( const uint8_t* pixel )
+{
+  uint32_t value;
+  memcpy( &value, pixel, sizeof( value ) );
+  return value;
+}
+
+/**
+ * @brief Writes a pixel previously read with LoadPixel() or produced by Pack().
+ * @param[out] pixel Pointer to the first channel of the pixel. Does not need to be aligned.
+ * @param[in] value The pixel.
+ */
+inline void StorePixel( uint8_t* pixel, uint32_t value )
+{
+  memcpy( pixel, &value, sizeof( value ) );
+}
+
+/**
+ * @brief Sets all the channels of the accumulator to the same value.
+ * @param[in] value The initial value of the channels, usually a rounding term.
+ * @return The accumulator.
+ */
+inline Accumulator Splat( uint32_t value )
+{
+#if defined( DALI_SIMD_PIXEL_NEON )
+  return vdupq_n_u32( value );
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  return _mm_set1_epi32( static_cast<int>( value ) );
+#else
+  Accumulator accumulator = { { value, value, value, value } };
+  return accumulator;
+#endif
+}
+
+/**
+ * @brief Adds the weighted channels of a pixel to the accumulator.
+ * @param[in,out] accumulator The accumulator.
+ * @param[in] pixel The pixel, as returned by LoadPixel().
+ * @param[in] weight The weight. Must be less than 32768.
+ */
+inline void MultiplyAdd( Accumulator& accumulator, uint32_t pixel, uint16_t weight )
+{
+#if defined( DALI_SIMD_PIXEL_NEON )
+  const uint16x4_t channels = vget_low_u16( vmovl_u8( vreinterpret_u8_u32( vdup_n_u32( pixel ) ) ) );
+  accumulator = vmlal_n_u16( accumulator, channels, weight );
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  // Widen each channel to the low half of a 32 bit lane so a signed 16 bit multiply-add does the job.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i channels = _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( static_cast<int>( pixel ) ), zero ), zero );
+  accumulator = _mm_add_epi32( accumulator, _mm_madd_epi16( channels, _mm_set1_epi32( weight ) ) );
+#else
+  const uint8_t* channels = reinterpret_cast<const uint8_t*>( &pixel );
+  accumulator.channel[0] += channels[0] * weight;
+  accumulator.channel[1] += channels[1] * weight;
+  accumulator.channel[2] += channels[2] * weight;
+  accumulator.channel[3] += channels[3] * weight;
+#endif
+}
+
+/**
+ * @brief Shifts each channel of the accumulator right and packs the results back into a pixel.
+ * @tparam SHIFT The number of fractional bits in the accumulator.
+ * @param[in] accumulator The accumulator. Each channel must be less than 256 after shifting.
+ * @return The pixel, to be written with StorePixel().
+ */
+template< unsigned int SHIFT >
+inline uint32_t Pack( const Accumulator& accumulator )
+{
+#if defined( DALI_SIMD_PIXEL_NEON )
+  const uint16x4_t narrow = vshrn_n_u32( accumulator, SHIFT );
+  return vget_lane_u32( vreinterpret_u32_u8( vmovn_u16( vcombine_u16( narrow, narrow ) ) ), 0 );
+#elif defined( DALI_SIMD_PIXEL_SSE2 )
+  const __m128i narrow = _mm_packs_epi32( _mm_srli_epi32( accumulator, SHIFT ), _mm_setzero_si128() );
+  return static_cast<uint32_t>( _mm_cvtsi128_si32( _mm_packus_epi16( narrow, narrow ) ) );
+#else
+  uint32_t pixel;
+  uint8_t* channels = reinterpret_cast<uint8_t*>( &pixel );
+  channels[0] = static_cast<uint8_t>( accumulator.channel[0] >> SHIFT );
+  channels[1] = static_cast<uint8_t>( accumulator.channel[1] >> SHIFT );
+  channels[2] = static_cast<uint8_t>( accumulator.channel[2] >> SHIFT );
+  channels[3] = static_cast<uint8_t>( accumulator.channel[3] >> SHIFT );
+  return pixel;
+#endif
+}
+
+} // namespace SimdPixel
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_SIMD_PIXEL_H
@@ -30,6 +30,7 @@
 #endif
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/devel-api/threading/mutex.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -38,6 +39,7 @@
 #include <cstring>
 #include <dali/internal/imaging/common/file-download.h>
 #include <dali/internal/system/common/file-reader.h>
+#include <dali/internal/system/common/mapped-file.h>
 
 typedef unsigned char WebPByteType;
 
@@ -93,6 +95,15 @@ public:
         return false;
       }
 
+      // The decoder reads the frames from the data while the animation plays, so map the file rather than keeping a copy unless it is small.
+      mMappedFile = Internal::Platform::MappedFile( fp, Internal::Platform::MappedFile::MINIMUM_IMAGE_SIZE );
+      if( mMappedFile.IsMapped() )
+      {
+        mWebPData.size = mMappedFile.GetSize();
+        mWebPData.bytes = mMappedFile.GetData();
+        return true;
+      }
+
       if( fseek( fp, 0, SEEK_END ) <= -1 )
       {
         return false;
@@ -166,7 +177,10 @@ public:
 #ifdef DALI_WEBP_ENABLED
     if( &mWebPData != NULL )
     {
-      free( (void*)mWebPData.bytes );
+      if( !mMappedFile.IsMapped() )
+      {
+        free( (void*)mWebPData.bytes );
+      }
       mWebPData.bytes = nullptr;
       WebPDataInit( &mWebPData );
     }
@@ -180,9 +194,11 @@ public:
   std::string mUrl;
   std::vector<uint32_t> mTimeStamp;
   uint32_t mLoadingFrame{0};
+  Mutex mMutex; ///< Serializes the decoding, which the streaming worker thread also does
 
 #ifdef DALI_WEBP_ENABLED
   WebPData mWebPData{0};
+  Internal::Platform::MappedFile mMappedFile;
   WebPAnimDecoder* mWebPAnimDecoder{nullptr};
   WebPAnimInfo mWebPAnimInfo{0};
 #endif
@@ -203,6 +219,8 @@ WebPLoading::WebPLoading( const std::string &url, bool isLocalResource )
 
 WebPLoading::~WebPLoading()
 {
+  // The worker thread decodes with mImpl.
+  StopStreaming();
   delete mImpl;
 }
 
@@ -216,6 +234,8 @@ bool WebPLoading::LoadNextNFrames( uint32_t frameStartIndex, int count, std::vec
 
   DALI_LOG_INFO( gWebPLoadingLogFilter, Debug::Concise, "LoadNextNFrames( frameStartIndex:%d, count:%d )\n", frameStartIndex, count );
 
+  Mutex::ScopedLock lock( mImpl->mMutex );
+
   if( mImpl->mLoadingFrame > frameStartIndex  )
   {
     mImpl->mLoadingFrame = 0;
@@ -273,6 +293,8 @@ Dali::Devel::PixelBuffer WebPLoading::LoadFrame( uint32_t frameIndex )
 
   DALI_LOG_INFO( gWebPLoadingLogFilter, Debug::Concise, "LoadNextNFrames( frameIndex:%d )\n", frameIndex );
 
+  Mutex::ScopedLock lock( mImpl->mMutex );
+
   if( mImpl->mLoadingFrame > frameIndex  )
   {
     mImpl->mLoadingFrame = 0;
@@ -332,6 +354,7 @@ uint32_t WebPLoading::GetFrameInterval( uint32_t frameIndex ) const
   }
   else
   {
+    Mutex::ScopedLock lock( mImpl->mMutex );
     if( frameIndex > 0 )
     {
       return mImpl->mTimeStamp[frameIndex] - mImpl->mTimeStamp[frameIndex - 1];
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/ubuntu-x11/pixmap-reader-x.h>
+
+// EXTERNAL INCLUDES
+#include <X11/Xutil.h>
+#include <dali/integration-api/debug.h>
+
+#ifdef DALI_XSHM_AVAILABLE
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#ifdef DALI_XSHM_AVAILABLE
+class XErrorTrap;
+
+Dali::Mutex gXErrorTrapMutex;           ///< Allows one trap at a time, as Xlib has a single error handler for the process
+XErrorTrap* gXErrorTrap = nullptr;      ///< The trap whose error handler is set, if any
+
+int TrapXError( Display* display, XErrorEvent* event );
+
+/**
+ * @brief Traps the X errors of the requests of its scope instead of letting the default handler exit
+ * the process, as the MIT-SHM requests fail for remote displays.
+ *
+ * Only the errors of the display of the trap are trapped; the errors of the other connections of the
+ * process are passed on to the error handler which was set before.
+ */
+class XErrorTrap
+{
+public:
+
+  explicit XErrorTrap( Display* display )
+  : mLock( gXErrorTrapMutex ),
+    mDisplay( display ),
+    mPreviousHandler( nullptr ),
+    mTrapped( false )
+  {
+    // The errors of the requests sent before the trap go to the previous handler.
+    XSync( mDisplay, False );
+    gXErrorTrap = this;
+    mPreviousHandler = XSetErrorHandler( TrapXError );
+  }
+
+  ~XErrorTrap()
+  {
+    XSetErrorHandler( mPreviousHandler );
+    gXErrorTrap = nullptr;
+  }
+
+  /**
+   * @brief Waits for the requests sent so far, and returns whether any of them failed.
+   */
+  bool HasFailed()
+  {
+    XSync( mDisplay, False );
+    return mTrapped;
+  }
+
+  /**
+   * @brief Called by the error handler. Traps the error if it comes from the display of the trap.
+   */
+  int HandleError( Display* display, XErrorEvent* event )
+  {
+    if( event->display == mDisplay )
+    {
+      mTrapped = true;
+      return 0;
+    }
+
+    return mPreviousHandler ? mPreviousHandler( display, event ) : 0;
+  }
+
+private:
+
+  Mutex::ScopedLock mLock;
+  Display* mDisplay;
+  XErrorHandler mPreviousHandler;
+  bool mTrapped;
+};
+
+int TrapXError( Display* display, XErrorEvent* event )
+{
+  XErrorTrap* trap = gXErrorTrap;
+  return trap ? trap->HandleError( display, event ) : 0;
+}
+#endif
+
+} // unnamed namespace
+
+PixmapReaderX::PixmapReaderX()
+:
+#ifdef DALI_XSHM_AVAILABLE
+  mSegmentInfo(),
+  mSharedImage( nullptr ),
+#endif
+  mMutex(),
+  mDisplay( XOpenDisplay( nullptr ) ),
+  mSharedMemoryUsed( false )
+{
+#ifdef DALI_XSHM_AVAILABLE
+  mSharedMemoryUsed = mDisplay && XShmQueryExtension( mDisplay );
+#endif
+  if( !mDisplay )
+  {
+    DALI_LOG_ERROR( "Could not open a display connection to read pixmaps\n" );
+  }
+}
+
+PixmapReaderX::~PixmapReaderX()
+{
+#ifdef DALI_XSHM_AVAILABLE
+  DestroySharedImage();
+#endif
+  if( mDisplay )
+  {
+    XCloseDisplay( mDisplay );
+  }
+}
+
+bool PixmapReaderX::Read( Pixmap pixmap, uint32_t width, uint32_t height, const ImageFunction& imageFunction )
+{
+  Mutex::ScopedLock lock( mMutex );
+
+  if( !mDisplay )
+  {
+    return false;
+  }
+
+#ifdef DALI_XSHM_AVAILABLE
+  if( mSharedMemoryUsed )
+  {
+    Window root;
+    int x, y;
+    unsigned int pixmapWidth, pixmapHeight, borderWidth, depth;
+    if( XGetGeometry( mDisplay, pixmap, &root, &x, &y, &pixmapWidth, &pixmapHeight, &borderWidth, &depth ) &&
+        PrepareSharedImage( width, height, depth ) )
+    {
+      XErrorTrap errorTrap( mDisplay );
+      if( XShmGetImage( mDisplay, pixmap, mSharedImage, 0, 0, AllPlanes ) && !errorTrap.HasFailed() )
+      {
+        return imageFunction( *mSharedImage );
+      }
+      DALI_LOG_ERROR( "XShmGetImage failed, falling back to XGetImage\n" );
+    }
+  }
+#endif
+
+  XImage* image = XGetImage( mDisplay, pixmap, 0, 0, width, height, AllPlanes, ZPixmap );
+  if( !image )
+  {
+    DALI_LOG_ERROR( "Could not retrieve Ximage.\n" );
+    return false;
+  }
+
+  const bool success = imageFunction( *image );
+  XDestroyImage( image );
+  return success;
+}
+
+bool PixmapReaderX::IsSharedMemoryUsed() const
+{
+  return mSharedMemoryUsed;
+}
+
+#ifdef DALI_XSHM_AVAILABLE
+bool PixmapReaderX::PrepareSharedImage( uint32_t width, uint32_t height, uint32_t depth )
+{
+  if( mSharedImage &&
+      static_cast<uint32_t>( mSharedImage->width ) == width &&
+      static_cast<uint32_t>( mSharedImage->height ) == height &&
+      static_cast<uint32_t>( mSharedImage->depth ) == depth )
+  {
+    return true;
+  }
+
+  DestroySharedImage();
+
+  const int screen = DefaultScreen( mDisplay );
+  mSharedImage = XShmCreateImage( mDisplay, DefaultVisual( mDisplay, screen ), depth, ZPixmap, nullptr, &mSegmentInfo, width, height );
+  if( !mSharedImage )
+  {
+    return false;
+  }
+
+  mSegmentInfo.shmid = shmget( IPC_PRIVATE, static_cast<size_t>( mSharedImage->bytes_per_line ) * height, IPC_CREAT | 0600 );
+  if( mSegmentInfo.shmid < 0 )
+  {
+    DALI_LOG_ERROR( "Could not create a shared memory segment to read pixmaps\n" );
+    XDestroyImage( mSharedImage );
+    mSharedImage = nullptr;
+    return false;
+  }
+
+  mSegmentInfo.shmaddr = mSharedImage->data = static_cast<char*>( shmat( mSegmentInfo.shmid, nullptr, 0 ) );
+  mSegmentInfo.readOnly = False;
+
+  bool attached = false;
+  if( mSegmentInfo.shmaddr != reinterpret_cast<char*>( -1 ) )
+  {
+    XErrorTrap errorTrap( mDisplay );
+    attached = XShmAttach( mDisplay, &mSegmentInfo ) && !errorTrap.HasFailed();
+  }
+
+  // Marked for removal now, so the segment is freed even if the process is killed. It lives until detached.
+  shmctl( mSegmentInfo.shmid, IPC_RMID, nullptr );
+
+  if( !attached )
+  {
+    // Most likely a remote display: the next reads use XGetImage().
+    DALI_LOG_ERROR( "Could not attach a shared memory segment to the display, MIT-SHM disabled\n" );
+    if( mSegmentInfo.shmaddr != reinterpret_cast<char*>( -1 ) )
+    {
+      shmdt( mSegmentInfo.shmaddr );
+    }
+    mSharedImage->data = nullptr;
+    XDestroyImage( mSharedImage );
+    mSharedImage = nullptr;
+    mSharedMemoryUsed = false;
+    return false;
+  }
+
+  return true;
+}
+
+void PixmapReaderX::DestroySharedImage()
+{
+  if( mSharedImage )
+  {
+    XShmDetach( mDisplay, &mSegmentInfo );
+    XSync( mDisplay, False );
+    mSharedImage->data = nullptr;
+    XDestroyImage( mSharedImage );
+    shmdt( mSegmentInfo.shmaddr );
+    mSharedImage = nullptr;
+  }
+}
+#endif
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
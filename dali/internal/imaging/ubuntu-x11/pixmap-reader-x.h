@@ -0,0 +1,121 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXMAP_READER_X_H
+#define DALI_INTERNAL_ADAPTOR_PIXMAP_READER_X_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <X11/Xlib.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <cstdint>
+#include <functional>
+
+#ifdef DALI_XSHM_AVAILABLE
+#include <X11/extensions/XShm.h>
+#endif
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Reads the pixels of X pixmaps.
+ *
+ * When the X server supports MIT-SHM, the pixels are copied by the server into a shared memory segment,
+ * which is kept and reused by the next reads of the same size and depth, instead of being sent through
+ * the socket by XGetImage(). Otherwise, or if the shared memory can't be attached (e.g. a remote
+ * display), it falls back to XGetImage().
+ *
+ * The reader keeps its own display connection open.
+ */
+class PixmapReaderX
+{
+public:
+
+  /**
+   * @brief Called with the image read, which is only valid during the call.
+   *
+   * @param[in] image The image
+   * @return Whether the pixels were used successfully.
+   */
+  typedef std::function<bool( const XImage& image )> ImageFunction;
+
+  /**
+   * @brief Constructor.
+   */
+  PixmapReaderX();
+
+  /**
+   * @brief Destructor. Releases the shared memory segment and closes the display connection.
+   */
+  ~PixmapReaderX();
+
+  /**
+   * @brief Reads the pixels of a pixmap.
+   *
+   * @param[in] pixmap The pixmap
+   * @param[in] width The width of the pixmap
+   * @param[in] height The height of the pixmap
+   * @param[in] imageFunction Called with the image read
+   * @return Whether the pixels were read and imageFunction succeeded.
+   */
+  bool Read( Pixmap pixmap, uint32_t width, uint32_t height, const ImageFunction& imageFunction );
+
+  /**
+   * @brief Whether the pixels are read through shared memory.
+   */
+  bool IsSharedMemoryUsed() const;
+
+private:
+
+  // Undefined
+  PixmapReaderX( const PixmapReaderX& ) = delete;
+  PixmapReaderX& operator=( const PixmapReaderX& ) = delete;
+
+#ifdef DALI_XSHM_AVAILABLE
+  /**
+   * @brief Creates the shared image, unless there is one of this size and depth.
+   *
+   * @return Whether there is a shared image.
+   */
+  bool PrepareSharedImage( uint32_t width, uint32_t height, uint32_t depth );
+
+  /**
+   * @brief Detaches and releases the shared image.
+   */
+  void DestroySharedImage();
+
+  XShmSegmentInfo mSegmentInfo;     ///< The shared memory segment of mSharedImage
+  XImage*         mSharedImage;     ///< The image in shared memory, reused by the reads
+#endif
+
+  Mutex           mMutex;           ///< Serializes the reads, which share the connection and the segment
+  Display*        mDisplay;         ///< The display connection
+  bool            mSharedMemoryUsed;///< Whether MIT-SHM works for this connection
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXMAP_READER_X_H
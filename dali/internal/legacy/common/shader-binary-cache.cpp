@@ -0,0 +1,695 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/legacy/common/shader-binary-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+
+namespace TizenPlatform
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gShaderBinaryLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_SHADER_BINARY_CACHE" );
+#endif
+
+const uint32_t INDEX_MAGIC = 0x43425344u; ///< "DSBC"
+const uint32_t INDEX_VERSION = 1u;
+const char* const INDEX_FILE_NAME = "dali-shader-binaries.idx";
+const uint32_t DEFAULT_MAXIMUM_SIZE = 8u * 1024u * 1024u; ///< The default maximum size of the binaries in bytes.
+const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+const uint32_t FNV_PRIME = 16777619u;
+
+/**
+ * @brief Computes the 32 bit FNV-1a hash of a buffer, used as checksum.
+ */
+uint32_t ComputeChecksum( const unsigned char* buffer, size_t size, uint32_t checksum = FNV_OFFSET_BASIS )
+{
+  for( size_t index = 0u; index < size; ++index )
+  {
+    checksum = ( checksum ^ buffer[index] ) * FNV_PRIME;
+  }
+  return checksum;
+}
+
+uint32_t GetMicroseconds( std::chrono::steady_clock::time_point start )
+{
+  return static_cast<uint32_t>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count() );
+}
+
+/**
+ * @brief Reads a whole file.
+ *
+ * @return @e true if the file was read.
+ */
+bool ReadWholeFile( const std::string& path, Dali::Vector<unsigned char>& buffer )
+{
+  FILE* file = fopen( path.c_str(), "rb" );
+  if( nullptr == file )
+  {
+    return false;
+  }
+
+  bool result = false;
+  if( ( fseek( file, 0, SEEK_END ) == 0 ) )
+  {
+    const long size = ftell( file );
+    if( ( size >= 0 ) && ( fseek( file, 0, SEEK_SET ) == 0 ) )
+    {
+      buffer.Resize( static_cast<size_t>( size ) );
+      result = ( fread( buffer.Begin(), 1u, buffer.Count(), file ) == buffer.Count() );
+    }
+  }
+  fclose( file );
+
+  return result;
+}
+
+/**
+ * @brief Writes a file to a temporary file renamed over the file, which replaces the file atomically.
+ *
+ * @return @e true if the file was written.
+ */
+bool WriteWholeFile( const std::string& path, const unsigned char* buffer, size_t size )
+{
+  const std::string temporaryPath = path + '.' + std::to_string( getpid() );
+  FILE* file = fopen( temporaryPath.c_str(), "wb" );
+  if( nullptr == file )
+  {
+    return false;
+  }
+
+  const bool written = ( fwrite( buffer, 1u, size, file ) == size );
+  const bool closed = ( fclose( file ) == 0 );
+  if( !written || !closed || ( rename( temporaryPath.c_str(), path.c_str() ) != 0 ) )
+  {
+    unlink( temporaryPath.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Serializes the index into a buffer in the native byte order.
+ */
+class Writer
+{
+public:
+
+  void Write32( uint32_t value )
+  {
+    Write( &value, sizeof( value ) );
+  }
+
+  void WriteString( const std::string& string )
+  {
+    Write32( static_cast<uint32_t>( string.size() ) );
+    Write( string.data(), string.size() );
+  }
+
+  void Write( const void* data, size_t size )
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>( data );
+    mBuffer.insert( mBuffer.end(), bytes, bytes + size );
+  }
+
+  const std::vector<unsigned char>& GetBuffer() const
+  {
+    return mBuffer;
+  }
+
+private:
+
+  std::vector<unsigned char> mBuffer;
+};
+
+/**
+ * @brief Deserializes the index. Any read past the end of the buffer fails the reader.
+ */
+class Reader
+{
+public:
+
+  Reader( const unsigned char* buffer, size_t size )
+  : mBuffer( buffer ),
+    mSize( size ),
+    mPosition( 0u ),
+    mFailed( false )
+  {
+  }
+
+  uint32_t Read32()
+  {
+    uint32_t value = 0u;
+    Read( &value, sizeof( value ) );
+    return value;
+  }
+
+  std::string ReadString()
+  {
+    const uint32_t size = Read32();
+    if( mFailed || ( size > mSize - mPosition ) )
+    {
+      mFailed = true;
+      return std::string();
+    }
+
+    std::string string( reinterpret_cast<const char*>( mBuffer + mPosition ), size );
+    mPosition += size;
+    return string;
+  }
+
+  bool HasFailed() const
+  {
+    return mFailed;
+  }
+
+private:
+
+  void Read( void* data, size_t size )
+  {
+    if( mFailed || ( size > mSize - mPosition ) )
+    {
+      mFailed = true;
+      return;
+    }
+
+    memcpy( data, mBuffer + mPosition, size );
+    mPosition += size;
+  }
+
+  const unsigned char* mBuffer;
+  size_t mSize;
+  size_t mPosition;
+  bool mFailed;
+};
+
+} // unnamed namespace
+
+ShaderBinaryCache::ShaderBinaryCache()
+: mConditionalWait(),
+  mDirectory(),
+  mDriver(),
+  mEntries(),
+  mPreloaded(),
+  mPending(),
+  mWorker(),
+  mStatistics(),
+  mMaximumSize( DEFAULT_MAXIMUM_SIZE ),
+  mTotalSize( 0u ),
+  mUseCounter( 0u ),
+  mIsPreloading( false ),
+  mIndexModified( false )
+{
+  const char* environmentValue = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_SHADER_BINARY_CACHE_SIZE );
+  if( environmentValue )
+  {
+    mMaximumSize = static_cast<uint32_t>( std::strtoul( environmentValue, nullptr, 10 ) * 1024u );
+  }
+}
+
+ShaderBinaryCache::~ShaderBinaryCache()
+{
+  StopPreloading();
+
+  // Keeps the order of use of the binaries for the next run.
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( mIndexModified )
+  {
+    WriteIndex();
+  }
+}
+
+void ShaderBinaryCache::SetDirectory( const std::string& directory )
+{
+  StopPreloading();
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( mIndexModified )
+  {
+    WriteIndex();
+  }
+
+  mDirectory = directory;
+  ReadIndex();
+}
+
+void ShaderBinaryCache::SetMaximumSize( uint32_t maximumSize )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mMaximumSize = maximumSize;
+  Evict( std::string() );
+}
+
+void ShaderBinaryCache::SetDriver( const std::string& driver )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( driver == mDriver )
+  {
+    return;
+  }
+
+  if( !mEntries.empty() )
+  {
+    DALI_LOG_RELEASE_INFO( "The GL driver changed, %u shader binaries discarded\n", static_cast<uint32_t>( mEntries.size() ) );
+
+    while( !mEntries.empty() )
+    {
+      Remove( std::string( mEntries.begin()->first ) );
+    }
+  }
+
+  mDriver = driver;
+  mIndexModified = true;
+
+  // Wakes up a caller waiting for a binary which is not preloaded anymore.
+  mConditionalWait.Notify( lock );
+}
+
+void ShaderBinaryCache::Preload( const std::vector<std::string>& names )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( mIsPreloading )
+  {
+    return;
+  }
+
+  std::vector<std::string> preloadNames;
+  if( names.empty() )
+  {
+    std::vector<std::pair<uint32_t, std::string>> entries;
+    for( const auto& entry : mEntries )
+    {
+      entries.push_back( std::make_pair( entry.second.lastUsed, entry.first ) );
+    }
+    std::sort( entries.begin(), entries.end(), std::greater<std::pair<uint32_t, std::string>>() );
+
+    for( auto& entry : entries )
+    {
+      preloadNames.push_back( std::move( entry.second ) );
+    }
+  }
+  else
+  {
+    for( const auto& name : names )
+    {
+      if( ( mEntries.find( name ) != mEntries.end() ) && ( mPreloaded.find( name ) == mPreloaded.end() ) )
+      {
+        preloadNames.push_back( name );
+      }
+    }
+  }
+
+  if( preloadNames.empty() )
+  {
+    return;
+  }
+
+  // The previous worker doesn't take the lock anymore once it isn't preloading.
+  if( mWorker.joinable() )
+  {
+    mWorker.join();
+  }
+
+  mPending.insert( preloadNames.begin(), preloadNames.end() );
+  mIsPreloading = true;
+  mWorker = std::thread( &ShaderBinaryCache::Run, this, std::move( preloadNames ) );
+}
+
+void ShaderBinaryCache::ReleasePreloaded()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  DALI_LOG_INFO( gShaderBinaryLogFilter, Debug::General, "Releasing %u preloaded shader binaries, %u not read yet\n",
+                 static_cast<uint32_t>( mPreloaded.size() ), static_cast<uint32_t>( mPending.size() ) );
+
+  // The worker discards the binary it is reading and stops; it is joined by the next preloading.
+  mPending.clear();
+  mPreloaded.clear();
+
+  // Wakes up a caller waiting for a binary which is not preloaded anymore.
+  mConditionalWait.Notify( lock );
+}
+
+bool ShaderBinaryCache::Load( const std::string& name, Dali::Vector<unsigned char>& buffer )
+{
+  Entry entry = {};
+  std::string path;
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+
+    if( mPending.find( name ) != mPending.end() )
+    {
+      const auto start = std::chrono::steady_clock::now();
+      while( mPending.find( name ) != mPending.end() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+      mStatistics.waitTime += GetMicroseconds( start );
+    }
+
+    auto entryIt = mEntries.find( name );
+    if( entryIt == mEntries.end() )
+    {
+      ++mStatistics.misses;
+      return false;
+    }
+
+    entryIt->second.lastUsed = ++mUseCounter;
+    mIndexModified = true;
+
+    auto preloadedIt = mPreloaded.find( name );
+    if( preloadedIt != mPreloaded.end() )
+    {
+      buffer.Swap( preloadedIt->second );
+      mPreloaded.erase( preloadedIt );
+      ++mStatistics.preloadHits;
+      return true;
+    }
+
+    entry = entryIt->second;
+    path = mDirectory + name;
+  }
+
+  const bool result = ReadWholeFile( path, buffer ) &&
+                      ( buffer.Count() == entry.size ) &&
+                      ( ComputeChecksum( buffer.Begin(), buffer.Count() ) == entry.checksum );
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( result )
+  {
+    ++mStatistics.fileHits;
+  }
+  else
+  {
+    DALI_LOG_INFO( gShaderBinaryLogFilter, Debug::General, "Shader binary %s is corrupted\n", name.c_str() );
+
+    auto entryIt = mEntries.find( name );
+    if( ( entryIt != mEntries.end() ) && ( entryIt->second.checksum == entry.checksum ) )
+    {
+      Remove( name );
+    }
+    ++mStatistics.misses;
+    buffer.Clear();
+  }
+
+  return result;
+}
+
+bool ShaderBinaryCache::Save( const std::string& name, const unsigned char* buffer, uint32_t numBytes )
+{
+  std::string path;
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    if( numBytes > mMaximumSize )
+    {
+      return false;
+    }
+    path = mDirectory + name;
+  }
+
+  if( !WriteWholeFile( path, buffer, numBytes ) )
+  {
+    DALI_LOG_ERROR( "Failed to write the shader binary [%s]\n", path.c_str() );
+    return false;
+  }
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  // An older binary with the same name is replaced.
+  auto entryIt = mEntries.find( name );
+  if( entryIt != mEntries.end() )
+  {
+    mTotalSize -= entryIt->second.size;
+  }
+  mPreloaded.erase( name );
+
+  Entry& entry = mEntries[name];
+  entry.size = numBytes;
+  entry.checksum = ComputeChecksum( buffer, numBytes );
+  entry.lastUsed = ++mUseCounter;
+  mTotalSize += numBytes;
+
+  Evict( name );
+
+  mIndexModified = true;
+  return WriteIndex();
+}
+
+ShaderBinaryCache::Statistics ShaderBinaryCache::GetStatistics() const
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  return mStatistics;
+}
+
+void ShaderBinaryCache::ReadIndex()
+{
+  mEntries.clear();
+  mPreloaded.clear();
+  mDriver.clear();
+  mTotalSize = 0u;
+  mUseCounter = 0u;
+  mIndexModified = false;
+
+  Dali::Vector<unsigned char> buffer;
+  if( !ReadWholeFile( mDirectory + INDEX_FILE_NAME, buffer ) || ( buffer.Count() < sizeof( uint32_t ) ) )
+  {
+    return;
+  }
+
+  // The index ends with the checksum of the rest of the index.
+  const size_t size = buffer.Count() - sizeof( uint32_t );
+  uint32_t checksum = 0u;
+  memcpy( &checksum, buffer.Begin() + size, sizeof( checksum ) );
+  if( ComputeChecksum( buffer.Begin(), size ) != checksum )
+  {
+    DALI_LOG_ERROR( "The shader binary index is corrupted [%s%s]\n", mDirectory.c_str(), INDEX_FILE_NAME );
+    return;
+  }
+
+  Reader reader( buffer.Begin(), size );
+  if( ( reader.Read32() != INDEX_MAGIC ) || ( reader.Read32() != INDEX_VERSION ) )
+  {
+    return;
+  }
+
+  std::string driver = reader.ReadString();
+  const uint32_t useCounter = reader.Read32();
+  const uint32_t count = reader.Read32();
+
+  std::unordered_map<std::string, Entry> entries;
+  uint32_t totalSize = 0u;
+  for( uint32_t index = 0u; ( index < count ) && !reader.HasFailed(); ++index )
+  {
+    std::string name = reader.ReadString();
+    Entry entry;
+    entry.size = reader.Read32();
+    entry.checksum = reader.Read32();
+    entry.lastUsed = reader.Read32();
+
+    totalSize += entry.size;
+    entries[std::move( name )] = entry;
+  }
+
+  if( reader.HasFailed() )
+  {
+    return;
+  }
+
+  mEntries.swap( entries );
+  mDriver.swap( driver );
+  mTotalSize = totalSize;
+  mUseCounter = useCounter;
+
+  DALI_LOG_INFO( gShaderBinaryLogFilter, Debug::General, "Read the index of %u shader binaries, %u bytes\n", count, mTotalSize );
+}
+
+bool ShaderBinaryCache::WriteIndex()
+{
+  Writer writer;
+  writer.Write32( INDEX_MAGIC );
+  writer.Write32( INDEX_VERSION );
+  writer.WriteString( mDriver );
+  writer.Write32( mUseCounter );
+  writer.Write32( static_cast<uint32_t>( mEntries.size() ) );
+  for( const auto& entry : mEntries )
+  {
+    writer.WriteString( entry.first );
+    writer.Write32( entry.second.size );
+    writer.Write32( entry.second.checksum );
+    writer.Write32( entry.second.lastUsed );
+  }
+
+  const std::vector<unsigned char>& buffer = writer.GetBuffer();
+  writer.Write32( ComputeChecksum( buffer.data(), buffer.size() ) );
+
+  if( !WriteWholeFile( mDirectory + INDEX_FILE_NAME, buffer.data(), buffer.size() ) )
+  {
+    DALI_LOG_ERROR( "Failed to write the shader binary index [%s%s]\n", mDirectory.c_str(), INDEX_FILE_NAME );
+    return false;
+  }
+
+  mIndexModified = false;
+  return true;
+}
+
+void ShaderBinaryCache::Remove( const std::string& name )
+{
+  auto entryIt = mEntries.find( name );
+  if( entryIt == mEntries.end() )
+  {
+    return;
+  }
+
+  mTotalSize -= entryIt->second.size;
+  mEntries.erase( entryIt );
+  mPreloaded.erase( name );
+  mPending.erase( name );
+  mIndexModified = true;
+
+  unlink( ( mDirectory + name ).c_str() );
+}
+
+void ShaderBinaryCache::Evict( const std::string& keep )
+{
+  while( mTotalSize > mMaximumSize )
+  {
+    auto oldestIt = mEntries.end();
+    for( auto entryIt = mEntries.begin(); entryIt != mEntries.end(); ++entryIt )
+    {
+      if( ( entryIt->first != keep ) &&
+          ( ( oldestIt == mEntries.end() ) || ( entryIt->second.lastUsed < oldestIt->second.lastUsed ) ) )
+      {
+        oldestIt = entryIt;
+      }
+    }
+
+    if( oldestIt == mEntries.end() )
+    {
+      break;
+    }
+
+    DALI_LOG_INFO( gShaderBinaryLogFilter, Debug::Verbose, "Evicting shader binary %s\n", oldestIt->first.c_str() );
+    Remove( std::string( oldestIt->first ) );
+  }
+}
+
+void ShaderBinaryCache::StopPreloading()
+{
+  if( !mWorker.joinable() )
+  {
+    return;
+  }
+
+  {
+    // The worker stops after the binary it is reading.
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mPending.clear();
+  }
+  mWorker.join();
+}
+
+void ShaderBinaryCache::Run( std::vector<std::string> names )
+{
+  const auto start = std::chrono::steady_clock::now();
+  uint32_t preloadedBytes = 0u;
+  uint32_t preloadedBinaries = 0u;
+
+  for( const auto& name : names )
+  {
+    Entry entry = {};
+    std::string path;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      if( mPending.empty() )
+      {
+        // Stopped
+        break;
+      }
+
+      auto entryIt = mEntries.find( name );
+      if( mPending.find( name ) == mPending.end() || entryIt == mEntries.end() )
+      {
+        // Removed since the preloading started.
+        continue;
+      }
+      entry = entryIt->second;
+      path = mDirectory + name;
+    }
+
+    Dali::Vector<unsigned char> buffer;
+    const bool result = ReadWholeFile( path, buffer ) &&
+                        ( buffer.Count() == entry.size ) &&
+                        ( ComputeChecksum( buffer.Begin(), buffer.Count() ) == entry.checksum );
+
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    if( mPending.erase( name ) > 0u )
+    {
+      auto entryIt = mEntries.find( name );
+      if( ( entryIt != mEntries.end() ) && ( entryIt->second.checksum == entry.checksum ) )
+      {
+        if( result )
+        {
+          preloadedBytes += entry.size;
+          ++preloadedBinaries;
+          mPreloaded[name].Swap( buffer );
+        }
+        else
+        {
+          DALI_LOG_INFO( gShaderBinaryLogFilter, Debug::General, "Shader binary %s is corrupted\n", name.c_str() );
+          Remove( name );
+        }
+      }
+    }
+
+    // Wakes up a caller waiting for the binary.
+    mConditionalWait.Notify( lock );
+  }
+
+  const uint32_t preloadTime = GetMicroseconds( start );
+  DALI_LOG_RELEASE_INFO( "Preloaded %u shader binaries, %u bytes in %u us\n", preloadedBinaries, preloadedBytes, preloadTime );
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mPending.clear();
+  mStatistics.preloadedBinaries += preloadedBinaries;
+  mStatistics.preloadTime += preloadTime;
+  mIsPreloading = false;
+  mConditionalWait.Notify( lock );
+}
+
+} // namespace TizenPlatform
+
+} // namespace Dali
@@ -0,0 +1,212 @@
+#ifndef DALI_TIZEN_PLATFORM_SHADER_BINARY_CACHE_H
+#define DALI_TIZEN_PLATFORM_SHADER_BINARY_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/common/dali-vector.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Dali
+{
+
+namespace TizenPlatform
+{
+
+/**
+ * @brief The program binaries saved by Core after compiling its shaders, kept in a directory between runs.
+ *
+ * The binaries are named by Core after a hash of the shader sources. The cache keeps an index of them with
+ * the size and checksum of each binary, and the vendor, renderer and version of the GL driver which built
+ * them: a binary whose checksum doesn't match is discarded, and the whole cache is discarded when the driver
+ * changes. The least recently used binaries are removed when the binaries exceed the size of the cache.
+ * The index and the binaries are written to a temporary file renamed over the previous one, so a crash
+ * never leaves a partially written file behind.
+ *
+ * The binaries may be preloaded on a worker thread while the graphics are being initialized, to take the
+ * file reads off the first frame. The cache is thread safe.
+ */
+class ShaderBinaryCache
+{
+public:
+
+  /**
+   * @brief The time spent by the cache, to see what the preloading saves.
+   */
+  struct Statistics
+  {
+    uint32_t preloadedBinaries{0u}; ///< The number of binaries read by the preloading
+    uint32_t preloadTime{0u};       ///< How long the preloading took, in microseconds
+    uint32_t preloadHits{0u};       ///< The number of binaries loaded from the preloaded ones
+    uint32_t fileHits{0u};          ///< The number of binaries read when loaded
+    uint32_t misses{0u};            ///< The number of binaries not in the cache or discarded
+    uint32_t waitTime{0u};          ///< How long loading waited for the preloading of a binary, in microseconds
+  };
+
+  /**
+   * @brief Constructor. The maximum size of the cache is given by DALI_SHADER_BINARY_CACHE_SIZE.
+   */
+  ShaderBinaryCache();
+
+  /**
+   * @brief Destructor. Waits for the preloading and saves the index if the binaries were used.
+   */
+  ~ShaderBinaryCache();
+
+  /**
+   * @brief Sets the directory of the cache and reads its index.
+   *
+   * @param[in] directory The directory, which the names of the binaries are appended to.
+   */
+  void SetDirectory( const std::string& directory );
+
+  /**
+   * @brief Sets the maximum size of the binaries. The least recently used binaries are removed when it is exceeded.
+   *
+   * @param[in] maximumSize The size in bytes.
+   */
+  void SetMaximumSize( uint32_t maximumSize );
+
+  /**
+   * @brief Sets the GL driver the binaries are built for. The cache is discarded if it was built by another driver.
+   *
+   * @param[in] driver The vendor, renderer and version of the GL driver.
+   */
+  void SetDriver( const std::string& driver );
+
+  /**
+   * @brief Reads binaries in the cache on a worker thread, so they are in memory when loaded.
+   *
+   * Does nothing if a preloading is in progress.
+   *
+   * @param[in] names The names of the binaries to read. If empty, all the binaries are read, most recently used first.
+   */
+  void Preload( const std::vector<std::string>& names );
+
+  /**
+   * @brief Frees the preloaded binaries which haven't been loaded, and stops the preloading.
+   *
+   * Called once the shaders needed at startup are loaded, so the binaries never loaded don't stay in memory.
+   * A binary released is read from its file when loaded.
+   */
+  void ReleasePreloaded();
+
+  /**
+   * @brief Loads a binary. Waits for the binary if it is being preloaded.
+   *
+   * @param[in] name The name of the binary.
+   * @param[out] buffer The binary.
+   *
+   * @return @e true if the binary is in the cache and its checksum is valid.
+   */
+  bool Load( const std::string& name, Dali::Vector<unsigned char>& buffer );
+
+  /**
+   * @brief Saves a binary and the index.
+   *
+   * @param[in] name The name of the binary.
+   * @param[in] buffer The binary.
+   * @param[in] numBytes The size of the binary.
+   *
+   * @return @e true if the binary was written.
+   */
+  bool Save( const std::string& name, const unsigned char* buffer, uint32_t numBytes );
+
+  /**
+   * @brief Retrieves the time spent by the cache.
+   */
+  Statistics GetStatistics() const;
+
+private:
+
+  // Undefined
+  ShaderBinaryCache( const ShaderBinaryCache& ) = delete;
+  ShaderBinaryCache& operator=( const ShaderBinaryCache& ) = delete;
+
+  /**
+   * @brief A binary of the index.
+   */
+  struct Entry
+  {
+    uint32_t size;     ///< The size of the binary in bytes
+    uint32_t checksum; ///< The checksum of the binary
+    uint32_t lastUsed; ///< The value of mUseCounter when the binary was last loaded or saved
+  };
+
+  /**
+   * @brief Reads the index. Called with the lock held.
+   */
+  void ReadIndex();
+
+  /**
+   * @brief Writes the index. Called with the lock held.
+   */
+  bool WriteIndex();
+
+  /**
+   * @brief Removes a binary from the index and its file. Called with the lock held.
+   */
+  void Remove( const std::string& name );
+
+  /**
+   * @brief Removes the least recently used binaries until the cache fits its maximum size. Called with the lock held.
+   *
+   * @param[in] keep The name of a binary which is not removed.
+   */
+  void Evict( const std::string& keep );
+
+  /**
+   * @brief Waits for the worker thread, if any. Called without the lock.
+   */
+  void StopPreloading();
+
+  /**
+   * @brief The loop of the worker thread. Reads the binaries in mPending.
+   *
+   * @param[in] names The binaries in the order they are read.
+   */
+  void Run( std::vector<std::string> names );
+
+private:
+
+  mutable ConditionalWait mConditionalWait; ///< Guards the members below; loading waits on it for a binary being preloaded
+  std::string mDirectory;                   ///< The directory of the cache
+  std::string mDriver;                      ///< The GL driver which built the binaries
+  std::unordered_map<std::string, Entry> mEntries; ///< The binaries of the index
+  std::unordered_map<std::string, Dali::Vector<unsigned char>> mPreloaded; ///< The binaries preloaded and not loaded yet
+  std::unordered_set<std::string> mPending; ///< The binaries still to be preloaded
+  std::thread mWorker;                      ///< The preloading thread
+  Statistics  mStatistics;                  ///< The time spent by the cache
+  uint32_t    mMaximumSize;                 ///< The maximum size of the binaries in bytes
+  uint32_t    mTotalSize;                   ///< The size of the binaries in bytes
+  uint32_t    mUseCounter;                  ///< Incremented whenever a binary is loaded or saved
+  bool        mIsPreloading;                ///< Whether the worker thread is preloading
+  bool        mIndexModified;               ///< Whether the index changed since it was read or written
+};
+
+} // namespace TizenPlatform
+
+} // namespace Dali
+
+#endif // DALI_TIZEN_PLATFORM_SHADER_BINARY_CACHE_H
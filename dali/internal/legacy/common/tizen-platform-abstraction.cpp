@@ -20,12 +20,15 @@
 
 // EXTERNAL INCLUDES
 #include <dirent.h>
+#include <unistd.h>
+#include <cstdio>
 #include <fstream>
 #include <algorithm>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/integration-api/resource-types.h>
 #include <dali/public-api/signals/callback.h>
+#include <dali/devel-api/adaptor-framework/file-loader.h>
 
 // INTERNAL INCLUDES
 #include <dali/internal/adaptor/common/adaptor-impl.h>
@@ -73,8 +76,8 @@ uint32_t TizenPlatformAbstraction::TimerCallback::sNextTimerId = 0;
 TizenPlatformAbstraction::TizenPlatformAbstraction()
 : mDataStoragePath( "" ),
   mTimerPairsWaiting(),
-  mTimerPairsSpent()
-
+  mTimerPairsSpent(),
+  mShaderBinaryCache()
 {
 }
 
@@ -150,20 +153,16 @@ bool TizenPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename
   bool result = false;
 
 #ifdef SHADERBIN_CACHE_ENABLED
-  std::string path;
-
   // First check the system location where shaders are stored at install time:
-  path = DALI_SHADERBIN_DIR;
+  std::string path = DALI_SHADERBIN_DIR;
   path += filename;
-  result = LoadFile( path, buffer );
+  result = Dali::FileLoader::ReadFile( path, buffer ) != 0;
 
   // Fallback to the cache of shaders stored after previous runtime compilations:
   // On desktop this looks in the current working directory that the app was launched from.
-  if( mResourceLoader && result == false )
+  if( !result )
   {
-    path = mDataStoragePath;
-    path += filename;
-    result = LoadFile( path, buffer );
+    result = mShaderBinaryCache.Load( filename, buffer );
   }
 #endif
 
@@ -178,9 +177,7 @@ bool TizenPlatformAbstraction::SaveShaderBinaryFile( const std::string& filename
 
   // Use the cache of shaders stored after previous runtime compilations:
   // On desktop this looks in the current working directory that the app was launched from.
-  std::string path = mDataStoragePath;
-  path += filename;
-  result = SaveFile( path, buffer, numBytes );
+  result = mShaderBinaryCache.Save( filename, buffer, numBytes );
 
 #endif
 
@@ -190,6 +187,31 @@ bool TizenPlatformAbstraction::SaveShaderBinaryFile( const std::string& filename
 void TizenPlatformAbstraction::SetDataStoragePath( const std::string& path )
 {
   mDataStoragePath = path;
+
+#ifdef SHADERBIN_CACHE_ENABLED
+  mShaderBinaryCache.SetDirectory( path );
+#endif
+}
+
+void TizenPlatformAbstraction::SetGraphicsDriver( const std::string& driver )
+{
+#ifdef SHADERBIN_CACHE_ENABLED
+  mShaderBinaryCache.SetDriver( driver );
+#endif
+}
+
+void TizenPlatformAbstraction::PreloadShaderBinaryFiles( const std::vector< std::string >& filenames )
+{
+#ifdef SHADERBIN_CACHE_ENABLED
+  mShaderBinaryCache.Preload( filenames );
+#endif
+}
+
+void TizenPlatformAbstraction::ReleasePreloadedShaderBinaryFiles()
+{
+#ifdef SHADERBIN_CACHE_ENABLED
+  mShaderBinaryCache.ReleasePreloaded();
+#endif
 }
 
 uint32_t TizenPlatformAbstraction::StartTimer( uint32_t milliseconds, CallbackBase* callback )
@@ -283,6 +305,29 @@ bool SaveFile( const std::string& filename, const unsigned char * buffer, unsign
   return result;
 }
 
+bool SaveFileAtomically( const std::string& filename, const unsigned char * buffer, unsigned int numBytes )
+{
+  DALI_ASSERT_DEBUG( 0 != filename.length());
+
+  const std::string temporaryFilename = filename + '.' + std::to_string( getpid() );
+  FILE* file = fopen( temporaryFilename.c_str(), "wb" );
+  if( nullptr == file )
+  {
+    return false;
+  }
+
+  // The data reaches the disk before the rename, so a crash leaves either the old file or the new one.
+  const bool written = ( fwrite( buffer, 1u, numBytes, file ) == numBytes ) && ( fflush( file ) == 0 ) && ( fsync( fileno( file ) ) == 0 );
+  const bool closed = ( fclose( file ) == 0 );
+  if( !written || !closed || ( rename( temporaryFilename.c_str(), filename.c_str() ) != 0 ) )
+  {
+    unlink( temporaryFilename.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
 }  // namespace TizenPlatform
 
 }  // namespace Dali
@@ -21,12 +21,14 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/dali-adaptor-common.h>
+#include <dali/internal/legacy/common/shader-binary-cache.h>
 
 
 // EXTERNAL INCLUDES
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
 #include <dali/integration-api/platform-abstraction.h>
 
 namespace Dali
@@ -112,6 +114,25 @@ public: // PlatformAbstraction overrides
    */
   void SetDataStoragePath( const std::string& path );
 
+  /**
+   * Sets the GL driver the shader binaries are built for. The cached binaries are discarded if the driver changed.
+   * @param[in] driver The vendor, renderer and version of the GL driver
+   */
+  void SetGraphicsDriver( const std::string& driver );
+
+  /**
+   * Reads cached shader binaries on a worker thread, so they are in memory when Core loads them.
+   * The time spent is logged.
+   * @param[in] filenames The shader binaries to read. If empty, all the cached binaries are read, most recently used first.
+   */
+  void PreloadShaderBinaryFiles( const std::vector< std::string >& filenames );
+
+  /**
+   * Frees the preloaded shader binaries which haven't been loaded, and stops the preloading.
+   * They are read again if Core loads them later.
+   */
+  void ReleasePreloadedShaderBinaryFiles();
+
   /**
    * Clears the timers that have completed
    */
@@ -133,6 +154,8 @@ private:
 
   std::vector< std::unique_ptr< TimerCallback > > mTimerPairsWaiting;
   std::vector< std::unique_ptr< TimerCallback > > mTimerPairsSpent;
+
+  mutable ShaderBinaryCache mShaderBinaryCache; ///< Loading and saving binaries updates the cache
 };
 
 /**
@@ -150,6 +173,16 @@ TizenPlatformAbstraction* CreatePlatformAbstraction();
  */
 bool SaveFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes );
 
+/**
+ * Save a file to disk atomically: the buffer is written to a temporary file
+ * in the same directory, which is then renamed over the file.
+ * @param filename to create or replace
+ * @param buffer to store
+ * @param numBytes to store
+ * @return true if successful, false otherwise
+ */
+bool SaveFileAtomically( const std::string& filename, const unsigned char * buffer, unsigned int numBytes );
+
 }  // namespace TizenPlatform
 
 }  // namespace Dali
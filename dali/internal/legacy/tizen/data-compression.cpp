@@ -118,7 +118,7 @@ bool DecodeRle( const unsigned char* input,
   // check the decoded data will fit in to
   if( outputLength < decodedSize )
   {
-    DALI_LOG_ERROR("buffer too small, buffer size =%d, data size = %d \n",outputLength, decodedSize);
+    DALI_LOG_ERROR("buffer too small, buffer size =%zu, data size = %zu \n",outputLength, decodedSize);
     return false;
   }
 
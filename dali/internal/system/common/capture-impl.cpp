@@ -19,6 +19,7 @@
 #include <dali/internal/system/common/capture-impl.h>
 
 // EXTERNAL INCLUDES
+#include <chrono>
 #include <fstream>
 #include <string.h>
 #include <dali/public-api/common/vector-wrapper.h>
@@ -27,12 +28,17 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/adaptor.h>
-#include <dali/devel-api/adaptor-framework/native-image-source-devel.h>
 #include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/internal/imaging/common/async-image-encoder.h>
+#include <dali/internal/system/common/capture-recorder.h>
 
 namespace
 {
 unsigned int TIME_OUT_DURATION = 1000;
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gCaptureLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_CAPTURE" );
+#endif
 }
 
 namespace Dali
@@ -45,21 +51,27 @@ namespace Adaptor
 {
 
 Capture::Capture()
-: mQuality( DEFAULT_QUALITY ),
+: mEncodingOptions(),
   mTimer(),
   mPath(),
   mNativeImageSourcePtr( NULL ),
-  mFileSave( false )
+  mFileSave( false ),
+  mAsynchronousEncoding( false ),
+  mRecorder(),
+  mRecordingStatistics()
 {
 }
 
 Capture::Capture( Dali::CameraActor cameraActor )
-: mQuality( DEFAULT_QUALITY ),
+: mEncodingOptions(),
   mCameraActor( cameraActor ),
   mTimer(),
   mPath(),
   mNativeImageSourcePtr( NULL ),
-  mFileSave( false )
+  mFileSave( false ),
+  mAsynchronousEncoding( false ),
+  mRecorder(),
+  mRecordingStatistics()
 {
 }
 
@@ -84,13 +96,14 @@ CapturePtr Capture::New( Dali::CameraActor cameraActor )
 
 void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string &path, const Dali::Vector4& clearColor, const uint32_t quality )
 {
-  mQuality = quality;
+  mEncodingOptions.quality = quality;
   Start( source, position, size, path, clearColor );
 }
 
 void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string &path, const Dali::Vector4& clearColor )
 {
   DALI_ASSERT_ALWAYS(path.size() > 4 && "Path is invalid.");
+  DALI_ASSERT_ALWAYS(!mRecorder && "Capture is recording.");
 
   // Increase the reference count focely to avoid application mistake.
   Reference();
@@ -109,7 +122,53 @@ void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Da
 
 void Capture::SetImageQuality( uint32_t quality )
 {
-  mQuality = quality;
+  mEncodingOptions.quality = quality;
+}
+
+void Capture::SetEncodingOptions( const EncodingOptions& options )
+{
+  mEncodingOptions = options;
+}
+
+void Capture::SetAsynchronousEncoding( bool asynchronous )
+{
+  mAsynchronousEncoding = asynchronous;
+}
+
+bool Capture::StartRecording( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const Dali::Vector4& clearColor,
+                              const DevelCapture::RecordingOptions& options, DevelCapture::FrameCallback callback, const std::string& path )
+{
+  DALI_ASSERT_ALWAYS(!mRecorder && "Capture is already recording.");
+  DALI_ASSERT_ALWAYS(!IsRenderTaskSetup() && "Capture is capturing.");
+
+  mRecordingStatistics = DevelCapture::RecordingStatistics();
+  mRecorder.reset( new CaptureRecorder() );
+  if( !mRecorder->Start( source, position, size, clearColor, mCameraActor, options, std::move( callback ), path ) )
+  {
+    mRecorder.reset();
+    return false;
+  }
+  return true;
+}
+
+void Capture::StopRecording()
+{
+  if( mRecorder )
+  {
+    mRecorder->Stop();
+    mRecordingStatistics = mRecorder->GetStatistics();
+    mRecorder.reset();
+  }
+}
+
+bool Capture::IsRecording() const
+{
+  return static_cast<bool>( mRecorder );
+}
+
+DevelCapture::RecordingStatistics Capture::GetRecordingStatistics() const
+{
+  return mRecorder ? mRecorder->GetStatistics() : mRecordingStatistics;
 }
 
 Dali::NativeImageSourcePtr Capture::GetNativeImageSource() const
@@ -273,7 +332,22 @@ void Capture::OnRenderFinished( Dali::RenderTask& task )
 
   if( mFileSave )
   {
-    if( !SaveFile() )
+    // With the asynchronous encoding, the event thread is only blocked by the read back of the pixels.
+    const auto startTime = std::chrono::steady_clock::now();
+    AsyncImageEncoder* encoder = mAsynchronousEncoding ? AsyncImageEncoder::Get() : nullptr;
+    const bool saved = encoder ? SaveFileAsynchronously( *encoder ) : SaveFile();
+    DALI_LOG_INFO( gCaptureLogFilter, Debug::General, "Capture blocked the event thread for %lld us saving Path[%s] (%s)\n",
+                   static_cast<long long>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - startTime ).count() ),
+                   mPath.c_str(), encoder ? "asynchronous" : "synchronous" );
+
+    if( saved && encoder )
+    {
+      // The signal is emitted by OnEncodingFinished(), the resources are no longer needed.
+      UnsetResources();
+      return;
+    }
+
+    if( !saved )
     {
       state = Dali::Capture::FinishState::FAILED;
       DALI_LOG_ERROR( "Fail to Capture Path[%s]", mPath.c_str() );
@@ -304,11 +378,66 @@ bool Capture::OnTimeOut()
   return false;
 }
 
+bool Capture::SavePixels( const std::vector<unsigned char>& pixels, unsigned int width, unsigned int height, Pixel::Format pixelFormat,
+                          const std::string& path, const EncodingOptions& options )
+{
+  if( pixels.empty() )
+  {
+    return false;
+  }
+
+  return Dali::EncodeToFile( pixels.data(), path, pixelFormat, width, height, options );
+}
+
 bool Capture::SaveFile()
 {
   DALI_ASSERT_ALWAYS(mNativeImageSourcePtr && "mNativeImageSourcePtr is NULL");
 
-  return Dali::DevelNativeImageSource::EncodeToFile( *mNativeImageSourcePtr, mPath, mQuality );
+  std::vector<unsigned char> pixels;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  Pixel::Format pixelFormat = Pixel::INVALID;
+  if( !mNativeImageSourcePtr->GetPixels( pixels, width, height, pixelFormat ) )
+  {
+    return false;
+  }
+
+  return SavePixels( pixels, width, height, pixelFormat, mPath, mEncodingOptions );
+}
+
+bool Capture::SaveFileAsynchronously( AsyncImageEncoder& encoder )
+{
+  DALI_ASSERT_ALWAYS(mNativeImageSourcePtr && "mNativeImageSourcePtr is NULL");
+
+  std::vector<unsigned char> pixels;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  Pixel::Format pixelFormat = Pixel::INVALID;
+  if( !mNativeImageSourcePtr->GetPixels( pixels, width, height, pixelFormat ) )
+  {
+    return false;
+  }
+
+  // This object is kept alive by the reference taken in Start() until OnEncodingFinished().
+  encoder.Encode( std::move( pixels ), width, height, pixelFormat, mPath, mEncodingOptions,
+                  [this]( bool success ) { OnEncodingFinished( success ); } );
+  return true;
+}
+
+void Capture::OnEncodingFinished( bool success )
+{
+  Dali::Capture::FinishState state = Dali::Capture::FinishState::SUCCEEDED;
+  if( !success )
+  {
+    state = Dali::Capture::FinishState::FAILED;
+    DALI_LOG_ERROR( "Fail to Capture Path[%s]", mPath.c_str() );
+  }
+
+  Dali::Capture handle( this );
+  mFinishedSignal.Emit( handle, state );
+
+  // Decrease the reference count forcely. It is increased at Start().
+  Unreference();
 }
 
 }  // End of namespace Adaptor
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <string>
 #include <memory>
+#include <vector>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/render-tasks/render-task.h>
@@ -32,6 +33,8 @@
 #include <dali/public-api/capture/capture.h>
 #include <dali/public-api/adaptor-framework/native-image-source.h>
 #include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
 
 namespace Dali
 {
@@ -45,6 +48,9 @@ namespace Adaptor
 class Capture;
 typedef IntrusivePtr<Capture> CapturePtr;
 
+class AsyncImageEncoder;
+class CaptureRecorder;
+
 class Capture : public BaseObject, public ConnectionTracker
 {
 public:
@@ -83,6 +89,55 @@ public:
    */
   void SetImageQuality( uint32_t quality );
 
+  /**
+   * @copydoc Dali::DevelCapture::SetEncodingOptions
+   */
+  void SetEncodingOptions( const EncodingOptions& options );
+
+  /**
+   * @copydoc Dali::DevelCapture::SetAsynchronousEncoding
+   */
+  void SetAsynchronousEncoding( bool asynchronous );
+
+  /**
+   * @brief Starts recording to a callback or to a file.
+   *
+   * @see Dali::DevelCapture::StartRecording
+   */
+  bool StartRecording( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const Dali::Vector4& clearColor,
+                       const DevelCapture::RecordingOptions& options, DevelCapture::FrameCallback callback, const std::string& path );
+
+  /**
+   * @copydoc Dali::DevelCapture::StopRecording
+   */
+  void StopRecording();
+
+  /**
+   * @copydoc Dali::DevelCapture::IsRecording
+   */
+  bool IsRecording() const;
+
+  /**
+   * @brief Writes the pixels read back from a capture to a file, on the calling thread.
+   *
+   * The file is written atomically with the encoding options, as the encoder thread writes it.
+   *
+   * @param[in] pixels The pixels read back from the native image
+   * @param[in] width The width of the image
+   * @param[in] height The height of the image
+   * @param[in] pixelFormat The format of the pixels
+   * @param[in] path The path of the file
+   * @param[in] options The settings used to encode the file
+   * @return True if the file was written.
+   */
+  static bool SavePixels( const std::vector<unsigned char>& pixels, unsigned int width, unsigned int height, Pixel::Format pixelFormat,
+                          const std::string& path, const EncodingOptions& options );
+
+  /**
+   * @copydoc Dali::DevelCapture::GetRecordingStatistics
+   */
+  DevelCapture::RecordingStatistics GetRecordingStatistics() const;
+
   /**
    * @copydoc Dali::Capture::GetNativeImageSource
    */
@@ -189,12 +244,27 @@ private:
   bool OnTimeOut();
 
   /**
-   * @brief Save framebuffer.
+   * @brief Read the framebuffer back and write it to the file on the event thread.
    *
    * @return True is success to save, false is fail.
    */
   bool SaveFile();
 
+  /**
+   * @brief Read the framebuffer back and hand it over to the encoder thread.
+   *
+   * @param[in] encoder The encoder of the adaptor
+   * @return True if the pixels were handed over, false if they could not be read.
+   */
+  bool SaveFileAsynchronously( AsyncImageEncoder& encoder );
+
+  /**
+   * @brief Callback when the encoder thread has written the file.
+   *
+   * @param[in] success Whether the file was written.
+   */
+  void OnEncodingFinished( bool success );
+
 private:
 
   // Undefined
@@ -204,7 +274,7 @@ private:
   Capture& operator=( const Capture& rhs );
 
 private:
-  uint32_t                                    mQuality;
+  EncodingOptions                             mEncodingOptions; ///< The settings used to encode the file
   Dali::Texture                               mNativeTexture;
   Dali::FrameBuffer                           mFrameBuffer;
   Dali::RenderTask                            mRenderTask;
@@ -215,6 +285,9 @@ private:
   std::string                                 mPath;
   Dali::NativeImageSourcePtr                  mNativeImageSourcePtr;  ///< pointer to surface image
   bool                                        mFileSave;
+  bool                                        mAsynchronousEncoding; ///< Whether the file is encoded on the encoder thread
+  std::unique_ptr<CaptureRecorder>            mRecorder;             ///< The current recording, if any
+  DevelCapture::RecordingStatistics           mRecordingStatistics;  ///< The counters of the last recording stopped
 };
 
 }  // End of namespace Adaptor
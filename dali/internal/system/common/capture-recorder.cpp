@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/capture-recorder.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <strings.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/render-tasks/render-task-list.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/pixel-converters.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+const uint32_t MAXIMUM_FRAMES_PER_SECOND = 1000u; ///< The timer can't tick faster
+const uint32_t MAXIMUM_BUFFER_COUNT = 16u;        ///< More targets only add latency and memory
+const char* const Y4M_SUFFIX = ".y4m";
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gRecorderLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_CAPTURE_RECORDER" );
+#endif
+
+/**
+ * @brief Whether a path ends with a suffix, ignoring the case.
+ */
+bool HasSuffix( const std::string& path, const char* suffix )
+{
+  const size_t suffixLength = strlen( suffix );
+  return path.size() >= suffixLength && strcasecmp( path.c_str() + path.size() - suffixLength, suffix ) == 0;
+}
+
+} // unnamed namespace
+
+CaptureRecorder::CaptureRecorder()
+: mOptions(),
+  mCallback(),
+  mFile( nullptr ),
+  mY4m( false ),
+  mTargets(),
+  mNextTarget( 0u ),
+  mRendering( false ),
+  mRenderingFrame(),
+  mFrameIndex( 0u ),
+  mStartTime(),
+  mRenderTask(),
+  mCameraActor(),
+  mSource(),
+  mTimer(),
+  mConditionalWait(),
+  mRenderedFrames(),
+  mStatistics(),
+  mTerminate( false ),
+  mWorker(),
+  mWidth( 0u ),
+  mHeight( 0u ),
+  mReadPixels(),
+  mRgbaPixels(),
+  mFramePixels(),
+  mPreviousPixels(),
+  mFileFrame(),
+  mFileFrameCount( 0u )
+{
+}
+
+CaptureRecorder::~CaptureRecorder()
+{
+  Stop();
+}
+
+bool CaptureRecorder::Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const Dali::Vector4& clearColor,
+                             Dali::CameraActor cameraActor, const DevelCapture::RecordingOptions& options, DevelCapture::FrameCallback callback,
+                             const std::string& path )
+{
+  DALI_ASSERT_ALWAYS( source && "Source is empty." );
+  DALI_ASSERT_ALWAYS( !mWorker.joinable() && "The recording is already started." );
+
+  Dali::Window window = DevelWindow::Get( source );
+  if( !window )
+  {
+    DALI_LOG_ERROR( "The source is not added on the window\n" );
+    return false;
+  }
+
+  const uint32_t capturedWidth = static_cast<uint32_t>( size.width );
+  const uint32_t capturedHeight = static_cast<uint32_t>( size.height );
+  if( capturedWidth == 0u || capturedHeight == 0u )
+  {
+    DALI_LOG_ERROR( "Can't record an empty area\n" );
+    return false;
+  }
+
+  if( !path.empty() )
+  {
+    mFile = fopen( path.c_str(), "wb" );
+    if( !mFile )
+    {
+      DALI_LOG_ERROR( "Could not open the recording file %s\n", path.c_str() );
+      return false;
+    }
+    mY4m = HasSuffix( path, Y4M_SUFFIX );
+  }
+
+  mOptions = options;
+  mOptions.framesPerSecond = std::min( std::max( mOptions.framesPerSecond, 1u ), MAXIMUM_FRAMES_PER_SECOND );
+  mOptions.bufferCount = std::min( std::max( mOptions.bufferCount, 1u ), MAXIMUM_BUFFER_COUNT );
+  mCallback = std::move( callback );
+
+  // The frames are only scaled down, a missing dimension keeps the aspect ratio.
+  mWidth = capturedWidth;
+  mHeight = capturedHeight;
+  if( mOptions.width > 0u || mOptions.height > 0u )
+  {
+    mWidth = mOptions.width > 0u ? mOptions.width : std::max( 1u, capturedWidth * mOptions.height / capturedHeight );
+    mHeight = mOptions.height > 0u ? mOptions.height : std::max( 1u, capturedHeight * mOptions.width / capturedWidth );
+    mWidth = std::min( mWidth, capturedWidth );
+    mHeight = std::min( mHeight, capturedHeight );
+  }
+
+  if( mY4m )
+  {
+    fprintf( mFile, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C420jpeg\n", mWidth, mHeight, mOptions.framesPerSecond );
+  }
+
+  mTargets.resize( mOptions.bufferCount );
+  for( Target& target : mTargets )
+  {
+    target.nativeImageSource = Dali::NativeImageSource::New( capturedWidth, capturedHeight, Dali::NativeImageSource::COLOR_DEPTH_DEFAULT );
+    target.texture = Dali::Texture::New( *target.nativeImageSource );
+    target.frameBuffer = Dali::FrameBuffer::New( target.texture.GetWidth(), target.texture.GetHeight(), Dali::FrameBuffer::Attachment::DEPTH );
+    target.frameBuffer.AttachColorTexture( target.texture );
+  }
+
+  mSource = source;
+  mCameraActor = cameraActor;
+  if( !mCameraActor )
+  {
+    mCameraActor = Dali::CameraActor::New( size );
+    // Because input position and size are for 2 dimentional area,
+    // default z-directional position of the camera is required to be used for the new camera position.
+    float cameraDefaultZPosition = mCameraActor.GetProperty<float>( Dali::Actor::Property::POSITION_Z );
+    Vector2 positionTransition = position + size / 2;
+    mCameraActor.SetProperty( Dali::Actor::Property::POSITION, Vector3( positionTransition.x, positionTransition.y, cameraDefaultZPosition ) );
+    mCameraActor.SetProperty( Dali::Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    mCameraActor.SetProperty( Dali::Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER );
+  }
+  window.Add( mCameraActor );
+
+  Dali::RenderTaskList taskList = window.GetRenderTaskList();
+  mRenderTask = taskList.CreateTask();
+  mRenderTask.SetSourceActor( source );
+  mRenderTask.SetCameraActor( mCameraActor );
+  mRenderTask.SetScreenToFrameBufferFunction( Dali::RenderTask::FULLSCREEN_FRAMEBUFFER_FUNCTION );
+  mRenderTask.SetClearColor( clearColor );
+  mRenderTask.SetClearEnabled( true );
+  mRenderTask.SetProperty( Dali::RenderTask::Property::REQUIRES_SYNC, true );
+  mRenderTask.FinishedSignal().Connect( this, &CaptureRecorder::OnRenderFinished );
+  mRenderTask.GetCameraActor().SetInvertYAxis( true );
+
+  mTerminate = false;
+  mWorker = std::thread( &CaptureRecorder::Run, this );
+
+  mStartTime = std::chrono::steady_clock::now();
+  RequestFrame();
+
+  mTimer = Dali::Timer::New( std::max( 1000u / mOptions.framesPerSecond, 1u ) );
+  mTimer.TickSignal().Connect( this, &CaptureRecorder::OnTick );
+  mTimer.Start();
+
+  return true;
+}
+
+void CaptureRecorder::Stop()
+{
+  if( !mWorker.joinable() )
+  {
+    return;
+  }
+
+  mTimer.Stop();
+  mTimer.Reset();
+
+  // A frame still rendering is abandoned with its render task.
+  Dali::Window window = DevelWindow::Get( mSource );
+  if( window )
+  {
+    window.GetRenderTaskList().RemoveTask( mRenderTask );
+  }
+  mRenderTask.Reset();
+  mCameraActor.Unparent();
+  mCameraActor.Reset();
+  mSource.Reset();
+  mRendering = false;
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+  mWorker.join();
+
+  mTargets.clear();
+
+  if( mFile )
+  {
+    if( fclose( mFile ) != 0 )
+    {
+      DALI_LOG_ERROR( "Could not finish writing the recording file\n" );
+    }
+    mFile = nullptr;
+  }
+
+  DALI_LOG_INFO( gRecorderLogFilter, Debug::General, "Recording stopped: %u frames captured, %u delivered, %u unchanged, %u dropped\n",
+                 mStatistics.framesCaptured, mStatistics.framesDelivered, mStatistics.framesUnchanged, mStatistics.framesDropped );
+}
+
+DevelCapture::RecordingStatistics CaptureRecorder::GetStatistics() const
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  return mStatistics;
+}
+
+bool CaptureRecorder::OnTick()
+{
+  RequestFrame();
+  return true;
+}
+
+void CaptureRecorder::RequestFrame()
+{
+  const uint32_t index = mFrameIndex++;
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( mRendering )
+  {
+    // The render thread did not keep up with the frame rate.
+    ++mStatistics.framesDropped;
+    return;
+  }
+
+  const uint32_t targetCount = static_cast<uint32_t>( mTargets.size() );
+  for( uint32_t i = 0u; i < targetCount; ++i )
+  {
+    const uint32_t target = ( mNextTarget + i ) % targetCount;
+    if( mTargets[target].free )
+    {
+      mTargets[target].free = false;
+      mNextTarget = ( target + 1u ) % targetCount;
+      mRendering = true;
+      mRenderingFrame.target = target;
+      mRenderingFrame.index = index;
+
+      mRenderTask.SetFrameBuffer( mTargets[target].frameBuffer );
+      mRenderTask.SetRefreshRate( Dali::RenderTask::REFRESH_ONCE );
+      return;
+    }
+  }
+
+  // The worker did not keep up: drop the frame rather than wait for a target.
+  ++mStatistics.framesDropped;
+}
+
+void CaptureRecorder::OnRenderFinished( Dali::RenderTask& task )
+{
+  mRendering = false;
+  mRenderingFrame.timestamp = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - mStartTime ).count() );
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mRenderedFrames.push_back( mRenderingFrame );
+  mConditionalWait.Notify( lock );
+}
+
+void CaptureRecorder::Run()
+{
+  while( true )
+  {
+    RenderedFrame frame;
+    {
+      ConditionalWait::ScopedLock lock( mConditionalWait );
+      while( !mTerminate && mRenderedFrames.empty() )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      // The frames already rendered are delivered before stopping.
+      if( mRenderedFrames.empty() )
+      {
+        break;
+      }
+
+      frame = mRenderedFrames.front();
+      mRenderedFrames.pop_front();
+    }
+
+    ProcessFrame( frame );
+  }
+}
+
+void CaptureRecorder::ProcessFrame( const RenderedFrame& frame )
+{
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  Pixel::Format pixelFormat = Pixel::INVALID;
+  Target& target = mTargets[frame.target];
+  bool read = target.nativeImageSource->GetPixels( mReadPixels, width, height, pixelFormat ) &&
+              pixelFormat != Pixel::INVALID &&
+              mReadPixels.size() >= static_cast<size_t>( width ) * height * Pixel::GetBytesPerPixel( pixelFormat );
+
+  // The target can be rendered to again while this frame is converted and delivered.
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    target.free = true;
+    if( read )
+    {
+      ++mStatistics.framesCaptured;
+    }
+  }
+
+  if( !read )
+  {
+    DALI_LOG_ERROR( "Could not read the frame %u back\n", frame.index );
+    return;
+  }
+
+  const uint8_t* pixels = mReadPixels.data();
+  if( pixelFormat != Pixel::RGBA8888 )
+  {
+    const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+    const ConvertRowFunction convertRow = GetConvertRowFunction( pixelFormat, Pixel::RGBA8888 );
+    mRgbaPixels.resize( static_cast<size_t>( width ) * height * 4u );
+    for( unsigned int row = 0u; row < height; ++row )
+    {
+      const uint8_t* in = mReadPixels.data() + static_cast<size_t>( row ) * width * bytesPerPixel;
+      uint8_t* out = mRgbaPixels.data() + static_cast<size_t>( row ) * width * 4u;
+      if( convertRow )
+      {
+        convertRow( in, out, width );
+      }
+      else
+      {
+        ConvertRow( in, pixelFormat, out, Pixel::RGBA8888, width );
+      }
+    }
+    pixels = mRgbaPixels.data();
+  }
+
+  if( width != mWidth || height != mHeight )
+  {
+    mFramePixels.resize( static_cast<size_t>( mWidth ) * mHeight * 4u );
+    Platform::LinearSample4BPP( pixels, ImageDimensions( width, height ), mFramePixels.data(), ImageDimensions( mWidth, mHeight ) );
+    pixels = mFramePixels.data();
+  }
+
+  bool changed = true;
+  if( mOptions.onlyChangedFrames )
+  {
+    const size_t frameSize = static_cast<size_t>( mWidth ) * mHeight * 4u;
+    changed = mPreviousPixels.size() != frameSize || memcmp( mPreviousPixels.data(), pixels, frameSize ) != 0;
+    if( changed )
+    {
+      mPreviousPixels.assign( pixels, pixels + frameSize );
+    }
+  }
+
+  bool delivered = false;
+  if( mCallback && changed )
+  {
+    DevelCapture::Frame deliveredFrame;
+    deliveredFrame.pixels = pixels;
+    deliveredFrame.width = mWidth;
+    deliveredFrame.height = mHeight;
+    deliveredFrame.index = frame.index;
+    deliveredFrame.timestamp = frame.timestamp;
+    mCallback( deliveredFrame );
+    delivered = true;
+  }
+
+  if( mFile )
+  {
+    delivered = WriteFrame( pixels, changed, frame.index ) || delivered;
+  }
+
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  if( !changed )
+  {
+    ++mStatistics.framesUnchanged;
+  }
+  if( delivered )
+  {
+    ++mStatistics.framesDelivered;
+  }
+}
+
+bool CaptureRecorder::WriteFrame( const uint8_t* pixels, bool changed, uint32_t index )
+{
+  const size_t lumaSize = static_cast<size_t>( mWidth ) * mHeight;
+  const size_t chromaSize = static_cast<size_t>( ( mWidth + 1u ) / 2u ) * ( ( mHeight + 1u ) / 2u );
+  const size_t frameSize = mY4m ? lumaSize + 2u * chromaSize : lumaSize * 4u;
+
+  auto writeFileFrame = [this, frameSize]()
+  {
+    return ( !mY4m || fputs( "FRAME\n", mFile ) >= 0 ) && fwrite( mFileFrame.data(), 1u, frameSize, mFile ) == frameSize;
+  };
+
+  // The file has a constant frame rate: the frames dropped, or not read back, repeat the previous one.
+  bool written = true;
+  if( !mFileFrame.empty() )
+  {
+    for( ; mFileFrameCount < index && written; ++mFileFrameCount )
+    {
+      written = writeFileFrame();
+    }
+  }
+
+  // An unchanged frame is written again without being converted.
+  if( changed || mFileFrame.empty() )
+  {
+    mFileFrame.resize( frameSize );
+    if( mY4m )
+    {
+      ConvertRgbaToI420( pixels, mWidth, mHeight, mFileFrame.data(), mFileFrame.data() + lumaSize, mFileFrame.data() + lumaSize + chromaSize );
+    }
+    else
+    {
+      memcpy( mFileFrame.data(), pixels, frameSize );
+    }
+  }
+
+  written = written && writeFileFrame();
+  mFileFrameCount = index + 1u;
+
+  if( !written )
+  {
+    DALI_LOG_ERROR( "Could not write the frame %u to the recording file, no more frames will be written\n", index );
+    fclose( mFile );
+    mFile = nullptr;
+  }
+  return written;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
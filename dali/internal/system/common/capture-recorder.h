@@ -0,0 +1,205 @@
+#ifndef DALI_INTERNAL_CAPTURE_RECORDER_H
+#define DALI_INTERNAL_CAPTURE_RECORDER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/actors/camera-actor.h>
+#include <dali/public-api/render-tasks/render-task.h>
+#include <dali/public-api/rendering/frame-buffer.h>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/signals/connection-tracker.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
+#include <dali/public-api/adaptor-framework/native-image-source.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Captures the frames of an actor tree continuously, for Capture's recording mode.
+ *
+ * A single render task, refreshed once per tick of a timer, renders in turn into a ring of offscreen targets.
+ * Once rendered, a target is read back by a worker thread, which then frees it and converts, scales and
+ * delivers the frame while the next targets are rendered. When the previous frame is still rendering, or
+ * all the targets are still waiting to be read, the frame is dropped and counted instead of being waited for.
+ */
+class CaptureRecorder : public ConnectionTracker
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  CaptureRecorder();
+
+  /**
+   * @brief Destructor. Stops the recording if started.
+   */
+  ~CaptureRecorder();
+
+  /**
+   * @brief Starts the recording.
+   *
+   * @param[in] source The root of the actor tree to capture
+   * @param[in] position The top-left position of the area to capture, in the window
+   * @param[in] size The size of the area to capture
+   * @param[in] clearColor The background color
+   * @param[in] cameraActor The camera to capture with, or an empty handle to create one looking at the area
+   * @param[in] options The settings of the recording
+   * @param[in] callback Called on the worker thread with each frame, if not empty
+   * @param[in] path The file to write the frames to, if not empty
+   * @return true if the recording started.
+   */
+  bool Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const Dali::Vector4& clearColor,
+              Dali::CameraActor cameraActor, const DevelCapture::RecordingOptions& options, DevelCapture::FrameCallback callback,
+              const std::string& path );
+
+  /**
+   * @brief Stops the recording once the frames already rendered are delivered, and releases the resources.
+   */
+  void Stop();
+
+  /**
+   * @copydoc Dali::DevelCapture::GetRecordingStatistics
+   */
+  DevelCapture::RecordingStatistics GetStatistics() const;
+
+private:
+
+  // Undefined
+  CaptureRecorder( const CaptureRecorder& ) = delete;
+  CaptureRecorder& operator=( const CaptureRecorder& ) = delete;
+
+  /**
+   * @brief An offscreen target of the ring.
+   */
+  struct Target
+  {
+    Dali::NativeImageSourcePtr nativeImageSource; ///< The surface rendered to, which the worker reads
+    Dali::Texture              texture;           ///< The texture of the surface
+    Dali::FrameBuffer          frameBuffer;       ///< The frame buffer of the texture
+    bool                       free{true};        ///< Whether it can be rendered to; false from the request to the read back
+  };
+
+  /**
+   * @brief A rendered frame waiting for the worker thread.
+   */
+  struct RenderedFrame
+  {
+    uint32_t target{0u};    ///< The index of the target holding the frame
+    uint32_t index{0u};     ///< The number of the frame
+    uint64_t timestamp{0u}; ///< The time of the frame, in microseconds since the start
+  };
+
+  /**
+   * @brief Callback of the timer, requesting the next frame.
+   *
+   * @return true to keep the timer running.
+   */
+  bool OnTick();
+
+  /**
+   * @brief Renders the next frame into a free target, or counts it as dropped.
+   */
+  void RequestFrame();
+
+  /**
+   * @brief Callback when a frame is rendered, handing it over to the worker thread.
+   *
+   * @param[in] task The render task of the recording
+   */
+  void OnRenderFinished( Dali::RenderTask& task );
+
+  /**
+   * @brief The loop of the worker thread.
+   */
+  void Run();
+
+  /**
+   * @brief Reads a rendered frame back, frees its target and delivers it. Called on the worker thread.
+   *
+   * @param[in] frame The frame
+   */
+  void ProcessFrame( const RenderedFrame& frame );
+
+  /**
+   * @brief Writes a frame to the file, after repeating the previous one for the frames missing before it.
+   * Called on the worker thread.
+   *
+   * @param[in] pixels The RGBA8888 pixels of the frame
+   * @param[in] changed Whether the frame differs from the previous one
+   * @param[in] index The number of the frame
+   * @return true if the frame was written.
+   */
+  bool WriteFrame( const uint8_t* pixels, bool changed, uint32_t index );
+
+  DevelCapture::RecordingOptions        mOptions;         ///< The settings of the recording
+  DevelCapture::FrameCallback           mCallback;        ///< Called with each frame, if not empty
+  FILE*                                 mFile;            ///< The file the frames are written to, if any
+  bool                                  mY4m;             ///< Whether the file is YUV4MPEG2 rather than raw RGBA8888
+  std::vector<Target>                   mTargets;         ///< The ring of offscreen targets, whose free flags are guarded by mConditionalWait
+  uint32_t                              mNextTarget;      ///< The target to try first for the next frame
+  bool                                  mRendering;       ///< Whether a frame is being rendered
+  RenderedFrame                         mRenderingFrame;  ///< The frame being rendered
+  uint32_t                              mFrameIndex;      ///< The number of the next frame, counting the dropped ones
+  std::chrono::steady_clock::time_point mStartTime;       ///< The start of the recording
+  Dali::RenderTask                      mRenderTask;      ///< Renders the frames
+  Dali::CameraActor                     mCameraActor;     ///< The camera of the render task
+  Dali::Actor                           mSource;          ///< The root of the actor tree captured
+  Dali::Timer                           mTimer;           ///< Ticks at the frame rate
+
+  mutable ConditionalWait               mConditionalWait; ///< Guards the members below, which the worker waits on
+  std::deque<RenderedFrame>             mRenderedFrames;  ///< The frames waiting for the worker thread
+  DevelCapture::RecordingStatistics     mStatistics;      ///< The counters of the recording
+  bool                                  mTerminate;       ///< Whether the worker thread should stop once the frames are delivered
+  std::thread                           mWorker;          ///< The worker thread
+
+  // Only used by the worker thread.
+  uint32_t                              mWidth;           ///< The width of the frames delivered
+  uint32_t                              mHeight;          ///< The height of the frames delivered
+  std::vector<uint8_t>                  mReadPixels;      ///< The pixels read back from a target
+  std::vector<uint8_t>                  mRgbaPixels;      ///< The pixels converted to RGBA8888
+  std::vector<uint8_t>                  mFramePixels;     ///< The frame delivered, scaled if required
+  std::vector<uint8_t>                  mPreviousPixels;  ///< The previous frame delivered, to find the unchanged ones
+  std::vector<uint8_t>                  mFileFrame;       ///< The last frame written to the file, in the file's format
+  uint32_t                              mFileFrameCount;  ///< The number of frames written to the file
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_CAPTURE_RECORDER_H
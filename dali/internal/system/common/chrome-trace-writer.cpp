@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/chrome-trace-writer.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <sys/prctl.h>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const size_t                    BUFFER_CAPACITY = 64u * 1024u;  ///< The events buffered before being written out, in bytes
+const std::chrono::seconds      FLUSH_PERIOD( 1 );              ///< The longest time the events are buffered for
+const char* const               START_POSTFIX = "_START";
+const char* const               END_POSTFIX = "_END";
+
+/**
+ * @brief Appends a string to a JSON string, escaping it.
+ */
+void AppendEscaped( std::string& json, const char* text, size_t length )
+{
+  for( size_t i = 0u; i < length; ++i )
+  {
+    const char character = text[i];
+    if( character == '"' || character == '\\' )
+    {
+      json += '\\';
+      json += character;
+    }
+    else if( static_cast<unsigned char>( character ) < 0x20u )
+    {
+      char escaped[8];
+      snprintf( escaped, sizeof( escaped ), "\\u%04x", static_cast<unsigned int>( character ) );
+      json += escaped;
+    }
+    else
+    {
+      json += character;
+    }
+  }
+}
+
+/**
+ * @brief Retrieves the length of a name without a postfix, if it ends with it.
+ */
+size_t GetLengthWithoutPostfix( const char* name, const char* postfix )
+{
+  const size_t length = strlen( name );
+  const size_t postfixLength = strlen( postfix );
+  if( length > postfixLength && strcmp( name + length - postfixLength, postfix ) == 0 )
+  {
+    return length - postfixLength;
+  }
+  return length;
+}
+
+} // unnamed namespace
+
+ChromeTraceWriter::ChromeTraceWriter()
+: mFile( nullptr ),
+  mBuffer(),
+  mLastFlushTime(),
+  mProcessId( 0 ),
+  mFirstEvent( true )
+{
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+  Close();
+}
+
+bool ChromeTraceWriter::Open( const std::string& path )
+{
+  Close();
+
+  mFile = fopen( path.c_str(), "w" );
+  if( !mFile )
+  {
+    DALI_LOG_ERROR( "Unable to create the trace file %s\n", path.c_str() );
+    return false;
+  }
+
+  mBuffer.reserve( BUFFER_CAPACITY );
+  mBuffer = "[\n";
+  mLastFlushTime = std::chrono::steady_clock::now();
+  mProcessId = static_cast<int32_t>( getpid() );
+  mFirstEvent = true;
+
+  // the main thread is named after the process
+  char processName[17] = { 0 };
+  if( prctl( PR_GET_NAME, processName ) == 0 )
+  {
+    BeginEvent( "process_name", strlen( "process_name" ), "M", 0 );
+    mBuffer += ",\"args\":{\"name\":\"";
+    AppendEscaped( mBuffer, processName, strlen( processName ) );
+    mBuffer += "\"}";
+    EndEvent();
+  }
+
+  return true;
+}
+
+void ChromeTraceWriter::Close()
+{
+  if( mFile )
+  {
+    mBuffer += "\n]\n";
+    Flush( true );
+    fclose( mFile );
+    mFile = nullptr;
+  }
+}
+
+void ChromeTraceWriter::AddThreadName( int32_t threadId, const char* name )
+{
+  if( mFile )
+  {
+    BeginEvent( "thread_name", strlen( "thread_name" ), "M", threadId );
+    mBuffer += ",\"args\":{\"name\":\"";
+    AppendEscaped( mBuffer, name, strlen( name ) );
+    mBuffer += "\"}";
+    EndEvent();
+  }
+}
+
+void ChromeTraceWriter::AddMarker( const PerformanceMarker& marker, const char* description, int32_t threadId )
+{
+  if( !mFile )
+  {
+    return;
+  }
+
+  // the timed event names are postfixed with _START and _END, see MARKER_LOOKUP
+  switch( marker.GetEventType() )
+  {
+    case PerformanceMarker::START_TIMED_EVENT:
+    {
+      BeginEvent( description, GetLengthWithoutPostfix( description, START_POSTFIX ), "B", threadId );
+      break;
+    }
+    case PerformanceMarker::END_TIMED_EVENT:
+    {
+      BeginEvent( description, GetLengthWithoutPostfix( description, END_POSTFIX ), "E", threadId );
+      break;
+    }
+    case PerformanceMarker::SINGLE_EVENT:
+    {
+      BeginEvent( description, strlen( description ), "i", threadId );
+      // the v-syncs mark the frame boundaries across all the threads
+      mBuffer += ( marker.GetType() == PerformanceInterface::VSYNC ) ? ",\"s\":\"g\"" : ",\"s\":\"t\"";
+      break;
+    }
+  }
+
+  char timeStamp[32];
+  snprintf( timeStamp, sizeof( timeStamp ), ",\"ts\":%llu", static_cast<unsigned long long>( marker.GetTimeStamp().microseconds ) );
+  mBuffer += timeStamp;
+  EndEvent();
+}
+
+void ChromeTraceWriter::Flush( bool force )
+{
+  if( !mFile || mBuffer.empty() )
+  {
+    return;
+  }
+
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if( force || now - mLastFlushTime >= FLUSH_PERIOD )
+  {
+    if( fwrite( mBuffer.data(), 1u, mBuffer.size(), mFile ) != mBuffer.size() || fflush( mFile ) != 0 )
+    {
+      DALI_LOG_ERROR( "Unable to write the trace file, the trace is stopped\n" );
+      fclose( mFile );
+      mFile = nullptr;
+    }
+    mBuffer.clear();
+    mLastFlushTime = now;
+  }
+}
+
+void ChromeTraceWriter::BeginEvent( const char* name, size_t length, const char* phase, int32_t threadId )
+{
+  mBuffer += mFirstEvent ? "" : ",\n";
+  mFirstEvent = false;
+
+  mBuffer += "{\"name\":\"";
+  AppendEscaped( mBuffer, name, length );
+
+  char fields[96];
+  snprintf( fields, sizeof( fields ), "\",\"cat\":\"dali\",\"ph\":\"%s\",\"pid\":%d,\"tid\":%d", phase, mProcessId, threadId );
+  mBuffer += fields;
+}
+
+void ChromeTraceWriter::EndEvent()
+{
+  mBuffer += '}';
+  if( mBuffer.size() >= BUFFER_CAPACITY )
+  {
+    Flush( true );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,136 @@
+#ifndef DALI_INTERNAL_ADAPTOR_CHROME_TRACE_WRITER_H
+#define DALI_INTERNAL_ADAPTOR_CHROME_TRACE_WRITER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-marker.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Writes performance markers to a file in the Chrome trace event JSON format,
+ * which chrome://tracing and the Perfetto UI load.
+ *
+ * Timed events become begin / end slices named after their description without the _START / _END postfix,
+ * V_SYNC becomes a global instant event marking the frame boundaries, and the other single events
+ * become instant events of their thread.
+ *
+ * The events are gathered in a bounded buffer, written out when full or once a second, so the file
+ * is only written to by the thread adding the events. The closing bracket is optional in this
+ * format, so a trace cut short by a crash can still be loaded.
+ */
+class ChromeTraceWriter
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  ChromeTraceWriter();
+
+  /**
+   * @brief Destructor. Closes the file if open.
+   */
+  ~ChromeTraceWriter();
+
+  /**
+   * @brief Creates the trace file, and names the process in it after the calling thread.
+   *
+   * @param[in] path The path of the file
+   * @return true if the file was created.
+   */
+  bool Open( const std::string& path );
+
+  /**
+   * @brief Writes the buffered events and the end of the trace, and closes the file.
+   */
+  void Close();
+
+  /**
+   * @brief Names a thread in the trace.
+   *
+   * @param[in] threadId The system id of the thread
+   * @param[in] name The name of the thread
+   */
+  void AddThreadName( int32_t threadId, const char* name );
+
+  /**
+   * @brief Adds a marker to the trace.
+   *
+   * @param[in] marker The marker
+   * @param[in] description The description of the marker, e.g. UPDATE_START
+   * @param[in] threadId The system id of the thread which added the marker
+   */
+  void AddMarker( const PerformanceMarker& marker, const char* description, int32_t threadId );
+
+  /**
+   * @brief Writes the buffered events to the file.
+   *
+   * @param[in] force Whether to write them now, rather than only once a second has passed since the last write
+   */
+  void Flush( bool force );
+
+private:
+
+  // Undefined
+  ChromeTraceWriter( const ChromeTraceWriter& ) = delete;
+  ChromeTraceWriter& operator=( const ChromeTraceWriter& ) = delete;
+
+  /**
+   * @brief Starts a new event in the buffer, with its name and its common fields.
+   *
+   * @param[in] name The name of the event
+   * @param[in] length The length of the name
+   * @param[in] phase The phase of the event, e.g. "B"
+   * @param[in] threadId The system id of the thread of the event
+   */
+  void BeginEvent( const char* name, size_t length, const char* phase, int32_t threadId );
+
+  /**
+   * @brief Ends the event started with BeginEvent(), writing the buffer out if it is full.
+   */
+  void EndEvent();
+
+  FILE*                                 mFile;          ///< The trace file, or nullptr when closed
+  std::string                           mBuffer;        ///< The events not written yet
+  std::chrono::steady_clock::time_point mLastFlushTime; ///< The last time the buffer was written out
+  int32_t                               mProcessId;     ///< The id of the process, given to all the events
+  bool                                  mFirstEvent;    ///< Whether no event has been added, so none needs a separator
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_CHROME_TRACE_WRITER_H
@@ -200,6 +200,7 @@ EnvironmentOptions::EnvironmentOptions()
 : mLogFunction( NULL ),
   mWindowName(),
   mWindowClassName(),
+  mPerformanceTraceFile(),
   mNetworkControl( 0 ),
   mFpsFrequency( 0 ),
   mUpdateStatusFrequency( 0 ),
@@ -311,6 +312,11 @@ unsigned int EnvironmentOptions::GetPerformanceTimeStampOutput() const
   return mPerformanceTimeStampOutput;
 }
 
+const std::string& EnvironmentOptions::GetPerformanceTraceFile() const
+{
+  return mPerformanceTraceFile;
+}
+
 unsigned int EnvironmentOptions::GetPanGestureLoggingLevel() const
 {
   return mPanGestureLoggingLevel;
@@ -490,7 +496,8 @@ bool EnvironmentOptions::PerformanceServerRequired() const
 {
   return ( ( GetPerformanceStatsLoggingOptions() > 0) ||
            ( GetPerformanceTimeStampOutput() > 0 ) ||
-           ( GetNetworkControlMode() > 0) );
+           ( GetNetworkControlMode() > 0) ||
+           ( !GetPerformanceTraceFile().empty() ) );
 }
 
 bool EnvironmentOptions::DepthBufferRequired() const
@@ -519,6 +526,7 @@ void EnvironmentOptions::ParseEnvironmentOptions()
   mPerformanceTimeStampOutput = GetEnvironmentVariable( DALI_ENV_PERFORMANCE_TIMESTAMP_OUTPUT, 0 );
   mNetworkControl = GetEnvironmentVariable( DALI_ENV_NETWORK_CONTROL, 0 );
   mPanGestureLoggingLevel = GetEnvironmentVariable( DALI_ENV_LOG_PAN_GESTURE, 0 );
+  SetFromEnvironmentVariable( DALI_ENV_PERFORMANCE_TRACE_FILE, mPerformanceTraceFile );
 
   SetFromEnvironmentVariable(DALI_ENV_PAN_PREDICTION_MODE, mPanGesturePredictionMode);
   SetFromEnvironmentVariable<int>(DALI_ENV_PAN_PREDICTION_AMOUNT, MinimumZero(mPanGesturePredictionAmount));
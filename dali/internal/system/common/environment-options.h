@@ -115,6 +115,11 @@ public:
    */
   unsigned int GetPerformanceTimeStampOutput() const;
 
+  /**
+   * @return the path of the performance trace file ( empty == off )
+   */
+  const std::string& GetPerformanceTraceFile() const;
+
   /**
    * @return pan-gesture logging level ( 0 == off )
    */
@@ -346,6 +351,7 @@ private: // Data
   Dali::Integration::Log::LogFunction mLogFunction;
   std::string mWindowName;                        ///< name of the window
   std::string mWindowClassName;                   ///< name of the class the window belongs to
+  std::string mPerformanceTraceFile;              ///< path of the performance trace file
   unsigned int mNetworkControl;                   ///< whether network control is enabled
   unsigned int mFpsFrequency;                     ///< how often fps is logged out in seconds
   unsigned int mUpdateStatusFrequency;            ///< how often update status is logged out in frames
@@ -45,6 +45,12 @@ namespace Adaptor
  */
 #define DALI_ENV_PERFORMANCE_TIMESTAMP_OUTPUT "DALI_PERFORMANCE_TIMESTAMP_OUTPUT"
 
+/**
+ * The path of a Chrome trace-event JSON file the update/render/event, custom
+ * and DALI_TRACE markers are recorded to, for chrome://tracing or Perfetto
+ */
+#define DALI_ENV_PERFORMANCE_TRACE_FILE "DALI_PERFORMANCE_TRACE_FILE"
+
 /**
  * Allow control and monitoring of DALi via the network
  */
@@ -140,6 +146,43 @@ namespace Adaptor
 
 #define DALI_ENV_ADDONS_LIBS "DALI_ADDONS_LIBS"
 
+/**
+ * The maximum number of threads used to process large images (e.g. blurring).
+ * Set to 1 to process images on the calling thread only.
+ */
+#define DALI_ENV_IMAGE_PROCESSING_THREADS "DALI_IMAGE_PROCESSING_THREADS"
+
+/**
+ * The default number of worker threads of a BatchImageLoader.
+ */
+#define DALI_ENV_IMAGE_LOADING_THREADS "DALI_IMAGE_LOADING_THREADS"
+
+/**
+ * The memory budget, in KB, of the cache of shaped runs of text. Set to 0 to disable the cache.
+ */
+#define DALI_ENV_SHAPING_CACHE_SIZE "DALI_SHAPING_CACHE_SIZE"
+
+/**
+ * The path of the catalog of the platform's fonts kept between runs, or of the directory it is kept in if the path ends with a slash.
+ * The catalog is not used if it is not set.
+ */
+#define DALI_ENV_FONT_CATALOG_PATH "DALI_FONT_CATALOG_PATH"
+
+/**
+ * The memory budget, in KB, of the cache of rasterized glyph bitmaps. Set to 0 to disable the cache.
+ */
+#define DALI_ENV_GLYPH_BITMAP_CACHE_SIZE "DALI_GLYPH_BITMAP_CACHE_SIZE"
+
+/**
+ * The maximum size, in KB, of the shader program binaries kept between runs.
+ */
+#define DALI_ENV_SHADER_BINARY_CACHE_SIZE "DALI_SHADER_BINARY_CACHE_SIZE"
+
+/**
+ * The maximum size, in KB, of the released pixel buffers kept for reuse. Set to 0 to disable the reuse.
+ */
+#define DALI_ENV_PIXEL_BUFFER_POOL_SIZE "DALI_PIXEL_BUFFER_POOL_SIZE"
+
 } // namespace Adaptor
 
 } // namespace Internal
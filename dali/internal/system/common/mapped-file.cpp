@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/mapped-file.h>
+
+// EXTERNAL INCLUDES
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+MappedFile::MappedFile()
+: mAddress( nullptr ),
+  mSize( 0u )
+{
+}
+
+MappedFile::MappedFile( FILE* file, size_t minimumSize )
+: mAddress( nullptr ),
+  mSize( 0u )
+{
+  if( file == nullptr )
+  {
+    return;
+  }
+
+  // Streams opened on a memory buffer have no file descriptor.
+  const int fileDescriptor = fileno( file );
+  if( fileDescriptor < 0 )
+  {
+    return;
+  }
+
+  struct stat fileStatus;
+  if( fstat( fileDescriptor, &fileStatus ) != 0 || !S_ISREG( fileStatus.st_mode ) || fileStatus.st_size <= 0 ||
+      static_cast<size_t>( fileStatus.st_size ) < minimumSize )
+  {
+    return;
+  }
+
+  const size_t size = static_cast<size_t>( fileStatus.st_size );
+  void* address = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+
+// MAP_FAILED is a macro with C cast
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  if( address == MAP_FAILED )
+  {
+    return;
+  }
+#pragma GCC diagnostic pop
+
+  // The decoders read the file once from the start to the end.
+  madvise( address, size, MADV_SEQUENTIAL );
+
+  mAddress = address;
+  mSize = size;
+}
+
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+MappedFile::MappedFile( MappedFile&& rhs )
+: mAddress( rhs.mAddress ),
+  mSize( rhs.mSize )
+{
+  rhs.mAddress = nullptr;
+  rhs.mSize = 0u;
+}
+
+MappedFile& MappedFile::operator=( MappedFile&& rhs )
+{
+  if( this != &rhs )
+  {
+    Unmap();
+    mAddress = rhs.mAddress;
+    mSize = rhs.mSize;
+    rhs.mAddress = nullptr;
+    rhs.mSize = 0u;
+  }
+  return *this;
+}
+
+void MappedFile::Unmap()
+{
+  if( mAddress != nullptr )
+  {
+    munmap( mAddress, mSize );
+    mAddress = nullptr;
+    mSize = 0u;
+  }
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
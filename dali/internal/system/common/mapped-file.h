@@ -0,0 +1,118 @@
+#ifndef DALI_INTERNAL_PORTABLE_MAPPED_FILE_H
+#define DALI_INTERNAL_PORTABLE_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief A read-only memory mapping of the whole file behind a stream.
+ *
+ * Decoders can read the encoded image straight from the page cache instead of copying
+ * it into a buffer first. Only regular files can be mapped; for any other stream
+ * (e.g. a memory buffer or a pipe) or if mapping fails, the mapping is left empty and
+ * the stream should be read as before.
+ */
+class MappedFile
+{
+public:
+  /**
+   * @brief The size below which the image loaders read a file rather than mapping it.
+   *
+   * Mapping a small file costs more than copying it: the mmap and munmap calls, a page fault per page
+   * and the TLB flush when it is unmapped.
+   */
+  static constexpr size_t MINIMUM_IMAGE_SIZE = 64u * 1024u;
+
+  /**
+   * @brief Creates an empty mapping.
+   */
+  MappedFile();
+
+  /**
+   * @brief Maps the file behind the given stream, hinting that it will be read sequentially.
+   *
+   * The position of the stream is not changed.
+   * @param[in] file The stream. May be NULL.
+   * @param[in] minimumSize The size in bytes below which the file is left unmapped.
+   */
+  explicit MappedFile( FILE* file, size_t minimumSize = 0u );
+
+  /**
+   * @brief Unmaps the file.
+   */
+  ~MappedFile();
+
+  // Moveable but not copyable
+
+  MappedFile( const MappedFile& ) = delete;
+  MappedFile& operator=( const MappedFile& ) = delete;
+  MappedFile( MappedFile&& rhs );
+  MappedFile& operator=( MappedFile&& rhs );
+
+  /**
+   * @brief Whether the file has been mapped.
+   */
+  bool IsMapped() const
+  {
+    return mAddress != nullptr;
+  }
+
+  /**
+   * @brief Retrieves the contents of the file.
+   * @return The start of the mapping, or NULL if the file is not mapped.
+   */
+  const uint8_t* GetData() const
+  {
+    return static_cast<const uint8_t*>( mAddress );
+  }
+
+  /**
+   * @brief Retrieves the size of the file.
+   * @return The size in bytes, or zero if the file is not mapped.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+  /**
+   * @brief Unmaps the file, if mapped.
+   */
+  void Unmap();
+
+private:
+  void*  mAddress; ///< The start of the mapping
+  size_t mSize;    ///< The size of the mapping in bytes
+};
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
+
+#endif // DALI_INTERNAL_PORTABLE_MAPPED_FILE_H
@@ -165,6 +165,27 @@ public:
    */
   virtual void EnableLogging( bool enable, ContextId contextId ) = 0;
 
+  /**
+   * @brief Whether the markers are recorded to a trace file
+   *
+   * @return true if the trace file set by DALI_PERFORMANCE_TRACE_FILE is being written
+   */
+  virtual bool IsTraceFileEnabled() const = 0;
+
+  /**
+   * @brief Retrieves how often the performance statistics are logged
+   * This function can be called from ANY THREAD.
+   * @return The frequency in seconds, or zero if the statistics are not logged
+   */
+  virtual unsigned int GetStatisticsLogFrequency() const = 0;
+
+  /**
+   * @brief Logs statistics gathered outside the performance interface, e.g. by a cache, with the performance statistics
+   * This function can be called from ANY THREAD.
+   * @param[in] text The statistics
+   */
+  virtual void LogStatistics( const char* text ) = 0;
+
 private:
 
   // Undefined copy constructor.
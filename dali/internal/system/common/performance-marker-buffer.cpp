@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/performance-marker-buffer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+PerformanceMarkerBuffer::PerformanceMarkerBuffer( uint32_t capacity, int32_t threadId )
+: mRecords(),
+  mMask( 0u ),
+  mHead( 0u ),
+  mTail( 0u ),
+  mDroppedCount( 0u ),
+  mThreadId( threadId )
+{
+  uint32_t size = 1u;
+  while( size < capacity )
+  {
+    size <<= 1u;
+  }
+  mRecords.resize( size );
+  mMask = size - 1u;
+}
+
+uint32_t PerformanceMarkerBuffer::Pop( std::vector<Record>& records )
+{
+  const uint32_t tail = mTail.load( std::memory_order_relaxed );
+  const uint32_t head = mHead.load( std::memory_order_acquire );
+  for( uint32_t index = tail; index != head; ++index )
+  {
+    records.push_back( mRecords[index & mMask] );
+    records.back().threadId = mThreadId;
+  }
+
+  // The slots are given back to the writer once copied.
+  mTail.store( head, std::memory_order_release );
+  return head - tail;
+}
+
+uint32_t PerformanceMarkerBuffer::TakeDroppedCount()
+{
+  return mDroppedCount.exchange( 0u, std::memory_order_relaxed );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
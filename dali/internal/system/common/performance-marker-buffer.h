@@ -0,0 +1,120 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
+#define DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief A lock-free ring buffer of performance markers, written by a single thread and read by a single thread.
+ *
+ * The writer never waits: when the buffer is full, the marker is dropped and counted.
+ */
+class PerformanceMarkerBuffer
+{
+public:
+
+  /**
+   * @brief A marker as recorded by the thread adding it.
+   */
+  struct Record
+  {
+    uint64_t                         microseconds{0u};                     ///< The time of the marker, from the monotonic clock
+    PerformanceInterface::MarkerType type{PerformanceInterface::VSYNC};    ///< The type of the marker
+    PerformanceInterface::ContextId  contextId{0u};                        ///< The context of a custom marker
+    bool                             custom{false};                        ///< Whether the marker was added to a custom context
+    int32_t                          threadId{0};                          ///< The system id of the thread which added the marker, set when read
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] capacity The number of records, rounded up to a power of two
+   * @param[in] threadId The system id of the writing thread, given to the records read
+   */
+  PerformanceMarkerBuffer( uint32_t capacity, int32_t threadId );
+
+  /**
+   * @brief Adds a record. Only called by the writing thread.
+   *
+   * @param[in] record The record
+   * @return false if the buffer was full and the record dropped.
+   */
+  bool Push( const Record& record )
+  {
+    const uint32_t head = mHead.load( std::memory_order_relaxed );
+    if( head - mTail.load( std::memory_order_acquire ) > mMask )
+    {
+      mDroppedCount.fetch_add( 1u, std::memory_order_relaxed );
+      return false;
+    }
+
+    mRecords[head & mMask] = record;
+    mHead.store( head + 1u, std::memory_order_release );
+    return true;
+  }
+
+  /**
+   * @brief Moves the records added so far to the end of a vector. Only called by the reading thread.
+   *
+   * @param[in,out] records The vector the records are appended to
+   * @return The number of records appended.
+   */
+  uint32_t Pop( std::vector<Record>& records );
+
+  /**
+   * @brief Retrieves the number of records dropped because the buffer was full, and resets it.
+   */
+  uint32_t TakeDroppedCount();
+
+private:
+
+  // Undefined
+  PerformanceMarkerBuffer( const PerformanceMarkerBuffer& ) = delete;
+  PerformanceMarkerBuffer& operator=( const PerformanceMarkerBuffer& ) = delete;
+
+  std::vector<Record>                mRecords;      ///< The records, of a power of two size
+  uint32_t                           mMask;         ///< The size of mRecords minus one
+  alignas( 64 ) std::atomic<uint32_t> mHead;        ///< The number of records written, only modified by the writer
+  alignas( 64 ) std::atomic<uint32_t> mTail;        ///< The number of records read, only modified by the reader
+  std::atomic<uint32_t>              mDroppedCount; ///< The number of records dropped since the last TakeDroppedCount()
+  const int32_t                      mThreadId;     ///< The system id of the writing thread
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
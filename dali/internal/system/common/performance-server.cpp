@@ -19,6 +19,13 @@
 #include <dali/internal/system/common/performance-server.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/platform-abstraction.h>
 
 // INTERNAL INCLUDES
@@ -38,6 +45,22 @@ namespace
 {
 const unsigned int NANOSECONDS_PER_MICROSECOND = 1000u;
 const float        MICROSECONDS_TO_SECOND = 1e-6;
+const uint32_t     MARKER_BUFFER_CAPACITY = 1024u;                       ///< markers per thread, far more than added between two drains
+const std::chrono::milliseconds CONSUMER_PERIOD( 10 );                  ///< the time between two drains of the marker buffers
+
+std::atomic<unsigned int> gNextServerId( 1u );                         ///< 0 is never used, so a thread's cache starts empty
+
+/**
+ * The marker buffer of the calling thread for the server which created it, cached so
+ * the threads only look their buffer up once.
+ */
+struct ThreadMarkerBuffer
+{
+  unsigned int serverId;
+  PerformanceMarkerBuffer* buffer;
+};
+thread_local ThreadMarkerBuffer tMarkerBuffer = { 0u, nullptr };
+
 } // unnamed namespace
 
 PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
@@ -53,9 +76,29 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   mStatContextManager( *this ),
   mStatisticsLogBitmask( 0 ),
   mPerformanceOutputBitmask( 0 ),
+  mId( gNextServerId++ ),
+  mMarkerBuffersMutex(),
+  mMarkerBuffers(),
+  mRemovedContexts(),
+  mRecords(),
+  mConsumer(),
+  mConsumerMutex(),
+  mConsumerCondition(),
+  mTerminateConsumer( false ),
+  mTraceWriter(),
   mLoggingEnabled( false ),
   mLogFunctionInstalled( false )
 {
+  const std::string& traceFile = mEnvironmentOptions.GetPerformanceTraceFile();
+  if( !traceFile.empty() )
+  {
+    mTraceWriter.reset( new ChromeTraceWriter() );
+    if( !mTraceWriter->Open( traceFile ) )
+    {
+      mTraceWriter.reset();
+    }
+  }
+
   SetLogging( mEnvironmentOptions.GetPerformanceStatsLoggingOptions(),
               mEnvironmentOptions.GetPerformanceTimeStampOutput(),
               mEnvironmentOptions.GetPerformanceStatsLoggingFrequency());
@@ -71,6 +114,20 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
 
 PerformanceServer::~PerformanceServer()
 {
+  // the markers already added are processed before the network server stops
+  if( mConsumer.joinable() )
+  {
+    {
+      std::lock_guard< std::mutex > lock( mConsumerMutex );
+      mTerminateConsumer = true;
+    }
+    mConsumerCondition.notify_one();
+    mConsumer.join();
+  }
+
+  // writes the end of the trace
+  mTraceWriter.reset();
+
 #if defined(NETWORK_LOGGING_ENABLED)
   if( mNetworkControlEnabled )
   {
@@ -93,7 +150,7 @@ void PerformanceServer::SetLogging( unsigned int statisticsLogOptions,
 
   mStatContextManager.SetLoggingLevel( mStatisticsLogBitmask, logFrequency);
 
-  if( ( mStatisticsLogBitmask == 0) && ( mPerformanceOutputBitmask == 0 ))
+  if( ( mStatisticsLogBitmask == 0) && ( mPerformanceOutputBitmask == 0 ) && !mTraceWriter )
   {
     mLoggingEnabled = false;
   }
@@ -113,6 +170,21 @@ void PerformanceServer::EnableLogging( bool enable, ContextId contextId )
   mStatContextManager.EnableLogging( enable, contextId );
 }
 
+bool PerformanceServer::IsTraceFileEnabled() const
+{
+  return mTraceWriter != nullptr;
+}
+
+unsigned int PerformanceServer::GetStatisticsLogFrequency() const
+{
+  return ( mStatisticsLogBitmask != 0 ) ? mStatContextManager.GetLogFrequency() : 0u;
+}
+
+void PerformanceServer::LogStatistics( const char* text )
+{
+  LogContextStatistics( text );
+}
+
 PerformanceInterface::ContextId PerformanceServer::AddContext( const char* name )
 {
   // for adding custom contexts
@@ -121,6 +193,16 @@ PerformanceInterface::ContextId PerformanceServer::AddContext( const char* name
 
 void PerformanceServer::RemoveContext( ContextId contextId )
 {
+  {
+    Mutex::ScopedLock lock( mMarkerBuffersMutex );
+    if( mConsumer.joinable() )
+    {
+      // the consumer may still have markers of the context to process, which use its description
+      mRemovedContexts.push_back( contextId );
+      return;
+    }
+  }
+
   mStatContextManager.RemoveContext( contextId );
 }
 
@@ -133,22 +215,7 @@ void PerformanceServer::AddMarker( MarkerType markerType, ContextId contextId )
     return;
   }
 
-  // Get the time stamp
-  uint64_t timeStamp = 0;
-  TimeService::GetNanoseconds( timeStamp );
-  timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
-
-  // Create a marker
-  PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
-
-  // get the marker description for this context, e.g SIZE_NEGOTIATION_START
-  const char* const description = mStatContextManager.GetMarkerDescription( markerType, contextId );
-
-  // log it
-  LogMarker( marker, description );
-
-  // Add custom marker to statistics context manager
-  mStatContextManager.AddCustomMarker( marker, contextId );
+  RecordMarker( markerType, contextId, true );
 }
 
 void PerformanceServer::AddMarker( MarkerType markerType )
@@ -171,37 +238,168 @@ void PerformanceServer::AddMarker( MarkerType markerType )
     }
   }
 
-  // Get the time
+  RecordMarker( markerType, 0, false );
+}
+
+void PerformanceServer::RecordMarker( MarkerType markerType, ContextId contextId, bool custom )
+{
+  // Get the time stamp
   uint64_t timeStamp = 0;
   TimeService::GetNanoseconds( timeStamp );
   timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
 
-  // Create a marker
-  PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
+  // the traces are timed by the kernel when written, so they can't be deferred
+  if( mPerformanceOutputBitmask & ( OUTPUT_KERNEL_TRACE | OUTPUT_SYSTEM_TRACE ) )
+  {
+    PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
+    TraceMarker( marker, custom ? mStatContextManager.GetMarkerDescription( markerType, contextId ) : marker.GetName() );
+  }
 
-  // log it
-  LogMarker(marker, marker.GetName() );
+  PerformanceMarkerBuffer::Record record;
+  record.microseconds = timeStamp;
+  record.type = markerType;
+  record.contextId = contextId;
+  record.custom = custom;
+  GetMarkerBuffer().Push( record );
+}
+
+PerformanceMarkerBuffer& PerformanceServer::GetMarkerBuffer()
+{
+  if( tMarkerBuffer.serverId != mId )
+  {
+    // first marker of this thread for this server
+    Mutex::ScopedLock lock( mMarkerBuffersMutex );
+
+    const std::thread::id id = std::this_thread::get_id();
+    auto iter = std::find_if( mMarkerBuffers.begin(), mMarkerBuffers.end(),
+                              [id]( const MarkerBuffer& buffer ) { return buffer.id == id; } );
+    if( iter == mMarkerBuffers.end() )
+    {
+      MarkerBuffer buffer;
+      buffer.id = id;
+      buffer.threadId = static_cast< int32_t >( syscall( SYS_gettid ) );
+
+      char name[17] = { 0 };
+      prctl( PR_GET_NAME, name );
+      buffer.name = name;
+      buffer.named = false;
+      buffer.buffer.reset( new PerformanceMarkerBuffer( MARKER_BUFFER_CAPACITY, buffer.threadId ) );
+
+      mMarkerBuffers.push_back( std::move( buffer ) );
+      iter = mMarkerBuffers.end() - 1;
+    }
+
+    if( !mConsumer.joinable() )
+    {
+      mConsumer = std::thread( &PerformanceServer::ConsumeMarkers, this );
+    }
 
-  // Add internal marker to statistics context manager
-  mStatContextManager.AddInternalMarker( marker );
+    tMarkerBuffer.serverId = mId;
+    tMarkerBuffer.buffer = iter->buffer.get();
+  }
 
+  return *tMarkerBuffer.buffer;
 }
 
-void PerformanceServer::LogContextStatistics( const char* const text )
+void PerformanceServer::ConsumeMarkers()
 {
-  Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo, text );
+  // the log function is installed per thread
+  mEnvironmentOptions.InstallLogFunction();
+
+  std::unique_lock< std::mutex > lock( mConsumerMutex );
+  bool terminate = false;
+  while( !terminate )
+  {
+    terminate = mConsumerCondition.wait_for( lock, CONSUMER_PERIOD, [this]() { return mTerminateConsumer; } );
+
+    lock.unlock();
+    ProcessMarkers();
+    lock.lock();
+  }
+
+  mEnvironmentOptions.UnInstallLogFunction();
 }
 
-void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char* const description )
+void PerformanceServer::ProcessMarkers()
 {
-#if defined(NETWORK_LOGGING_ENABLED)
-  // log to the network ( this is thread safe )
-  if( mNetworkControlEnabled )
+  mRecords.clear();
+  unsigned int droppedCount = 0u;
+  std::vector< ContextId > removedContexts;
   {
-    mNetworkServer.TransmitMarker( marker, description );
+    Mutex::ScopedLock lock( mMarkerBuffersMutex );
+
+    // the markers added before a context was removed are drained below, so they are processed first
+    removedContexts.swap( mRemovedContexts );
+    for( auto& buffer : mMarkerBuffers )
+    {
+      buffer.buffer->Pop( mRecords );
+      droppedCount += buffer.buffer->TakeDroppedCount();
+
+      if( mTraceWriter && !buffer.named )
+      {
+        mTraceWriter->AddThreadName( buffer.threadId, buffer.name.c_str() );
+        buffer.named = true;
+      }
+    }
+  }
+
+  if( droppedCount > 0u )
+  {
+    DALI_LOG_ERROR( "%u performance markers dropped, the marker buffers are full\n", droppedCount );
   }
-#endif
 
+  // the frame statistics expect the markers of all the threads in time order
+  std::stable_sort( mRecords.begin(), mRecords.end(),
+                    []( const PerformanceMarkerBuffer::Record& lhs, const PerformanceMarkerBuffer::Record& rhs ) { return lhs.microseconds < rhs.microseconds; } );
+
+  for( const auto& record : mRecords )
+  {
+    PerformanceMarker marker( record.type, FrameTimeStamp( 0, record.microseconds ) );
+    if( record.custom )
+    {
+      // get the marker description for this context, e.g SIZE_NEGOTIATION_START
+      const char* const description = mStatContextManager.GetMarkerDescription( record.type, record.contextId );
+      LogMarker( marker, description );
+      if( mTraceWriter )
+      {
+        mTraceWriter->AddMarker( marker, description, record.threadId );
+      }
+
+      // Add custom marker to statistics context manager
+      mStatContextManager.AddCustomMarker( marker, record.contextId );
+    }
+    else
+    {
+      LogMarker( marker, marker.GetName() );
+      if( mTraceWriter )
+      {
+        mTraceWriter->AddMarker( marker, marker.GetName(), record.threadId );
+      }
+
+      // Add internal marker to statistics context manager
+      mStatContextManager.AddInternalMarker( marker );
+    }
+  }
+
+  for( ContextId contextId : removedContexts )
+  {
+    mStatContextManager.RemoveContext( contextId );
+  }
+
+  if( mTraceWriter )
+  {
+    // the file is only written once a second, or when the trace buffer is full
+    mTraceWriter->Flush( false );
+  }
+}
+
+void PerformanceServer::LogContextStatistics( const char* const text )
+{
+  Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo, text );
+}
+
+void PerformanceServer::TraceMarker( const PerformanceMarker& marker, const char* const description )
+{
   // log to kernel trace
   if( mPerformanceOutputBitmask & OUTPUT_KERNEL_TRACE )
   {
@@ -219,6 +417,17 @@ void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char*
 
     mSystemTrace.Trace( marker, description );
   }
+}
+
+void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char* const description )
+{
+#if defined(NETWORK_LOGGING_ENABLED)
+  // log to the network ( this is thread safe )
+  if( mNetworkControlEnabled )
+  {
+    mNetworkServer.TransmitMarker( marker, description );
+  }
+#endif
 
   // log to Dali log ( this is thread safe )
   if ( mPerformanceOutputBitmask & OUTPUT_DALI_LOG )
@@ -19,6 +19,12 @@
  */
 
 // EXTERNAL INCLDUES
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/devel-api/threading/mutex.h>
 
@@ -26,7 +32,9 @@
 #include <dali/internal/system/common/frame-time-stats.h>
 #include <dali/internal/network/common/network-performance-server.h>
 #include <dali/internal/adaptor/common/adaptor-internal-services.h>
+#include <dali/internal/system/common/chrome-trace-writer.h>
 #include <dali/internal/system/common/performance-marker.h>
+#include <dali/internal/system/common/performance-marker-buffer.h>
 #include <dali/internal/system/common/stat-context-manager.h>
 
 namespace Dali
@@ -44,6 +52,10 @@ class StatContext;
  * Concrete implementation of performance interface.
  * Adaptor classes should never include this file, they
  * just need to include the abstract class performance-interface.h
+ *
+ * The threads adding markers only time stamp them, trace them to the kernel or system trace if enabled,
+ * and push them to a lock-free buffer of their own. A consumer thread drains the buffers periodically,
+ * and does the statistics, the DALi log, the network transmission and the trace file.
  */
 class PerformanceServer : public PerformanceInterface, public StatContextLogInterface
 {
@@ -99,6 +111,21 @@ public:
    */
   void EnableLogging( bool enable, ContextId contextId ) override;
 
+  /**
+   * @copydoc PerformanceInterface::IsTraceFileEnabled()
+   */
+  bool IsTraceFileEnabled() const override;
+
+  /**
+   * @copydoc PerformanceInterface::GetStatisticsLogFrequency()
+   */
+  unsigned int GetStatisticsLogFrequency() const override;
+
+  /**
+   * @copydoc PerformanceInterface::LogStatistics()
+   */
+  void LogStatistics( const char* text ) override;
+
 public: //StatLogInterface
 
   /**
@@ -109,14 +136,59 @@ public: //StatLogInterface
 private:
 
   /**
-   * @brief log the marker out to kernel/ DALi log
+   * @brief Time stamps a marker, traces it, and pushes it to the buffer of the calling thread.
+   * @param[in] markerType marker type
+   * @param[in] contextId context of a custom marker
+   * @param[in] custom whether the marker is for a custom context
+   */
+  void RecordMarker( MarkerType markerType, ContextId contextId, bool custom );
+
+  /**
+   * @brief Retrieves the marker buffer of the calling thread, creating it and the consumer thread if required.
+   * @return the buffer
+   */
+  PerformanceMarkerBuffer& GetMarkerBuffer();
+
+  /**
+   * @brief trace the marker to the kernel / system trace, on the thread adding it
+   * @param[in] marker performance marker
+   * @param[in] description marker description
+   */
+  void TraceMarker( const PerformanceMarker& marker, const char* const description );
+
+  /**
+   * @brief log the marker out to the network / DALi log, on the consumer thread
    * @param[in] marker performance marker
    * @param[in] description marker description
    */
   void LogMarker( const PerformanceMarker& marker, const char* const description );
 
+  /**
+   * @brief the loop of the consumer thread
+   */
+  void ConsumeMarkers();
+
+  /**
+   * @brief drains the marker buffers, and processes the markers in time order
+   */
+  void ProcessMarkers();
+
 private:
 
+  /**
+   * @brief the marker buffer of a thread adding markers
+   */
+  struct MarkerBuffer
+  {
+    std::thread::id id;                                   ///< the thread
+    int32_t threadId;                                     ///< the system id of the thread
+    std::string name;                                     ///< the name of the thread when it added its first marker
+    bool named;                                           ///< whether the thread has been named in the trace file
+    std::unique_ptr< PerformanceMarkerBuffer > buffer;    ///< the markers of the thread
+  };
+
+  typedef std::vector< MarkerBuffer > MarkerBuffers;
+
   const EnvironmentOptions& mEnvironmentOptions;          ///< environment options
   TraceInterface& mKernelTrace;                           ///< kernel trace interface
   TraceInterface& mSystemTrace;                           ///< system trace interface
@@ -131,6 +203,17 @@ private:
   unsigned int mStatisticsLogBitmask;                     ///< statistics log level
   unsigned int mPerformanceOutputBitmask;                 ///< performance marker output
 
+  const unsigned int mId;                                 ///< identifies the server to the threads caching their marker buffer
+  Dali::Mutex mMarkerBuffersMutex;                        ///< guards mMarkerBuffers and the start of the consumer
+  MarkerBuffers mMarkerBuffers;                           ///< the marker buffer of each thread adding markers
+  std::vector< ContextId > mRemovedContexts;              ///< the contexts removed while the consumer runs, deleted once their markers are processed
+  std::vector< PerformanceMarkerBuffer::Record > mRecords;///< the markers being processed, only used by the consumer
+  std::thread mConsumer;                                  ///< drains the marker buffers
+  std::mutex mConsumerMutex;                              ///< guards mTerminateConsumer
+  std::condition_variable mConsumerCondition;             ///< wakes the consumer up to terminate
+  bool mTerminateConsumer;                                ///< whether the consumer should stop once the buffers are drained
+  std::unique_ptr< ChromeTraceWriter > mTraceWriter;      ///< writes the markers to the trace file if enabled, only used by the consumer
+
   bool mLoggingEnabled:1;                                 ///< whether logging update / render to a log is enabled
   bool mLogFunctionInstalled:1;                           ///< whether the log function is installed
 };
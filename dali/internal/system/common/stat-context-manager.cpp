@@ -66,6 +66,9 @@ StatContextManager::~StatContextManager()
 PerformanceInterface::ContextId StatContextManager::AddContext( const char* const name,
                                                                 PerformanceMarker::MarkerFilter type  )
 {
+  // the contexts are read by the performance server's consumer thread
+  Mutex::ScopedLock lock( mDataMutex );
+
   unsigned int contextId = mNextContextId++;
 
   DALI_ASSERT_DEBUG( NULL == GetContext( contextId ) );
@@ -110,6 +113,8 @@ void StatContextManager::AddCustomMarker( const PerformanceMarker& marker, Perfo
 
 void StatContextManager::RemoveContext(PerformanceInterface::ContextId contextId )
 {
+  Mutex::ScopedLock lock( mDataMutex );
+
   for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
   {
     StatContext* context = *it;
@@ -186,6 +191,7 @@ const char* StatContextManager::GetContextName(PerformanceInterface::ContextId c
 
 const char* StatContextManager::GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const
 {
+  Mutex::ScopedLock lock( mDataMutex );
   StatContext* context = GetContext(contextId);
   if( context )
   {
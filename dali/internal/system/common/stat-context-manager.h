@@ -108,6 +108,14 @@ public:
      */
     const char* GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const;
 
+    /**
+     * @brief Get the log frequency
+     * @return log frequency in seconds
+     */
+    unsigned int GetLogFrequency() const
+    {
+      return mLogFrequency;
+    }
 
     /**
      * @brief enable / disable logging for a context
@@ -144,7 +152,7 @@ public:
      */
     StatContext* GetContext( PerformanceInterface::ContextId contextId ) const;
 
-    Dali::Mutex mDataMutex;                            ///< mutex
+    mutable Dali::Mutex mDataMutex;                    ///< mutex
     StatContexts mStatContexts;                        ///< The list of stat contexts
     StatContextLogInterface& mLogInterface;            ///< Log interface
 
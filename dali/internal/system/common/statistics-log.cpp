@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/statistics-log.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/adaptor/common/adaptor-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+StatisticsLog::StatisticsLog()
+: mLastLogTime( std::chrono::steady_clock::now() )
+{
+}
+
+PerformanceInterface* StatisticsLog::GetAdaptorPerformanceInterface()
+{
+  if( Adaptor::IsAvailable() )
+  {
+    return Internal::Adaptor::Adaptor::GetImplementation( Adaptor::Get() ).GetPerformanceInterface();
+  }
+
+  return nullptr;
+}
+
+bool StatisticsLog::IsDue( const PerformanceInterface* performanceInterface )
+{
+  if( !IsEnabled( performanceInterface ) )
+  {
+    return false;
+  }
+
+  const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if( now - mLastLogTime < std::chrono::seconds( performanceInterface->GetStatisticsLogFrequency() ) )
+  {
+    return false;
+  }
+
+  mLastLogTime = now;
+  return true;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,89 @@
+#ifndef DALI_INTERNAL_ADAPTOR_STATISTICS_LOG_H
+#define DALI_INTERNAL_ADAPTOR_STATISTICS_LOG_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Paces the statistics gathered by a module, e.g. the hit rate of a cache, so they are logged
+ * through the performance interface at the frequency of the performance statistics.
+ *
+ * The statistics are only logged when DALI_LOG_PERFORMANCE_STATS is set, every DALI_LOG_PERFORMANCE_STATS_FREQ seconds.
+ */
+class StatisticsLog
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  StatisticsLog();
+
+  /**
+   * @brief Retrieves the performance interface of the adaptor, for the modules which don't know it.
+   *
+   * @return The performance interface, or nullptr if there is no adaptor on the calling thread or no performance interface.
+   */
+  static PerformanceInterface* GetAdaptorPerformanceInterface();
+
+  /**
+   * @brief Whether the statistics are logged.
+   *
+   * @param[in] performanceInterface The performance interface, or nullptr
+   * @return true if the statistics are logged.
+   */
+  static bool IsEnabled( const PerformanceInterface* performanceInterface )
+  {
+    return performanceInterface && ( performanceInterface->GetStatisticsLogFrequency() > 0u );
+  }
+
+  /**
+   * @brief Whether the statistics should be logged now, i.e. they are enabled and a log period has passed
+   * since they were last logged, in which case a new period starts.
+   *
+   * @param[in] performanceInterface The performance interface, or nullptr
+   * @return true if the statistics should be logged.
+   */
+  bool IsDue( const PerformanceInterface* performanceInterface );
+
+private:
+
+  std::chrono::steady_clock::time_point mLastLogTime; ///< When the statistics were last logged
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_STATISTICS_LOG_H
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/mapped-file.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+// Files are not mapped on Windows; the decoders read the stream instead.
+
+MappedFile::MappedFile()
+: mAddress( nullptr ),
+  mSize( 0u )
+{
+}
+
+MappedFile::MappedFile( FILE* file, size_t minimumSize )
+: mAddress( nullptr ),
+  mSize( 0u )
+{
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+MappedFile::MappedFile( MappedFile&& rhs )
+: mAddress( nullptr ),
+  mSize( 0u )
+{
+}
+
+MappedFile& MappedFile::operator=( MappedFile&& rhs )
+{
+  return *this;
+}
+
+void MappedFile::Unmap()
+{
+}
+
+} /* namespace Platform */
+} /* namespace Internal */
+} /* namespace Dali */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/character-coverage.h>
+
+// EXTERNAL INCLUDES
+#include <fontconfig/fontconfig.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+const uint32_t CharacterCoverage::PAGE_SHIFT;
+const uint32_t CharacterCoverage::WORDS_PER_PAGE;
+const uint32_t CharacterCoverage::DIRECT_PAGES;
+
+CharacterCoverage::CharacterCoverage()
+: mPageIndex(),
+  mHighPages(),
+  mHighPageSlots(),
+  mBitmaps()
+{
+}
+
+CharacterCoverage::CharacterCoverage( const _FcCharSet* characterSet )
+: CharacterCoverage()
+{
+  if( nullptr == characterSet )
+  {
+    return;
+  }
+
+  static_assert( FC_CHARSET_MAP_SIZE == WORDS_PER_PAGE, "A fontconfig page doesn't match a coverage page" );
+
+  FcChar32 map[FC_CHARSET_MAP_SIZE];
+  FcChar32 next = 0u;
+  for( FcChar32 base = FcCharSetFirstPage( characterSet, map, &next );
+       FC_CHARSET_DONE != base;
+       base = FcCharSetNextPage( characterSet, map, &next ) )
+  {
+    bool isEmpty = true;
+    for( unsigned int index = 0u; index < FC_CHARSET_MAP_SIZE; ++index )
+    {
+      isEmpty = isEmpty && ( 0u == map[index] );
+    }
+    if( isEmpty )
+    {
+      continue;
+    }
+
+    // Unicode has fewer pages than a slot can count.
+    const uint16_t slot = static_cast<uint16_t>( mBitmaps.size() / WORDS_PER_PAGE + 1u );
+    mBitmaps.insert( mBitmaps.end(), map, map + FC_CHARSET_MAP_SIZE );
+
+    // The pages are given in increasing order.
+    const uint32_t page = base >> PAGE_SHIFT;
+    if( page < DIRECT_PAGES )
+    {
+      mPageIndex.resize( page + 1u, 0u );
+      mPageIndex[page] = slot;
+    }
+    else
+    {
+      mHighPages.push_back( page );
+      mHighPageSlots.push_back( slot );
+    }
+  }
+
+  mPageIndex.shrink_to_fit();
+  mHighPages.shrink_to_fit();
+  mHighPageSlots.shrink_to_fit();
+  mBitmaps.shrink_to_fit();
+}
+
+size_t CharacterCoverage::GetMemoryUsed() const
+{
+  return sizeof( CharacterCoverage ) +
+         mPageIndex.capacity() * sizeof( uint16_t ) +
+         mHighPages.capacity() * sizeof( uint32_t ) +
+         mHighPageSlots.capacity() * sizeof( uint16_t ) +
+         mBitmaps.capacity() * sizeof( uint32_t );
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
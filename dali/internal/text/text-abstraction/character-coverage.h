@@ -0,0 +1,125 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_CHARACTER_COVERAGE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_CHARACTER_COVERAGE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// forward declarations of font config types.
+struct _FcCharSet;
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The characters supported by a font, copied from its fontconfig character set into a structure
+ * which answers whether a character is supported without calling fontconfig.
+ *
+ * The characters are split in pages of 256, stored as bitmaps. The pages of the two first Unicode planes,
+ * where nearly all the text is, are found with a direct lookup table. The pages above are found with a
+ * binary search.
+ */
+class CharacterCoverage
+{
+public:
+
+  /**
+   * @brief Constructor. Creates a coverage without characters.
+   */
+  CharacterCoverage();
+
+  /**
+   * @brief Constructor. Copies the characters of a fontconfig character set.
+   *
+   * @param[in] characterSet The character set. It may be nullptr.
+   */
+  explicit CharacterCoverage( const _FcCharSet* characterSet );
+
+  /**
+   * @brief Whether the character is in the coverage.
+   *
+   * @param[in] character The character.
+   *
+   * @return @e true if the character is in the coverage.
+   */
+  bool Contains( Character character ) const
+  {
+    const uint32_t page = character >> PAGE_SHIFT;
+
+    uint32_t slot = 0u;
+    if( page < mPageIndex.size() )
+    {
+      slot = mPageIndex[page];
+    }
+    else if( page >= DIRECT_PAGES )
+    {
+      const auto it = std::lower_bound( mHighPages.begin(), mHighPages.end(), page );
+      if( ( it != mHighPages.end() ) && ( *it == page ) )
+      {
+        slot = mHighPageSlots[it - mHighPages.begin()];
+      }
+    }
+
+    if( 0u == slot )
+    {
+      return false;
+    }
+
+    const uint32_t word = mBitmaps[( slot - 1u ) * WORDS_PER_PAGE + ( ( character >> 5u ) & ( WORDS_PER_PAGE - 1u ) )];
+    return 0u != ( word & ( 1u << ( character & 31u ) ) );
+  }
+
+  /**
+   * @brief Retrieves the approximate memory used by the coverage.
+   *
+   * @return The number of bytes.
+   */
+  size_t GetMemoryUsed() const;
+
+private:
+
+  static const uint32_t PAGE_SHIFT = 8u;       ///< Each page holds 256 characters.
+  static const uint32_t WORDS_PER_PAGE = 8u;   ///< The number of 32 bit words of the bitmap of a page.
+  static const uint32_t DIRECT_PAGES = 0x200u; ///< The pages of the Basic and Supplementary Multilingual Planes.
+
+  std::vector<uint16_t> mPageIndex;     ///< The slot plus one of each page below DIRECT_PAGES, zero if the page has no characters.
+  std::vector<uint32_t> mHighPages;     ///< The pages from DIRECT_PAGES with characters, sorted.
+  std::vector<uint16_t> mHighPageSlots; ///< The slot plus one of each of mHighPages.
+  std::vector<uint32_t> mBitmaps;       ///< The bitmaps of the pages with characters, WORDS_PER_PAGE words per slot.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_CHARACTER_COVERAGE_H
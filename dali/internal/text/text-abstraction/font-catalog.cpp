@@ -0,0 +1,702 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/font-catalog.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <fontconfig/fontconfig.h>
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/mapped-file.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_FONT_CLIENT" );
+#endif
+
+const uint32_t CATALOG_MAGIC = 0x54414346u; ///< "FCAT"
+const uint32_t CATALOG_VERSION = 1u;
+const char* const CATALOG_FILE_NAME = "dali-font-catalog";
+const uint32_t NO_COVERAGE = 0xffffffffu;   ///< Stored instead of the coverage size of fonts whose coverage isn't known.
+const uint32_t PAGE_WORDS = 1u + FC_CHARSET_MAP_SIZE; ///< The first character of a page and its bitmap.
+
+/**
+ * @brief Retrieves the default languages of fontconfig, which FcDefaultSubstitute adds to the font client's patterns
+ * and which the fonts are sorted for.
+ *
+ * @return The languages separated by colons.
+ */
+std::string GetDefaultLanguages()
+{
+  std::string languages;
+
+  FcStrSet* languageSet = FcGetDefaultLangs();
+  FcStrList* list = FcStrListCreate( languageSet );
+  if( nullptr != list )
+  {
+    FcChar8* language = nullptr;
+    while( nullptr != ( language = FcStrListNext( list ) ) )
+    {
+      languages += languages.empty() ? "" : ":";
+      languages += reinterpret_cast<const char*>( language );
+    }
+    FcStrListDone( list );
+  }
+  FcStrSetDestroy( languageSet );
+
+  return languages;
+}
+
+/**
+ * @brief Builds the key of a font description requested to fontconfig.
+ */
+std::string MakeRequestKey( const FontDescription& fontDescription )
+{
+  return fontDescription.family + '\n' +
+         std::to_string( fontDescription.width ) + ',' +
+         std::to_string( fontDescription.weight ) + ',' +
+         std::to_string( fontDescription.slant );
+}
+
+/**
+ * @brief Builds the key of a font returned by fontconfig.
+ */
+std::string MakeFontKey( const FontDescription& fontDescription )
+{
+  return fontDescription.path + '\n' + MakeRequestKey( fontDescription ) + ',' + std::to_string( fontDescription.type );
+}
+
+/**
+ * @brief Serializes the catalog into a buffer in the native byte order.
+ */
+class Writer
+{
+public:
+
+  void Write32( uint32_t value )
+  {
+    Write( &value, sizeof( value ) );
+  }
+
+  void Write64( int64_t value )
+  {
+    Write( &value, sizeof( value ) );
+  }
+
+  void WriteString( const std::string& string )
+  {
+    Write32( static_cast<uint32_t>( string.size() ) );
+    Write( string.data(), string.size() );
+  }
+
+  void WriteDescription( const FontDescription& description )
+  {
+    WriteString( description.path );
+    WriteString( description.family );
+    Write32( description.width );
+    Write32( description.weight );
+    Write32( description.slant );
+    Write32( description.type );
+  }
+
+  void WriteIndices( const std::vector<uint32_t>& indices )
+  {
+    Write32( static_cast<uint32_t>( indices.size() ) );
+    Write( indices.data(), indices.size() * sizeof( uint32_t ) );
+  }
+
+  const std::vector<uint8_t>& GetBuffer() const
+  {
+    return mBuffer;
+  }
+
+private:
+
+  void Write( const void* data, size_t size )
+  {
+    const uint8_t* bytes = static_cast<const uint8_t*>( data );
+    mBuffer.insert( mBuffer.end(), bytes, bytes + size );
+  }
+
+private:
+
+  std::vector<uint8_t> mBuffer; ///< The serialized catalog
+};
+
+/**
+ * @brief Reads a serialized catalog, checking every read is within the buffer.
+ *
+ * After a failed read all the following reads fail too, so the result only needs to be checked at the end.
+ */
+class Reader
+{
+public:
+
+  Reader( const uint8_t* data, size_t size )
+  : mData( data ),
+    mSize( size ),
+    mPosition( 0u ),
+    mValid( true )
+  {
+  }
+
+  bool IsValid() const
+  {
+    return mValid;
+  }
+
+  uint32_t Read32()
+  {
+    uint32_t value = 0u;
+    Read( &value, sizeof( value ) );
+    return value;
+  }
+
+  int64_t Read64()
+  {
+    int64_t value = 0;
+    Read( &value, sizeof( value ) );
+    return value;
+  }
+
+  std::string ReadString()
+  {
+    const uint32_t size = Read32();
+    if( !Check( size ) )
+    {
+      return std::string();
+    }
+    std::string string( reinterpret_cast<const char*>( mData + mPosition ), size );
+    mPosition += size;
+    return string;
+  }
+
+  void ReadDescription( FontDescription& description )
+  {
+    description.path = ReadString();
+    description.family = ReadString();
+    const uint32_t width = Read32();
+    const uint32_t weight = Read32();
+    const uint32_t slant = Read32();
+    const uint32_t type = Read32();
+    if( ( width > FontWidth::ULTRA_EXPANDED ) || ( weight > FontWeight::BLACK ) || ( slant > FontSlant::OBLIQUE ) || ( type > FontDescription::BITMAP_FONT ) )
+    {
+      mValid = false;
+      return;
+    }
+    description.width = static_cast<FontWidth::Type>( width );
+    description.weight = static_cast<FontWeight::Type>( weight );
+    description.slant = static_cast<FontSlant::Type>( slant );
+    description.type = static_cast<FontDescription::Type>( type );
+  }
+
+  void ReadWords( std::vector<uint32_t>& words, uint32_t count )
+  {
+    if( !Check( static_cast<size_t>( count ) * sizeof( uint32_t ) ) )
+    {
+      return;
+    }
+    words.resize( count );
+    Read( words.data(), count * sizeof( uint32_t ) );
+  }
+
+  void ReadIndices( std::vector<uint32_t>& indices, uint32_t numberOfFonts )
+  {
+    ReadWords( indices, Read32() );
+    for( auto index : indices )
+    {
+      mValid = mValid && ( index < numberOfFonts );
+    }
+  }
+
+private:
+
+  bool Check( size_t size )
+  {
+    mValid = mValid && ( size <= mSize - mPosition );
+    return mValid;
+  }
+
+  void Read( void* data, size_t size )
+  {
+    if( Check( size ) )
+    {
+      memcpy( data, mData + mPosition, size );
+      mPosition += size;
+    }
+  }
+
+private:
+
+  const uint8_t* mData;     ///< The serialized catalog
+  size_t         mSize;     ///< The size of the serialized catalog
+  size_t         mPosition; ///< The position of the next read
+  bool           mValid;    ///< Whether all the reads were within the buffer and valid
+};
+
+/**
+ * @brief Adds the paths of a fontconfig string list with their modification times.
+ */
+template<typename Dependency>
+void AddDependencies( FcStrList* list, std::vector<Dependency>& dependencies )
+{
+  if( nullptr == list )
+  {
+    return;
+  }
+
+  for( FcChar8* path = FcStrListNext( list ); nullptr != path; path = FcStrListNext( list ) )
+  {
+    Dependency dependency;
+    dependency.path.assign( reinterpret_cast<const char*>( path ) );
+
+    // Missing files are recorded too, so the catalog is discarded if they are created.
+    struct stat fileStatus;
+    if( stat( dependency.path.c_str(), &fileStatus ) == 0 )
+    {
+      dependency.seconds = static_cast<int64_t>( fileStatus.st_mtim.tv_sec );
+      dependency.nanoseconds = static_cast<int64_t>( fileStatus.st_mtim.tv_nsec );
+    }
+    else
+    {
+      dependency.seconds = -1;
+      dependency.nanoseconds = -1;
+    }
+    dependencies.push_back( std::move( dependency ) );
+  }
+
+  FcStrListDone( list );
+}
+
+} // unnamed namespace
+
+std::string FontCatalog::GetDefaultPath()
+{
+  const char* environmentValue = EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_FONT_CATALOG_PATH );
+  if( ( nullptr == environmentValue ) || ( '\0' == *environmentValue ) )
+  {
+    // The catalog is opt-in.
+    return std::string();
+  }
+
+  const std::string path( environmentValue );
+  if( '/' == path.back() )
+  {
+    // A directory, e.g. the user's cache directory.
+    return path + CATALOG_FILE_NAME;
+  }
+
+  return path;
+}
+
+FontCatalog::FontCatalog()
+: mFonts(),
+  mFontIndex(),
+  mSystemFonts(),
+  mFontLists(),
+  mMatches(),
+  mLanguages( GetDefaultLanguages() ),
+  mHasSystemFonts( false ),
+  mModified( false )
+{
+}
+
+FontCatalog::~FontCatalog()
+{
+  Reset();
+}
+
+bool FontCatalog::Load( const std::string& path )
+{
+  Clear();
+
+  FILE* file = fopen( path.c_str(), "rb" );
+  if( nullptr == file )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Load. No catalog at [%s]\n", path.c_str() );
+    return false;
+  }
+
+  Dali::Internal::Platform::MappedFile mappedFile( file );
+  fclose( file );
+  if( !mappedFile.IsMapped() )
+  {
+    return false;
+  }
+
+  Reader reader( mappedFile.GetData(), mappedFile.GetSize() );
+  if( ( reader.Read32() != CATALOG_MAGIC ) || ( reader.Read32() != CATALOG_VERSION ) || ( reader.ReadString() != mLanguages ) )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Load. Catalog [%s] is for another version or other languages\n", path.c_str() );
+    return false;
+  }
+
+  // Check nothing fontconfig depends on has changed since the catalog was written.
+  std::vector<Dependency> dependencies;
+  GetDependencies( dependencies );
+  const uint32_t numberOfDependencies = reader.Read32();
+  bool upToDate = reader.IsValid() && ( numberOfDependencies == dependencies.size() );
+  for( uint32_t index = 0u; upToDate && ( index < numberOfDependencies ); ++index )
+  {
+    const Dependency& dependency = dependencies[index];
+    upToDate = ( reader.ReadString() == dependency.path ) &&
+               ( reader.Read64() == dependency.seconds ) &&
+               ( reader.Read64() == dependency.nanoseconds ) &&
+               reader.IsValid();
+  }
+  if( !upToDate )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Load. Catalog [%s] is out of date\n", path.c_str() );
+    return false;
+  }
+
+  const uint32_t numberOfFonts = reader.Read32();
+  for( uint32_t index = 0u; reader.IsValid() && ( index < numberOfFonts ); ++index )
+  {
+    Font font;
+    font.characterSet = nullptr;
+    reader.ReadDescription( font.description );
+    const uint32_t coverageSize = reader.Read32();
+    font.hasCoverage = ( coverageSize != NO_COVERAGE );
+    if( font.hasCoverage )
+    {
+      reader.ReadWords( font.coverage, coverageSize );
+    }
+    mFontIndex[MakeFontKey( font.description )] = index;
+    mFonts.push_back( std::move( font ) );
+  }
+
+  mHasSystemFonts = ( reader.Read32() != 0u );
+  reader.ReadIndices( mSystemFonts, numberOfFonts );
+
+  const uint32_t numberOfLists = reader.Read32();
+  for( uint32_t index = 0u; reader.IsValid() && ( index < numberOfLists ); ++index )
+  {
+    const std::string key = reader.ReadString();
+    reader.ReadIndices( mFontLists[key], numberOfFonts );
+  }
+
+  const uint32_t numberOfMatches = reader.Read32();
+  for( uint32_t index = 0u; reader.IsValid() && ( index < numberOfMatches ); ++index )
+  {
+    const std::string key = reader.ReadString();
+    const uint32_t fontIndex = reader.Read32();
+    if( fontIndex >= numberOfFonts || !mFonts[fontIndex].hasCoverage )
+    {
+      Clear();
+      return false;
+    }
+    mMatches[key] = fontIndex;
+  }
+
+  // The coverage of each page is the first character and the bitmap of the page.
+  for( const auto& font : mFonts )
+  {
+    if( font.coverage.size() % PAGE_WORDS != 0u )
+    {
+      Clear();
+      return false;
+    }
+  }
+
+  if( !reader.IsValid() )
+  {
+    DALI_LOG_ERROR( "Font catalog [%s] is corrupt\n", path.c_str() );
+    Clear();
+    return false;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Load. Loaded [%s]; fonts : %d, lists : %d, matches : %d\n", path.c_str(), mFonts.size(), mFontLists.size(), mMatches.size() );
+  return true;
+}
+
+bool FontCatalog::Save( const std::string& path )
+{
+  std::vector<Dependency> dependencies;
+  GetDependencies( dependencies );
+
+  Writer writer;
+  writer.Write32( CATALOG_MAGIC );
+  writer.Write32( CATALOG_VERSION );
+  writer.WriteString( mLanguages );
+
+  writer.Write32( static_cast<uint32_t>( dependencies.size() ) );
+  for( const auto& dependency : dependencies )
+  {
+    writer.WriteString( dependency.path );
+    writer.Write64( dependency.seconds );
+    writer.Write64( dependency.nanoseconds );
+  }
+
+  writer.Write32( static_cast<uint32_t>( mFonts.size() ) );
+  for( const auto& font : mFonts )
+  {
+    writer.WriteDescription( font.description );
+    if( font.hasCoverage )
+    {
+      writer.WriteIndices( font.coverage );
+    }
+    else
+    {
+      writer.Write32( NO_COVERAGE );
+    }
+  }
+
+  writer.Write32( mHasSystemFonts ? 1u : 0u );
+  writer.WriteIndices( mSystemFonts );
+
+  writer.Write32( static_cast<uint32_t>( mFontLists.size() ) );
+  for( const auto& fontList : mFontLists )
+  {
+    writer.WriteString( fontList.first );
+    writer.WriteIndices( fontList.second );
+  }
+
+  writer.Write32( static_cast<uint32_t>( mMatches.size() ) );
+  for( const auto& match : mMatches )
+  {
+    writer.WriteString( match.first );
+    writer.Write32( match.second );
+  }
+
+  // Create the cache directory if it doesn't exist yet. Only its last component is created.
+  const std::string::size_type separator = path.rfind( '/' );
+  if( ( separator != std::string::npos ) && ( separator > 0u ) )
+  {
+    mkdir( path.substr( 0u, separator ).c_str(), 0700 );
+  }
+
+  // Write a file private to this process and rename it over the catalog, which replaces the catalog atomically.
+  const std::string temporaryPath = path + '.' + std::to_string( getpid() );
+  FILE* file = fopen( temporaryPath.c_str(), "wb" );
+  if( nullptr == file )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Save. Can't write [%s]\n", temporaryPath.c_str() );
+    return false;
+  }
+
+  const std::vector<uint8_t>& buffer = writer.GetBuffer();
+  const bool written = ( fwrite( buffer.data(), 1u, buffer.size(), file ) == buffer.size() );
+  const bool closed = ( fclose( file ) == 0 );
+  if( !written || !closed || ( rename( temporaryPath.c_str(), path.c_str() ) != 0 ) )
+  {
+    DALI_LOG_ERROR( "Failed to write the font catalog [%s]\n", path.c_str() );
+    unlink( temporaryPath.c_str() );
+    return false;
+  }
+
+  mModified = false;
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "FontCatalog::Save. Saved [%s]; %d bytes\n", path.c_str(), buffer.size() );
+  return true;
+}
+
+void FontCatalog::Clear()
+{
+  Reset();
+  mLanguages = GetDefaultLanguages();
+  mModified = false;
+}
+
+bool FontCatalog::GetSystemFonts( FontList& systemFonts ) const
+{
+  if( !mHasSystemFonts )
+  {
+    return false;
+  }
+
+  systemFonts.clear();
+  systemFonts.reserve( mSystemFonts.size() );
+  for( auto index : mSystemFonts )
+  {
+    systemFonts.push_back( mFonts[index].description );
+  }
+  return true;
+}
+
+void FontCatalog::SetSystemFonts( const FontList& systemFonts )
+{
+  mSystemFonts.clear();
+  mSystemFonts.reserve( systemFonts.size() );
+  for( const auto& description : systemFonts )
+  {
+    mSystemFonts.push_back( AddFont( description, nullptr ) );
+  }
+  mHasSystemFonts = true;
+  mModified = true;
+}
+
+bool FontCatalog::GetFontList( const FontDescription& fontDescription, FontList& fontList, CharacterSetList& characterSetList )
+{
+  const auto iter = mFontLists.find( MakeRequestKey( fontDescription ) );
+  if( iter == mFontLists.end() )
+  {
+    return false;
+  }
+
+  fontList.clear();
+  fontList.reserve( iter->second.size() );
+  for( auto index : iter->second )
+  {
+    fontList.push_back( mFonts[index].description );
+    characterSetList.PushBack( GetCharacterSet( index ) );
+  }
+  return true;
+}
+
+void FontCatalog::AddFontList( const FontDescription& fontDescription, const FontList& fontList, const CharacterSetList& characterSetList )
+{
+  DALI_ASSERT_DEBUG( ( fontList.size() <= characterSetList.Count() ) && "FontCatalog::AddFontList. Different number of fonts and character sets." );
+
+  // The character sets of the list may follow the ones already in the given vector.
+  const std::size_t firstCharacterSet = characterSetList.Count() - fontList.size();
+
+  std::vector<uint32_t>& indices = mFontLists[MakeRequestKey( fontDescription )];
+  indices.clear();
+  indices.reserve( fontList.size() );
+  for( std::size_t index = 0u; index < fontList.size(); ++index )
+  {
+    indices.push_back( AddFont( fontList[index], characterSetList[firstCharacterSet + index] ) );
+  }
+  mModified = true;
+}
+
+bool FontCatalog::GetMatch( const FontDescription& fontDescription, FontDescription& match, _FcCharSet** characterSet )
+{
+  const auto iter = mMatches.find( MakeRequestKey( fontDescription ) );
+  if( iter == mMatches.end() )
+  {
+    return false;
+  }
+
+  match = mFonts[iter->second].description;
+  *characterSet = GetCharacterSet( iter->second );
+  return true;
+}
+
+void FontCatalog::AddMatch( const FontDescription& fontDescription, const FontDescription& match, _FcCharSet* characterSet )
+{
+  mMatches[MakeRequestKey( fontDescription )] = AddFont( match, characterSet );
+  mModified = true;
+}
+
+uint32_t FontCatalog::AddFont( const FontDescription& description, _FcCharSet* characterSet )
+{
+  const auto result = mFontIndex.emplace( MakeFontKey( description ), static_cast<uint32_t>( mFonts.size() ) );
+  if( result.second )
+  {
+    Font font;
+    font.description = description;
+    font.characterSet = nullptr;
+    font.hasCoverage = false;
+    mFonts.push_back( std::move( font ) );
+  }
+
+  Font& font = mFonts[result.first->second];
+  if( !font.hasCoverage && ( nullptr != characterSet ) )
+  {
+    FcChar32 map[FC_CHARSET_MAP_SIZE];
+    FcChar32 next = 0u;
+    for( FcChar32 base = FcCharSetFirstPage( characterSet, map, &next ); base != FC_CHARSET_DONE; base = FcCharSetNextPage( characterSet, map, &next ) )
+    {
+      font.coverage.push_back( base );
+      font.coverage.insert( font.coverage.end(), map, map + FC_CHARSET_MAP_SIZE );
+    }
+    font.characterSet = FcCharSetCopy( characterSet );
+    font.hasCoverage = true;
+  }
+
+  return result.first->second;
+}
+
+_FcCharSet* FontCatalog::GetCharacterSet( uint32_t fontIndex )
+{
+  Font& font = mFonts[fontIndex];
+  if( !font.hasCoverage )
+  {
+    return nullptr;
+  }
+
+  if( nullptr == font.characterSet )
+  {
+    font.characterSet = FcCharSetCreate();
+    for( std::size_t page = 0u; page < font.coverage.size(); page += PAGE_WORDS )
+    {
+      const FcChar32 base = font.coverage[page];
+      for( uint32_t word = 0u; word < FC_CHARSET_MAP_SIZE; ++word )
+      {
+        for( uint32_t bits = font.coverage[page + 1u + word]; bits != 0u; bits &= bits - 1u )
+        {
+          FcCharSetAddChar( font.characterSet, base + word * 32u + static_cast<FcChar32>( __builtin_ctz( bits ) ) );
+        }
+      }
+    }
+  }
+
+  return FcCharSetCopy( font.characterSet );
+}
+
+void FontCatalog::Reset()
+{
+  for( auto& font : mFonts )
+  {
+    if( nullptr != font.characterSet )
+    {
+      FcCharSetDestroy( font.characterSet );
+    }
+  }
+
+  mFonts.clear();
+  mFontIndex.clear();
+  mSystemFonts.clear();
+  mFontLists.clear();
+  mMatches.clear();
+  mHasSystemFonts = false;
+}
+
+void FontCatalog::GetDependencies( std::vector<Dependency>& dependencies )
+{
+  // nullptr means the current configuration is used.
+  AddDependencies( FcConfigGetConfigFiles( nullptr ), dependencies );
+  AddDependencies( FcConfigGetFontDirs( nullptr ), dependencies );
+  AddDependencies( FcConfigGetCacheDirs( nullptr ), dependencies );
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
@@ -0,0 +1,251 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CATALOG_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CATALOG_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <dali/public-api/common/dali-vector.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-list.h>
+
+// forward declarations of font config types.
+struct _FcCharSet;
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Vector of character sets.
+ */
+typedef Vector<_FcCharSet*> CharacterSetList;
+
+/**
+ * @brief A catalog of the results of the fontconfig queries made by the font client, saved to disk between runs.
+ *
+ * It holds the system fonts, the sorted font lists used as fallbacks for a font description, the font
+ * matched for a font description and the character coverage of those fonts. Loading it at start-up
+ * avoids enumerating and sorting the platform's fonts again.
+ *
+ * The file records the modification times of the fontconfig configuration files, font directories and
+ * cache directories, and the default languages of fontconfig the lists were sorted for. It is discarded if any of them changed.
+ *
+ * The catalog is not thread safe.
+ */
+class FontCatalog
+{
+public:
+
+  /**
+   * @brief Retrieves the path of the catalog file.
+   *
+   * The catalog is only used when DALI_FONT_CATALOG_PATH is set. A path ending with a slash is a directory
+   * the catalog is kept in, e.g. the user's cache directory.
+   *
+   * @return The path, or an empty string if the catalog is not used.
+   */
+  static std::string GetDefaultPath();
+
+  /**
+   * @brief Constructor. Creates an empty catalog for the current default languages.
+   */
+  FontCatalog();
+
+  /**
+   * @brief Destructor. Releases the character sets created by the catalog.
+   */
+  ~FontCatalog();
+
+  /**
+   * @brief Replaces the contents of the catalog with the file at the given path.
+   *
+   * The catalog is left empty if the file doesn't exist, is corrupt or is out of date.
+   *
+   * @param[in] path The path of the file.
+   *
+   * @return @e true if the file has been loaded.
+   */
+  bool Load( const std::string& path );
+
+  /**
+   * @brief Writes the catalog to the given path, recording the current fontconfig files' modification times.
+   *
+   * The file is written to a temporary file first and then renamed, so processes sharing the catalog never read a partial file.
+   *
+   * @param[in] path The path of the file.
+   *
+   * @return @e true if the file has been written.
+   */
+  bool Save( const std::string& path );
+
+  /**
+   * @brief Whether entries have been added since the catalog was loaded or saved.
+   */
+  bool IsModified() const
+  {
+    return mModified;
+  }
+
+  /**
+   * @brief Removes all the entries and resets the languages to the current default ones.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the system fonts.
+   *
+   * @param[out] systemFonts The system fonts.
+   *
+   * @return @e true if the system fonts are in the catalog.
+   */
+  bool GetSystemFonts( FontList& systemFonts ) const;
+
+  /**
+   * @brief Sets the system fonts.
+   *
+   * @param[in] systemFonts The system fonts.
+   */
+  void SetSystemFonts( const FontList& systemFonts );
+
+  /**
+   * @brief Retrieves the sorted list of fonts for a font description.
+   *
+   * @note The reference counters of the character sets added to @p characterSetList are increased.
+   *
+   * @param[in] fontDescription The font description.
+   * @param[out] fontList The list of fonts.
+   * @param[out] characterSetList The character sets of the fonts are added to this list.
+   *
+   * @return @e true if the list is in the catalog.
+   */
+  bool GetFontList( const FontDescription& fontDescription, FontList& fontList, CharacterSetList& characterSetList );
+
+  /**
+   * @brief Adds the sorted list of fonts for a font description.
+   *
+   * @param[in] fontDescription The font description.
+   * @param[in] fontList The list of fonts.
+   * @param[in] characterSetList The character sets of the fonts.
+   */
+  void AddFontList( const FontDescription& fontDescription, const FontList& fontList, const CharacterSetList& characterSetList );
+
+  /**
+   * @brief Retrieves the font matched for a font description.
+   *
+   * @note The reference counter of the returned character set is increased.
+   *
+   * @param[in] fontDescription The font description.
+   * @param[out] match The description of the matched font.
+   * @param[out] characterSet The character set of the matched font.
+   *
+   * @return @e true if the match is in the catalog.
+   */
+  bool GetMatch( const FontDescription& fontDescription, FontDescription& match, _FcCharSet** characterSet );
+
+  /**
+   * @brief Adds the font matched for a font description.
+   *
+   * @param[in] fontDescription The font description.
+   * @param[in] match The description of the matched font.
+   * @param[in] characterSet The character set of the matched font.
+   */
+  void AddMatch( const FontDescription& fontDescription, const FontDescription& match, _FcCharSet* characterSet );
+
+private:
+
+  /**
+   * @brief A font of the catalog.
+   */
+  struct Font
+  {
+    FontDescription       description;  ///< The description of the font.
+    std::vector<uint32_t> coverage;     ///< The character coverage: the first character and the eight bitmap words of each page.
+    _FcCharSet*           characterSet; ///< The character set built from the coverage, or nullptr if not built yet.
+    bool                  hasCoverage;  ///< Whether the coverage is known.
+  };
+
+  /**
+   * @brief A file the catalog depends on and its modification time.
+   */
+  struct Dependency
+  {
+    std::string path;        ///< The path of the file or directory.
+    int64_t     seconds;     ///< The modification time in seconds.
+    int64_t     nanoseconds; ///< The nanoseconds of the modification time.
+  };
+
+  // Undefined
+  FontCatalog( const FontCatalog& ) = delete;
+  FontCatalog& operator=( const FontCatalog& ) = delete;
+
+  /**
+   * @brief Finds or adds a font.
+   *
+   * @param[in] description The description of the font.
+   * @param[in] characterSet The character set of the font, or nullptr if not known.
+   *
+   * @return The index of the font.
+   */
+  uint32_t AddFont( const FontDescription& description, _FcCharSet* characterSet );
+
+  /**
+   * @brief Retrieves the character set of a font, building it from the coverage if needed.
+   *
+   * @note The reference counter of the returned character set is increased.
+   */
+  _FcCharSet* GetCharacterSet( uint32_t fontIndex );
+
+  /**
+   * @brief Releases the character sets and removes all the entries.
+   */
+  void Reset();
+
+  /**
+   * @brief Lists the fontconfig configuration files, font directories and cache directories with their modification times.
+   */
+  static void GetDependencies( std::vector<Dependency>& dependencies );
+
+private:
+
+  std::vector<Font>                                      mFonts;          ///< The fonts of all the entries.
+  std::unordered_map<std::string, uint32_t>              mFontIndex;      ///< The index of each font by its description.
+  std::vector<uint32_t>                                  mSystemFonts;    ///< The indices of the system fonts.
+  std::unordered_map<std::string, std::vector<uint32_t>> mFontLists;      ///< The indices of the sorted fonts by the description they are sorted for.
+  std::unordered_map<std::string, uint32_t>              mMatches;        ///< The index of the font matched by the description it is matched for.
+  std::string                                            mLanguages;      ///< The default languages the fonts are sorted and matched for.
+  bool                                                   mHasSystemFonts; ///< Whether the system fonts are in the catalog.
+  bool                                                   mModified;       ///< Whether entries have been added since the last load or save.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CATALOG_H
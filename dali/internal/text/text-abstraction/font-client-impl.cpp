@@ -43,7 +43,8 @@ Dali::TextAbstraction::FontClient FontClient::gPreInitializedFontClient( NULL );
 FontClient::FontClient()
 : mPlugin( nullptr ),
   mDpiHorizontal( 0 ),
-  mDpiVertical( 0 )
+  mDpiVertical( 0 ),
+  mCacheGeneration( 0u )
 {
 }
 
@@ -99,6 +100,8 @@ Dali::TextAbstraction::FontClient FontClient::PreInitialize()
 
 void FontClient::ClearCache()
 {
+  ++mCacheGeneration;
+
   if( mPlugin )
   {
     mPlugin->ClearCache();
@@ -208,6 +211,23 @@ FontId FontClient::FindFallbackFont( Character charcode,
                                     preferColor );
 }
 
+void FontClient::FindFallbackFonts( const Character* const text,
+                                    Length numberOfCharacters,
+                                    const FontDescription& preferredFontDescription,
+                                    PointSize26Dot6 requestedPointSize,
+                                    bool preferColor,
+                                    Vector<FontId>& fontIds )
+{
+  CreatePlugin();
+
+  mPlugin->FindFallbackFonts( text,
+                              numberOfCharacters,
+                              preferredFontDescription,
+                              requestedPointSize,
+                              preferColor,
+                              fontIds );
+}
+
 bool FontClient::IsScalable( const FontPath& path )
 {
   CreatePlugin();
@@ -358,6 +378,11 @@ bool FontClient::AddCustomFontDirectory( const FontPath& path )
   return mPlugin->AddCustomFontDirectory( path );
 }
 
+uint32_t FontClient::GetCacheGeneration() const
+{
+  return mCacheGeneration;
+}
+
 void FontClient::CreatePlugin()
 {
   if( !mPlugin )
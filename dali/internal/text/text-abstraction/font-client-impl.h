@@ -135,6 +135,16 @@ public:
                            PointSize26Dot6 requestedPointSize,
                            bool preferColor );
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::FindFallbackFonts()
+   */
+  void FindFallbackFonts( const Character* const text,
+                          Length numberOfCharacters,
+                          const FontDescription& preferredFontDescription,
+                          PointSize26Dot6 requestedPointSize,
+                          bool preferColor,
+                          Vector<FontId>& fontIds );
+
   /**
    * @copydoc Dali::TextAbstraction::FontClient::GetFontId( const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex )
    */
@@ -246,6 +256,16 @@ public:
    */
   bool AddCustomFontDirectory( const FontPath& path );
 
+  /**
+   * @brief Retrieves a number which changes every time the font caches are cleared.
+   *
+   * Font ids may refer to different fonts once the caches are cleared, so any object
+   * created from a font id (i.e. a HarfBuzz font) has to be discarded when it changes.
+   *
+   * @return The generation of the font caches.
+   */
+  uint32_t GetCacheGeneration() const;
+
 private:
 
   /**
@@ -268,6 +288,8 @@ private:
   unsigned int mDpiHorizontal;
   unsigned int mDpiVertical;
 
+  uint32_t mCacheGeneration; ///< Incremented by ClearCache().
+
   static Dali::TextAbstraction::FontClient gPreInitializedFontClient;
 
 }; // class FontClient
@@ -29,9 +29,14 @@
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/statistics-log.h>
 
 // EXTERNAL INCLUDES
 #include <fontconfig/fontconfig.h>
+#include <cstdio>
+#include <cstdlib>
 
 namespace
 {
@@ -90,6 +95,37 @@ const unsigned int NUM_FONT_WEIGHT_TYPE = sizeof( FONT_WEIGHT_TYPE_TO_INT ) / si
 const int FONT_SLANT_TYPE_TO_INT[] = { -1, 0, 100, 110 };
 const unsigned int NUM_FONT_SLANT_TYPE = sizeof( FONT_SLANT_TYPE_TO_INT ) / sizeof( int );
 
+/**
+ * @brief Combines the hash of a value with the hash of the previous values of a key.
+ */
+inline void HashCombine( std::size_t& seed, std::size_t hash )
+{
+  seed ^= hash + 0x9e3779b9u + ( seed << 6 ) + ( seed >> 2 );
+}
+
+/**
+ * @brief Packs the pair 'validated font identifier and font point size' into a key of the font description size cache index.
+ */
+inline uint64_t MakeFontDescriptionSizeKey( uint32_t validatedFontId, uint32_t requestedPointSize )
+{
+  return ( static_cast<uint64_t>( validatedFontId ) << 32u ) | requestedPointSize;
+}
+
+const size_t DEFAULT_GLYPH_BITMAP_CACHE_SIZE_KB = 1024u;  ///< The default memory budget of the glyph bitmap cache.
+const unsigned int STATISTICS_LOG_SIZE = 192u;
+
+/**
+ * @brief Reads the memory budget of the glyph bitmap cache from DALI_GLYPH_BITMAP_CACHE_SIZE.
+ *
+ * @return The memory budget in bytes.
+ */
+size_t GetGlyphBitmapCacheBudget()
+{
+  const char* environmentValue = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_GLYPH_BITMAP_CACHE_SIZE );
+  const long sizeKb = environmentValue ? std::strtol( environmentValue, nullptr, 10 ) : static_cast<long>( DEFAULT_GLYPH_BITMAP_CACHE_SIZE_KB );
+  return sizeKb > 0 ? static_cast<size_t>( sizeKb ) * 1024u : 0u;
+}
+
 } // namespace
 
 using Dali::Vector;
@@ -186,6 +222,55 @@ FontClient::Plugin::FontDescriptionSizeCacheItem::FontDescriptionSizeCacheItem(
 {
 }
 
+FontClient::Plugin::FontFaceKey::FontFaceKey( const FontPath& path,
+                                              PointSize26Dot6 requestedPointSize,
+                                              FaceIndex faceIndex )
+: path( path ),
+  requestedPointSize( requestedPointSize ),
+  faceIndex( faceIndex )
+{
+}
+
+bool FontClient::Plugin::FontFaceKey::operator==( const FontFaceKey& rhs ) const
+{
+  return ( requestedPointSize == rhs.requestedPointSize ) &&
+         ( faceIndex == rhs.faceIndex ) &&
+         ( path == rhs.path );
+}
+
+std::size_t FontClient::Plugin::FontFaceKeyHash::operator()( const FontFaceKey& key ) const
+{
+  std::size_t seed = std::hash<std::string>()( key.path );
+  HashCombine( seed, key.requestedPointSize );
+  HashCombine( seed, key.faceIndex );
+  return seed;
+}
+
+FontClient::Plugin::FontDescriptionKey::FontDescriptionKey( const FontDescription& fontDescription )
+: family( fontDescription.family ),
+  width( fontDescription.width ),
+  weight( fontDescription.weight ),
+  slant( fontDescription.slant )
+{
+}
+
+bool FontClient::Plugin::FontDescriptionKey::operator==( const FontDescriptionKey& rhs ) const
+{
+  return ( width == rhs.width ) &&
+         ( weight == rhs.weight ) &&
+         ( slant == rhs.slant ) &&
+         ( family == rhs.family );
+}
+
+std::size_t FontClient::Plugin::FontDescriptionKeyHash::operator()( const FontDescriptionKey& key ) const
+{
+  std::size_t seed = std::hash<std::string>()( key.family );
+  HashCombine( seed, key.width );
+  HashCombine( seed, key.weight );
+  HashCombine( seed, key.slant );
+  return seed;
+}
+
 FontClient::Plugin::FontFaceCacheItem::FontFaceCacheItem( FT_Face ftFace,
                                                           const FontPath& path,
                                                           PointSize26Dot6 requestedPointSize,
@@ -246,9 +331,19 @@ FontClient::Plugin::Plugin( unsigned int horizontalDpi,
   mFontDescriptionCache(),
   mCharacterSetCache(),
   mFontDescriptionSizeCache(),
+  mFontFaceCacheIndex(),
+  mValidatedFontCacheIndex(),
+  mFallbackCacheIndex(),
+  mFontDescriptionSizeCacheIndex(),
+  mBitmapFontCacheIndex(),
+  mCharacterCoverageCache(),
   mVectorFontCache( nullptr ),
   mEllipsisCache(),
   mEmbeddedItemCache(),
+  mFontCatalog(),
+  mFontCatalogPath( FontCatalog::GetDefaultPath() ),
+  mGlyphBitmapCache( GetGlyphBitmapCacheBudget() ),
+  mStatisticsLog(),
   mDefaultFontDescriptionCached( false )
 {
   int error = FT_Init_FreeType( &mFreeTypeLibrary );
@@ -257,6 +352,11 @@ FontClient::Plugin::Plugin( unsigned int horizontalDpi,
     DALI_LOG_INFO( gLogFilter, Debug::General, "FreeType Init error: %d\n", error );
   }
 
+  if( !mFontCatalogPath.empty() )
+  {
+    mFontCatalog.Load( mFontCatalogPath );
+  }
+
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
   mVectorFontCache = new VectorFontCache( mFreeTypeLibrary );
 #endif
@@ -264,6 +364,8 @@ FontClient::Plugin::Plugin( unsigned int horizontalDpi,
 
 FontClient::Plugin::~Plugin()
 {
+  SaveFontCatalog();
+
   ClearFallbackCache( mFallbackCache );
 
   // Free the resources allocated by the FcCharSet objects.
@@ -289,26 +391,41 @@ void FontClient::Plugin::ClearCache()
 
   ClearFallbackCache( mFallbackCache );
   mFallbackCache.clear();
+  mFallbackCacheIndex.clear();
 
   mFontIdCache.Clear();
 
+  // The font identifiers are given again from one.
+  mGlyphBitmapCache.Clear();
+
   ClearCharacterSetFromFontFaceCache();
   mFontFaceCache.clear();
+  mFontFaceCacheIndex.clear();
 
   mValidatedFontCache.clear();
+  mValidatedFontCacheIndex.clear();
   mFontDescriptionCache.clear();
 
   DestroyCharacterSets( mCharacterSetCache );
   mCharacterSetCache.Clear();
 
   mFontDescriptionSizeCache.clear();
+  mFontDescriptionSizeCacheIndex.clear();
 
   mEllipsisCache.Clear();
   mPixelBufferCache.clear();
   mEmbeddedItemCache.Clear();
   mBitmapFontCache.clear();
+  mBitmapFontCacheIndex.clear();
 
   mDefaultFontDescriptionCached = false;
+
+  // The cache is cleared when the locale changes, which changes the order of the fallback fonts.
+  if( !mFontCatalogPath.empty() )
+  {
+    SaveFontCatalog();
+    mFontCatalog.Load( mFontCatalogPath );
+  }
 }
 
 void FontClient::Plugin::SetDpi( unsigned int horizontalDpi,
@@ -333,6 +450,14 @@ void FontClient::Plugin::SetFontList( const FontDescription& fontDescription, Fo
 
   fontList.clear();
 
+  // Sorting all the fonts is slow, check first whether the list has been saved by a previous run.
+  if( !mFontCatalogPath.empty() && mFontCatalog.GetFontList( fontDescription, fontList, characterSetList ) )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "  number of fonts in the catalog : [%d]\n", fontList.size() );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::SetFontList\n" );
+    return;
+  }
+
   FcPattern* fontFamilyPattern = CreateFontFamilyPattern( fontDescription ); // Creates a pattern that needs to be destroyed by calling FcPatternDestroy.
 
   FcResult result = FcResultMatch;
@@ -401,6 +526,11 @@ void FontClient::Plugin::SetFontList( const FontDescription& fontDescription, Fo
   // Destroys the pattern created by FcPatternCreate in CreateFontFamilyPattern.
   FcPatternDestroy( fontFamilyPattern );
 
+  if( !mFontCatalogPath.empty() )
+  {
+    mFontCatalog.AddFontList( fontDescription, fontList, characterSetList );
+  }
+
   DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::SetFontList\n" );
 }
 
@@ -669,7 +799,7 @@ bool FontClient::Plugin::IsCharacterSupportedByFont( FontId fontId, Character ch
           cacheItem.mCharacterSet = FcCharSetCopy( CreateCharacterSetFromDescription( description ) );
         }
 
-        isSupported = FcCharSetHasChar( cacheItem.mCharacterSet, character );
+        isSupported = GetCharacterCoverage( cacheItem.mCharacterSet ).Contains( character );
       }
       break;
     }
@@ -702,7 +832,8 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
                                                  const CharacterSetList& characterSetList,
                                                  Character character,
                                                  PointSize26Dot6 requestedPointSize,
-                                                 bool preferColor )
+                                                 bool preferColor,
+                                                 FontId* fontIds )
 {
   DALI_ASSERT_DEBUG( ( fontList.size() == characterSetList.Count() ) && "FontClient::Plugin::FindFontForCharacter. Different number of fonts and character sets." );
 
@@ -732,14 +863,25 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
     bool foundInRanges = false;
     if( nullptr != characterSet )
     {
-      foundInRanges = FcCharSetHasChar( characterSet, character );
+      foundInRanges = GetCharacterCoverage( characterSet ).Contains( character );
     }
 
     if( foundInRanges )
     {
-      fontId = GetFontId( description,
-                          requestedPointSize,
-                          0u );
+      if( ( nullptr != fontIds ) && ( 0u != fontIds[index] ) )
+      {
+        fontId = fontIds[index];
+      }
+      else
+      {
+        fontId = GetFontId( description,
+                            requestedPointSize,
+                            0u );
+        if( nullptr != fontIds )
+        {
+          fontIds[index] = fontId;
+        }
+      }
 
       DALI_LOG_INFO( gLogFilter, Debug::Verbose, "     font id : %d\n", fontId );
 
@@ -796,7 +938,7 @@ FontId FontClient::Plugin::FindDefaultFont( Character charcode,
 
   // Traverse the list of default fonts.
   // Check for each default font if supports the character.
-  fontId = FindFontForCharacter( mDefaultFonts, mDefaultFontCharacterSets, charcode, requestedPointSize, preferColor );
+  fontId = FindFontForCharacter( mDefaultFonts, mDefaultFontCharacterSets, charcode, requestedPointSize, preferColor, nullptr );
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
   DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindDefaultFont\n" );
@@ -817,43 +959,62 @@ FontId FontClient::Plugin::FindFallbackFont( Character charcode,
   // The font id to be returned.
   FontId fontId = 0u;
 
-  FontDescription fontDescription;
-
-  // Fill the font description with the preferred font description and complete with the defaults.
-  fontDescription.family = preferredFontDescription.family.empty() ? DEFAULT_FONT_FAMILY_NAME : preferredFontDescription.family;
-  fontDescription.weight = ( ( FontWeight::NONE == preferredFontDescription.weight ) ? IntToWeightType( DEFAULT_FONT_WEIGHT ) : preferredFontDescription.weight );
-  fontDescription.width = ( ( FontWidth::NONE == preferredFontDescription.width ) ? IntToWidthType( DEFAULT_FONT_WIDTH ) : preferredFontDescription.width );
-  fontDescription.slant = ( ( FontSlant::NONE == preferredFontDescription.slant ) ? IntToSlantType( DEFAULT_FONT_SLANT ) : preferredFontDescription.slant );
-
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  preferredFontDescription --> fontDescription\n" );
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  [%s] --> [%s]\n", preferredFontDescription.family.c_str(), fontDescription.family.c_str() );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWeight::Name[preferredFontDescription.weight], FontWeight::Name[fontDescription.weight] );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWidth::Name[preferredFontDescription.width], FontWidth::Name[fontDescription.width] );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontSlant::Name[preferredFontDescription.slant], FontSlant::Name[fontDescription.slant] );
-
-  // Check first if the font's description has been queried before.
   FontList* fontList = nullptr;
   CharacterSetList* characterSetList = nullptr;
+  GetFallbackFontList( preferredFontDescription, fontList, characterSetList );
 
-  if( !FindFallbackFontList( fontDescription, fontList, characterSetList ) )
+  if( fontList && characterSetList )
   {
-    fontList = new FontList;
-    characterSetList = new CharacterSetList;
+    fontId = FindFontForCharacter( *fontList, *characterSetList, charcode, requestedPointSize, preferColor, nullptr );
+  }
 
-    SetFontList( fontDescription, *fontList, *characterSetList );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFont\n");
+  return fontId;
+}
 
-    // Add the font-list to the cache.
-    mFallbackCache.push_back( std::move( FallbackCacheItem( std::move( fontDescription ), fontList, characterSetList ) ) );
+void FontClient::Plugin::FindFallbackFonts( const Character* const text,
+                                            Length numberOfCharacters,
+                                            const FontDescription& preferredFontDescription,
+                                            PointSize26Dot6 requestedPointSize,
+                                            bool preferColor,
+                                            Vector<FontId>& fontIds )
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "-->FontClient::Plugin::FindFallbackFonts\n" );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  number of characters : %d\n", numberOfCharacters );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "    requestedPointSize : %d\n", requestedPointSize );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "           preferColor : %s\n", ( preferColor ? "true" : "false" ) );
+
+  fontIds.Clear();
+  fontIds.Resize( numberOfCharacters, 0u );
+
+  FontList* fontList = nullptr;
+  CharacterSetList* characterSetList = nullptr;
+  if( numberOfCharacters > 0u )
+  {
+    GetFallbackFontList( preferredFontDescription, fontList, characterSetList );
   }
 
   if( fontList && characterSetList )
   {
-    fontId = FindFontForCharacter( *fontList, *characterSetList, charcode, requestedPointSize, preferColor );
+    // The font list is retrieved once and each of its fonts is opened once for the whole text.
+    std::vector<FontId> listFontIds( fontList->size(), 0u );
+
+    Character previousCharacter = 0u;
+    FontId previousFontId = 0u;
+    for( Length index = 0u; index < numberOfCharacters; ++index )
+    {
+      const Character character = text[index];
+      if( ( index == 0u ) || ( character != previousCharacter ) )
+      {
+        previousFontId = FindFontForCharacter( *fontList, *characterSetList, character, requestedPointSize, preferColor, listFontIds.data() );
+        previousCharacter = character;
+      }
+      fontIds[index] = previousFontId;
+    }
   }
 
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
-  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFont\n");
-  return fontId;
+  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFonts\n" );
 }
 
 FontId FontClient::Plugin::GetFontId( const FontPath& path,
@@ -953,9 +1114,7 @@ FontId FontClient::Plugin::GetFontId( const FontDescription& fontDescription,
     mFontFaceCache[fontFaceId].mCharacterSet = FcCharSetCopy( mCharacterSetCache[validatedFontId - 1u] );
 
     // Cache the pair 'validatedFontId, requestedPointSize' to improve the following queries.
-    mFontDescriptionSizeCache.push_back( FontDescriptionSizeCacheItem( validatedFontId,
-                                                                       requestedPointSize,
-                                                                       fontFaceId ) );
+    CacheFontDescriptionSize( validatedFontId, requestedPointSize, fontFaceId );
   }
   else
   {
@@ -970,12 +1129,10 @@ FontId FontClient::Plugin::GetFontId( const FontDescription& fontDescription,
 
 FontId FontClient::Plugin::GetFontId( const BitmapFont& bitmapFont )
 {
-  for( const auto& item : mBitmapFontCache )
+  FontId fontId = 0u;
+  if( FindBitmapFont( bitmapFont.name, fontId ) )
   {
-    if( bitmapFont.name == item.font.name )
-    {
-      return item.id + 1u;
-    }
+    return fontId;
   }
 
   BitmapFontCacheItem bitmapFontCacheItem;
@@ -1012,6 +1169,7 @@ FontId FontClient::Plugin::GetFontId( const BitmapFont& bitmapFont )
   fontIdCacheItem.type = FontDescription::BITMAP_FONT;
   fontIdCacheItem.id = mBitmapFontCache.size();
 
+  mBitmapFontCacheIndex.emplace( bitmapFontCacheItem.font.name, bitmapFontCacheItem.id + 1u );
   mBitmapFontCache.push_back( std::move( bitmapFontCacheItem ) );
   mFontIdCache.PushBack( fontIdCacheItem );
 
@@ -1028,14 +1186,24 @@ void FontClient::Plugin::ValidateFont( const FontDescription& fontDescription,
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "               weight : [%s]\n", FontWeight::Name[fontDescription.weight] );
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "                slant : [%s]\n\n", FontSlant::Name[fontDescription.slant] );
 
-  // Create a font pattern.
-  FcPattern* fontFamilyPattern = CreateFontFamilyPattern( fontDescription );
-
   FontDescription description;
 
   FcCharSet* characterSet = nullptr;
-  bool matched = MatchFontDescriptionToPattern( fontFamilyPattern, description, &characterSet );
-  FcPatternDestroy( fontFamilyPattern );
+  bool matched = !mFontCatalogPath.empty() && mFontCatalog.GetMatch( fontDescription, description, &characterSet );
+  if( !matched )
+  {
+    // Create a font pattern.
+    FcPattern* fontFamilyPattern = CreateFontFamilyPattern( fontDescription );
+
+    matched = MatchFontDescriptionToPattern( fontFamilyPattern, description, &characterSet );
+    FcPatternDestroy( fontFamilyPattern );
+
+    // Saved with the next font list or when the font client is destroyed.
+    if( matched && ( nullptr != characterSet ) && !mFontCatalogPath.empty() )
+    {
+      mFontCatalog.AddMatch( fontDescription, description, characterSet );
+    }
+  }
 
   if( matched && ( nullptr != characterSet ) )
   {
@@ -1057,10 +1225,7 @@ void FontClient::Plugin::ValidateFont( const FontDescription& fontDescription,
     mCharacterSetCache.PushBack( characterSet );
 
     // Cache the index and the matched font's description.
-    FontDescriptionCacheItem item( description,
-                                   validatedFontId );
-
-    mValidatedFontCache.push_back( std::move( item ) );
+    CacheValidatedFont( description, validatedFontId );
 
     if( ( fontDescription.family != description.family ) ||
         ( fontDescription.width != description.width )   ||
@@ -1068,10 +1233,7 @@ void FontClient::Plugin::ValidateFont( const FontDescription& fontDescription,
         ( fontDescription.slant != description.slant ) )
     {
       // Cache the given font's description if it's different than the matched.
-      FontDescriptionCacheItem item( fontDescription,
-                                     validatedFontId );
-
-      mValidatedFontCache.push_back( std::move( item ) );
+      CacheValidatedFont( fontDescription, validatedFontId );
     }
   }
   else
@@ -1423,10 +1585,22 @@ void FontClient::Plugin::CreateBitmap( FontId fontId, GlyphIndex glyphIndex, boo
     {
       case FontDescription::FACE_FONT:
       {
+        LogGlyphBitmapCacheStatistics();
+
+        const FontFaceCacheItem& fontFaceCacheItem = mFontFaceCache[fontIdCacheItem.id];
+
+        // The bitmaps of the fixed size fonts are downscaled to the size requested by the caller.
+        const ImageDimensions requestedSize = fontFaceCacheItem.mIsFixedSizeBitmap ? ImageDimensions( data.width, data.height ) : ImageDimensions();
+
+        // Relayouts render the same glyphs again.
+        if( mGlyphBitmapCache.Find( fontId, glyphIndex, outlineWidth, isItalicRequired, isBoldRequired, requestedSize, data ) )
+        {
+          break;
+        }
+
         // For the software italics.
         bool isShearRequired = false;
 
-        const FontFaceCacheItem& fontFaceCacheItem = mFontFaceCache[fontIdCacheItem.id];
         FT_Face ftFace = fontFaceCacheItem.mFreeTypeFace;
 
         FT_Error error;
@@ -1553,6 +1727,8 @@ void FontClient::Plugin::CreateBitmap( FontId fontId, GlyphIndex glyphIndex, boo
         {
           DALI_LOG_INFO( gLogFilter, Debug::General, "FontClient::Plugin::CreateBitmap. FT_Load_Glyph Failed with error: %d\n", error );
         }
+
+        mGlyphBitmapCache.Add( fontId, glyphIndex, outlineWidth, isItalicRequired, isBoldRequired, requestedSize, data );
         break;
       }
       case FontDescription::BITMAP_FONT:
@@ -1778,6 +1954,11 @@ FontDescription::Type FontClient::Plugin::GetFontType( FontId fontId )
 
 bool FontClient::Plugin::AddCustomFontDirectory( const FontPath& path )
 {
+  // The catalog is shared by all the applications, so it can't hold the fonts of a single one.
+  SaveFontCatalog();
+  mFontCatalog.Clear();
+  mFontCatalogPath.clear();
+
   // nullptr as first parameter means the current configuration is used.
   return FcConfigAppFontAddDir( nullptr, reinterpret_cast<const FcChar8 *>( path.c_str() ) );
 }
@@ -1875,6 +2056,13 @@ void FontClient::Plugin::InitSystemFonts()
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "-->FontClient::Plugin::InitSystemFonts\n" );
 
+  if( !mFontCatalogPath.empty() && mFontCatalog.GetSystemFonts( mSystemFonts ) )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "  number of system fonts in the catalog : %d\n", mSystemFonts.size() );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::InitSystemFonts\n" );
+    return;
+  }
+
   FcFontSet* fontSet = GetFcFontSet(); // Creates a FcFontSet that needs to be destroyed by calling FcFontSetDestroy.
 
   if( fontSet )
@@ -1919,6 +2107,11 @@ void FontClient::Plugin::InitSystemFonts()
 
     // Destroys the font set created.
     FcFontSetDestroy( fontSet );
+
+    if( !mFontCatalogPath.empty() )
+    {
+      mFontCatalog.SetSystemFonts( mSystemFonts );
+    }
   }
   DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::InitSystemFonts\n" );
 }
@@ -2177,7 +2370,7 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
         fontFaceId = fontIdCacheItem.id + 1u;
 
         // Cache the items.
-        mFontFaceCache.push_back( fontFaceCacheItem );
+        CacheFontFace( fontFaceCacheItem );
         mFontIdCache.PushBack( fontIdCacheItem );
 
         // Set the font id to be returned.
@@ -2218,7 +2411,7 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
         fontFaceId = fontIdCacheItem.id + 1u;
 
         // Cache the items.
-        mFontFaceCache.push_back( fontFaceCacheItem );
+        CacheFontFace( fontFaceCacheItem );
         mFontIdCache.PushBack( fontIdCacheItem );
 
         // Set the font id to be returned.
@@ -2392,19 +2585,15 @@ bool FontClient::Plugin::FindFont( const FontPath& path,
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  number of fonts in the cache : %d\n", mFontFaceCache.size() );
 
   fontId = 0u;
-  for( const auto& cacheItem : mFontFaceCache )
+  const auto iter = mFontFaceCacheIndex.find( FontFaceKey( path, requestedPointSize, faceIndex ) );
+  if( iter != mFontFaceCacheIndex.end() )
   {
-    if( cacheItem.mRequestedPointSize == requestedPointSize &&
-        cacheItem.mFaceIndex == faceIndex &&
-        cacheItem.mPath == path )
-    {
-      fontId = cacheItem.mFontId + 1u;
+    fontId = iter->second;
 
-      DALI_LOG_INFO( gLogFilter, Debug::General, "  font found, id : %d\n", fontId );
-      DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFont\n" );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "  font found, id : %d\n", fontId );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFont\n" );
 
-      return true;
-    }
+    return true;
   }
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "  font not found\n" );
@@ -2426,15 +2615,12 @@ bool FontClient::Plugin::FindValidatedFont( const FontDescription& fontDescripti
 
   validatedFontId = 0u;
 
-  for( const auto& item : mValidatedFontCache )
+  if( !fontDescription.family.empty() )
   {
-    if( !fontDescription.family.empty() &&
-        ( fontDescription.family == item.fontDescription.family ) &&
-        ( fontDescription.width == item.fontDescription.width ) &&
-        ( fontDescription.weight == item.fontDescription.weight ) &&
-        ( fontDescription.slant == item.fontDescription.slant ) )
+    const auto iter = mValidatedFontCacheIndex.find( FontDescriptionKey( fontDescription ) );
+    if( iter != mValidatedFontCacheIndex.end() )
     {
-      validatedFontId = item.index;
+      validatedFontId = iter->second;
 
       DALI_LOG_INFO( gLogFilter, Debug::General, "  validated font found, id : %d\n", validatedFontId );
       DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindValidatedFont\n" );
@@ -2447,6 +2633,50 @@ bool FontClient::Plugin::FindValidatedFont( const FontDescription& fontDescripti
   return false;
 }
 
+void FontClient::Plugin::GetFallbackFontList( const FontDescription& preferredFontDescription,
+                                              FontList*& fontList,
+                                              CharacterSetList*& characterSetList )
+{
+  FontDescription fontDescription;
+
+  // Fill the font description with the preferred font description and complete with the defaults.
+  fontDescription.family = preferredFontDescription.family.empty() ? DEFAULT_FONT_FAMILY_NAME : preferredFontDescription.family;
+  fontDescription.weight = ( ( FontWeight::NONE == preferredFontDescription.weight ) ? IntToWeightType( DEFAULT_FONT_WEIGHT ) : preferredFontDescription.weight );
+  fontDescription.width = ( ( FontWidth::NONE == preferredFontDescription.width ) ? IntToWidthType( DEFAULT_FONT_WIDTH ) : preferredFontDescription.width );
+  fontDescription.slant = ( ( FontSlant::NONE == preferredFontDescription.slant ) ? IntToSlantType( DEFAULT_FONT_SLANT ) : preferredFontDescription.slant );
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  preferredFontDescription --> fontDescription\n" );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  [%s] --> [%s]\n", preferredFontDescription.family.c_str(), fontDescription.family.c_str() );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWeight::Name[preferredFontDescription.weight], FontWeight::Name[fontDescription.weight] );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWidth::Name[preferredFontDescription.width], FontWidth::Name[fontDescription.width] );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontSlant::Name[preferredFontDescription.slant], FontSlant::Name[fontDescription.slant] );
+
+  // Check first if the font's description has been queried before.
+  fontList = nullptr;
+  characterSetList = nullptr;
+
+  if( !FindFallbackFontList( fontDescription, fontList, characterSetList ) )
+  {
+    fontList = new FontList;
+    characterSetList = new CharacterSetList;
+
+    SetFontList( fontDescription, *fontList, *characterSetList );
+
+    // Add the font-list to the cache.
+    CacheFallbackFontList( std::move( fontDescription ), fontList, characterSetList );
+  }
+}
+
+const CharacterCoverage& FontClient::Plugin::GetCharacterCoverage( const _FcCharSet* characterSet )
+{
+  auto it = mCharacterCoverageCache.find( characterSet );
+  if( it == mCharacterCoverageCache.end() )
+  {
+    it = mCharacterCoverageCache.emplace( characterSet, CharacterCoverage( characterSet ) ).first;
+  }
+  return it->second;
+}
+
 bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescription,
                                                FontList*& fontList,
                                                CharacterSetList*& characterSetList )
@@ -2461,14 +2691,12 @@ bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescri
 
   fontList = nullptr;
 
-  for( const auto& item : mFallbackCache )
+  if( !fontDescription.family.empty() )
   {
-    if( !fontDescription.family.empty() &&
-        ( fontDescription.family == item.fontDescription.family ) &&
-        ( fontDescription.width == item.fontDescription.width ) &&
-        ( fontDescription.weight == item.fontDescription.weight ) &&
-        ( fontDescription.slant == item.fontDescription.slant ) )
+    const auto iter = mFallbackCacheIndex.find( FontDescriptionKey( fontDescription ) );
+    if( iter != mFallbackCacheIndex.end() )
     {
+      const FallbackCacheItem& item = mFallbackCache[iter->second];
       fontList = item.fallbackFonts;
       characterSetList = item.characterSets;
 
@@ -2493,17 +2721,14 @@ bool FontClient::Plugin::FindFont( FontDescriptionId validatedFontId,
 
   fontId = 0u;
 
-  for( const auto& item : mFontDescriptionSizeCache )
+  const auto iter = mFontDescriptionSizeCacheIndex.find( MakeFontDescriptionSizeKey( validatedFontId, requestedPointSize ) );
+  if( iter != mFontDescriptionSizeCacheIndex.end() )
   {
-    if( ( validatedFontId == item.validatedFontId ) &&
-        ( requestedPointSize == item.requestedPointSize ) )
-    {
-      fontId = item.fontId;
+    fontId = iter->second;
 
-      DALI_LOG_INFO( gLogFilter, Debug::General, "  font found, id : %d\n", fontId );
-      DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFont\n" );
-      return true;
-    }
+    DALI_LOG_INFO( gLogFilter, Debug::General, "  font found, id : %d\n", fontId );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFont\n" );
+    return true;
   }
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "  font not found.\n" );
@@ -2515,13 +2740,11 @@ bool FontClient::Plugin::FindBitmapFont( const FontFamily& bitmapFont, FontId& f
 {
   fontId = 0u;
 
-  for( const auto& item : mBitmapFontCache )
+  const auto iter = mBitmapFontCacheIndex.find( bitmapFont );
+  if( iter != mBitmapFontCacheIndex.end() )
   {
-    if( bitmapFont == item.font.name )
-    {
-      fontId = item.id + 1u;
-      return true;
-    }
+    fontId = iter->second;
+    return true;
   }
 
   return false;
@@ -2706,16 +2929,38 @@ void FontClient::Plugin::CacheFontPath( FT_Face ftFace, FontId id, PointSize26Do
     mCharacterSetCache.PushBack( FcCharSetCopy( characterSet ) );
 
     // Cache the index and the font's description.
-    mValidatedFontCache.push_back( std::move( FontDescriptionCacheItem( std::move( description ),
-                                                                        validatedFontId) ) );
+    CacheValidatedFont( description, validatedFontId );
 
     // Cache the pair 'validatedFontId, requestedPointSize' to improve the following queries.
-    mFontDescriptionSizeCache.push_back( FontDescriptionSizeCacheItem( validatedFontId,
-                                                                       requestedPointSize,
-                                                                       fontFaceId ) );
+    CacheFontDescriptionSize( validatedFontId, requestedPointSize, fontFaceId );
   }
 }
 
+void FontClient::Plugin::CacheFontFace( const FontFaceCacheItem& fontFaceCacheItem )
+{
+  mFontFaceCacheIndex.emplace( FontFaceKey( fontFaceCacheItem.mPath, fontFaceCacheItem.mRequestedPointSize, fontFaceCacheItem.mFaceIndex ),
+                               fontFaceCacheItem.mFontId + 1u );
+  mFontFaceCache.push_back( fontFaceCacheItem );
+}
+
+void FontClient::Plugin::CacheValidatedFont( const FontDescription& fontDescription, FontDescriptionId validatedFontId )
+{
+  mValidatedFontCacheIndex.emplace( FontDescriptionKey( fontDescription ), validatedFontId );
+  mValidatedFontCache.push_back( FontDescriptionCacheItem( fontDescription, validatedFontId ) );
+}
+
+void FontClient::Plugin::CacheFallbackFontList( FontDescription&& fontDescription, FontList* fontList, CharacterSetList* characterSetList )
+{
+  mFallbackCacheIndex.emplace( FontDescriptionKey( fontDescription ), mFallbackCache.size() );
+  mFallbackCache.push_back( FallbackCacheItem( std::move( fontDescription ), fontList, characterSetList ) );
+}
+
+void FontClient::Plugin::CacheFontDescriptionSize( FontDescriptionId validatedFontId, PointSize26Dot6 requestedPointSize, FontId fontId )
+{
+  mFontDescriptionSizeCacheIndex.emplace( MakeFontDescriptionSizeKey( validatedFontId, requestedPointSize ), fontId );
+  mFontDescriptionSizeCache.push_back( FontDescriptionSizeCacheItem( validatedFontId, requestedPointSize, fontId ) );
+}
+
 FcCharSet* FontClient::Plugin::CreateCharacterSetFromDescription( const FontDescription& description )
 {
   FcCharSet* characterSet = nullptr;
@@ -2762,6 +3007,44 @@ void FontClient::Plugin::ClearCharacterSetFromFontFaceCache()
     FcCharSetDestroy( item.mCharacterSet );
     item.mCharacterSet = nullptr;
   }
+
+  // This is called whenever the character sets of the font lists are destroyed too. The coverages are
+  // indexed by the address of the character set, which may be reused by a new one.
+  mCharacterCoverageCache.clear();
+}
+
+void FontClient::Plugin::SaveFontCatalog()
+{
+  if( !mFontCatalogPath.empty() && mFontCatalog.IsModified() )
+  {
+    mFontCatalog.Save( mFontCatalogPath );
+  }
+}
+
+void FontClient::Plugin::LogGlyphBitmapCacheStatistics()
+{
+  Dali::Internal::Adaptor::PerformanceInterface* performanceInterface = Dali::Internal::Adaptor::StatisticsLog::GetAdaptorPerformanceInterface();
+  if( !mStatisticsLog.IsDue( performanceInterface ) )
+  {
+    return;
+  }
+
+  GlyphBitmapCache::Statistics statistics;
+  mGlyphBitmapCache.GetStatistics( statistics );
+  mGlyphBitmapCache.ResetStatistics();
+
+  const uint32_t lookups = statistics.hits + statistics.misses;
+  char logBuffer[STATISTICS_LOG_SIZE];
+  snprintf( logBuffer, STATISTICS_LOG_SIZE, "GlyphBitmapCache, hits %u, misses %u, hit rate %0.1f%%, evictions %u, entries %u, size %zu / %zu bytes (%zu decoded)\n",
+            statistics.hits,
+            statistics.misses,
+            lookups > 0u ? 100.f * static_cast<float>( statistics.hits ) / static_cast<float>( lookups ) : 0.f,
+            statistics.evictions,
+            statistics.entries,
+            statistics.bytes,
+            mGlyphBitmapCache.GetMemoryBudget(),
+            statistics.uncompressedBytes );
+  performanceInterface->LogStatistics( logBuffer );
 }
 
 } // namespace Internal
@@ -22,7 +22,11 @@
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-metrics.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
+#include <dali/internal/text/text-abstraction/character-coverage.h>
+#include <dali/internal/text/text-abstraction/font-catalog.h>
 #include <dali/internal/text/text-abstraction/font-client-impl.h>
+#include <dali/internal/text/text-abstraction/glyph-bitmap-cache.h>
+#include <dali/internal/system/common/statistics-log.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
@@ -32,6 +36,7 @@ class VectorFontCache;
 #endif
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
@@ -63,11 +68,6 @@ typedef uint32_t FontDescriptionId;
  */
 typedef uint32_t PixelBufferId;
 
-/**
- * @brief Vector of character sets.
- */
-typedef Vector<_FcCharSet*> CharacterSetList;
-
 /**
  * @brief FontClient implementation.
  */
@@ -190,6 +190,45 @@ struct FontClient::Plugin
     FontId id;                                    ///< Index to the vector with the cache of font's ids.
   };
 
+  /**
+   * @brief The key of the index of the font face cache: the triplet 'path to the font file name, font point size and face index'.
+   */
+  struct FontFaceKey
+  {
+    FontFaceKey( const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex );
+
+    bool operator==( const FontFaceKey& rhs ) const;
+
+    FontPath        path;               ///< The path to the font file name.
+    PointSize26Dot6 requestedPointSize; ///< The font point size.
+    FaceIndex       faceIndex;          ///< The face index.
+  };
+
+  struct FontFaceKeyHash
+  {
+    std::size_t operator()( const FontFaceKey& key ) const;
+  };
+
+  /**
+   * @brief The key of the indices of the validated font and fallback caches: the cluster 'font family, font width, font weight, font slant'.
+   */
+  struct FontDescriptionKey
+  {
+    explicit FontDescriptionKey( const FontDescription& fontDescription );
+
+    bool operator==( const FontDescriptionKey& rhs ) const;
+
+    FontFamily       family; ///< The font family name.
+    FontWidth::Type  width;  ///< The font width.
+    FontWeight::Type weight; ///< The font weight.
+    FontSlant::Type  slant;  ///< The font slant.
+  };
+
+  struct FontDescriptionKeyHash
+  {
+    std::size_t operator()( const FontDescriptionKey& key ) const;
+  };
+
   /**
    * Constructor.
    *
@@ -266,6 +305,8 @@ struct FontClient::Plugin
    * @param[in] charcode The character for which a font is needed.
    * @param[in] requestedPointSize The point size in 26.6 fractional points.
    * @param[in] preferColor @e true if a color font is preferred.
+   * @param[in,out] fontIds The identifiers of the fonts of the list already retrieved, or zero, to be reused when looking for
+   * several characters. There is one per font of the list. It may be nullptr.
    *
    * @return A valid font identifier, or zero if no font is found.
    */
@@ -273,7 +314,8 @@ struct FontClient::Plugin
                                const CharacterSetList& characterSetList,
                                Character charcode,
                                PointSize26Dot6 requestedPointSize,
-                               bool preferColor );
+                               bool preferColor,
+                               FontId* fontIds );
 
   /**
    * @copydoc Dali::TextAbstraction::FontClient::FindDefaultFont()
@@ -290,6 +332,16 @@ struct FontClient::Plugin
                            PointSize26Dot6 requestedPointSize,
                            bool preferColor );
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::FindFallbackFonts()
+   */
+  void FindFallbackFonts( const Character* const text,
+                          Length numberOfCharacters,
+                          const FontDescription& preferredFontDescription,
+                          PointSize26Dot6 requestedPointSize,
+                          bool preferColor,
+                          Vector<FontId>& fontIds );
+
   /**
    * @see Dali::TextAbstraction::FontClient::GetFontId( const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex )
    *
@@ -541,6 +593,28 @@ private:
                              FontList*& fontList,
                              CharacterSetList*& characterSetList );
 
+  /**
+   * @brief Retrieves the fallback font list of a font description, creating it if it's not cached.
+   *
+   * The description is completed with the default family, weight, width and slant.
+   *
+   * @param[in] preferredFontDescription The font description.
+   * @param[out] fontList A valid pointer to a font list, or @e nullptr if the list couldn't be created.
+   * @param[out] characterSetList A valid pointer to a character set list, or @e nullptr if the list couldn't be created.
+   */
+  void GetFallbackFontList( const FontDescription& preferredFontDescription,
+                            FontList*& fontList,
+                            CharacterSetList*& characterSetList );
+
+  /**
+   * @brief Retrieves the coverage of a character set, creating it the first time.
+   *
+   * @param[in] characterSet The character set.
+   *
+   * @return The coverage. It's valid until the character sets are cleared.
+   */
+  const CharacterCoverage& GetCharacterCoverage( const _FcCharSet* characterSet );
+
   /**
    * @brief Finds in the cache a pair 'validated font identifier and font point size'.
    * If there is one it writes the font identifier in the param @p fontId.
@@ -595,6 +669,39 @@ private:
    */
   void CacheFontPath( FT_Face ftFace, FontId id, PointSize26Dot6 requestedPointSize,  const FontPath& path );
 
+  /**
+   * @brief Adds a FreeType face to the font face cache and its index.
+   *
+   * @param[in] fontFaceCacheItem The face. Its mFontId must be set.
+   */
+  void CacheFontFace( const FontFaceCacheItem& fontFaceCacheItem );
+
+  /**
+   * @brief Adds a font description to the validated font cache and its index.
+   *
+   * @param[in] fontDescription The font description.
+   * @param[in] validatedFontId Index to the vector with font descriptions.
+   */
+  void CacheValidatedFont( const FontDescription& fontDescription, FontDescriptionId validatedFontId );
+
+  /**
+   * @brief Adds a fallback font list to the fallback cache and its index.
+   *
+   * @param[in] fontDescription The font description the list is for.
+   * @param[in] fontList The list of fallback fonts. The cache takes its ownership.
+   * @param[in] characterSetList The character sets of the fallback fonts. The cache takes its ownership.
+   */
+  void CacheFallbackFontList( FontDescription&& fontDescription, FontList* fontList, CharacterSetList* characterSetList );
+
+  /**
+   * @brief Adds a pair 'validated font identifier and font point size' to the font description size cache and its index.
+   *
+   * @param[in] validatedFontId Index to the vector with font descriptions.
+   * @param[in] requestedPointSize The font point size.
+   * @param[in] fontId The index to the font face cache.
+   */
+  void CacheFontDescriptionSize( FontDescriptionId validatedFontId, PointSize26Dot6 requestedPointSize, FontId fontId );
+
   /**
    * @brief Creates a character set from a given font's @p description.
    *
@@ -614,10 +721,22 @@ private:
   void ClearFallbackCache( std::vector<FallbackCacheItem>& fallbackCache );
 
   /**
-   * @brief Free the resources allocated by the FcCharSet objects.
+   * @brief Free the resources allocated by the FcCharSet objects, and the coverages created from them.
    */
   void ClearCharacterSetFromFontFaceCache();
 
+  /**
+   * @brief Writes the font catalog to disk if entries have been added to it.
+   *
+   * The catalog is only written when the plugin is destroyed or its caches are cleared, so the font queries don't wait for the disk.
+   */
+  void SaveFontCatalog();
+
+  /**
+   * @brief Logs the statistics of the glyph bitmap cache if the performance statistics are enabled.
+   */
+  void LogGlyphBitmapCacheStatistics();
+
 private:
 
   // Declared private and left undefined to avoid copies.
@@ -647,6 +766,15 @@ private:
   CharacterSetList                          mCharacterSetCache;        ///< Caches character set lists for the validated font.
   std::vector<FontDescriptionSizeCacheItem> mFontDescriptionSizeCache; ///< Caches font identifiers for the pairs of font point size and the index to the vector with font descriptions of the validated fonts.
 
+  // Hashed indices of the caches above. A key keeps the first entry added for it, as found by a linear search.
+  std::unordered_map<FontFaceKey, FontId, FontFaceKeyHash>                          mFontFaceCacheIndex;            ///< The font identifiers of mFontFaceCache.
+  std::unordered_map<FontDescriptionKey, FontDescriptionId, FontDescriptionKeyHash> mValidatedFontCacheIndex;       ///< The validated font identifiers of mValidatedFontCache.
+  std::unordered_map<FontDescriptionKey, std::size_t, FontDescriptionKeyHash>       mFallbackCacheIndex;            ///< The positions of the items in mFallbackCache.
+  std::unordered_map<uint64_t, FontId>                                              mFontDescriptionSizeCacheIndex; ///< The font identifiers of mFontDescriptionSizeCache.
+  std::unordered_map<FontFamily, FontId>                                            mBitmapFontCacheIndex;          ///< The font identifiers of mBitmapFontCache by name.
+
+  std::unordered_map<const _FcCharSet*, CharacterCoverage> mCharacterCoverageCache; ///< The coverage of the character sets used to find fonts for characters.
+
   VectorFontCache* mVectorFontCache; ///< Separate cache for vector data blobs etc.
 
   Vector<EllipsisItem> mEllipsisCache;      ///< Caches ellipsis glyphs for a particular point size.
@@ -654,6 +782,12 @@ private:
   Vector<EmbeddedItem> mEmbeddedItemCache; ///< Cache embedded items.
   std::vector<BitmapFontCacheItem> mBitmapFontCache; ///< Stores bitmap fonts.
 
+  FontCatalog mFontCatalog;     ///< The results of the fontconfig queries kept between runs.
+  std::string mFontCatalogPath; ///< The path of the font catalog file, or empty if the catalog is not used.
+
+  GlyphBitmapCache                       mGlyphBitmapCache;      ///< The most recently rasterized glyphs.
+  Dali::Internal::Adaptor::StatisticsLog mStatisticsLog;         ///< Paces the glyph bitmap cache statistics log.
+
   bool mDefaultFontDescriptionCached : 1; ///< Whether the default font is cached or not
 };
 
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/glyph-bitmap-cache.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <iterator>
+
+// INTERNAL INCLUDES
+#include <dali/internal/legacy/tizen/data-compression.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+const size_t ENTRY_OVERHEAD = 128u; ///< Rough size of the list node, the index node and the entry's bookkeeping.
+} // unnamed namespace
+
+std::size_t GlyphBitmapCache::KeyHash::operator()( const Key& key ) const
+{
+  uint64_t hash = static_cast<uint64_t>( key.fontId ) << 32u | key.glyphIndex;
+  hash ^= ( static_cast<uint64_t>( static_cast<uint32_t>( key.outlineWidth ) ) << 2u | ( key.isItalic ? 2u : 0u ) | ( key.isBold ? 1u : 0u ) ) * 0x9e3779b97f4a7c15ull;
+  hash ^= ( static_cast<uint64_t>( key.requestedSize.GetWidth() ) << 16u | key.requestedSize.GetHeight() ) * 0xc2b2ae3d27d4eb4full;
+  return static_cast<std::size_t>( hash ^ ( hash >> 29u ) );
+}
+
+GlyphBitmapCache::GlyphBitmapCache( size_t memoryBudget )
+: mEntries(),
+  mIndex(),
+  mMemoryBudget( memoryBudget ),
+  mBytes( 0u ),
+  mUncompressedBytes( 0u ),
+  mHits( 0u ),
+  mMisses( 0u ),
+  mEvictions( 0u )
+{
+}
+
+void GlyphBitmapCache::SetMemoryBudget( size_t memoryBudget )
+{
+  mMemoryBudget = memoryBudget;
+  Trim();
+}
+
+size_t GlyphBitmapCache::GetMemoryBudget() const
+{
+  return mMemoryBudget;
+}
+
+bool GlyphBitmapCache::Find( FontId fontId, GlyphIndex glyphIndex, int outlineWidth, bool isItalicRequired, bool isBoldRequired, ImageDimensions requestedSize, TextAbstraction::FontClient::GlyphBufferData& data )
+{
+  if( 0u == mMemoryBudget )
+  {
+    return false;
+  }
+
+  const Key key = { fontId, glyphIndex, outlineWidth, isItalicRequired, isBoldRequired, requestedSize };
+  auto indexIter = mIndex.find( key );
+  if( indexIter == mIndex.end() )
+  {
+    ++mMisses;
+    return false;
+  }
+
+  const Entry& entry = *indexIter->second;
+  const size_t bufferSize = entry.width * entry.height * Pixel::GetBytesPerPixel( entry.format );
+
+  data.buffer = new unsigned char[bufferSize]; // @note The caller is responsible for deallocating the bitmap data using delete[].
+  if( entry.isEncoded )
+  {
+    size_t decodedSize = 0u;
+    TizenPlatform::DataCompression::DecodeRle( entry.pixels.data(), entry.pixels.size(), data.buffer, bufferSize, decodedSize );
+  }
+  else if( bufferSize > 0u )
+  {
+    memcpy( data.buffer, entry.pixels.data(), bufferSize );
+  }
+
+  data.width = entry.width;
+  data.height = entry.height;
+  data.outlineOffsetX = entry.outlineOffsetX;
+  data.outlineOffsetY = entry.outlineOffsetY;
+  data.format = entry.format;
+  data.isColorEmoji = entry.isColorEmoji;
+  data.isColorBitmap = entry.isColorBitmap;
+
+  // Move the entry to the front of the list.
+  mEntries.splice( mEntries.begin(), mEntries, indexIter->second );
+  ++mHits;
+  return true;
+}
+
+void GlyphBitmapCache::Add( FontId fontId, GlyphIndex glyphIndex, int outlineWidth, bool isItalicRequired, bool isBoldRequired, ImageDimensions requestedSize, const TextAbstraction::FontClient::GlyphBufferData& data )
+{
+  if( nullptr == data.buffer )
+  {
+    return;
+  }
+
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( data.format );
+  const size_t bufferSize = data.width * data.height * bytesPerPixel;
+  if( ENTRY_OVERHEAD + bufferSize > mMemoryBudget / 4u )
+  {
+    // Big glyphs would evict many small ones; they are cheap to render compared with their number of pixels anyway.
+    return;
+  }
+
+  const Key key = { fontId, glyphIndex, outlineWidth, isItalicRequired, isBoldRequired, requestedSize };
+  auto indexIter = mIndex.find( key );
+  if( indexIter != mIndex.end() )
+  {
+    Remove( indexIter->second );
+  }
+
+  mEntries.push_front( Entry() );
+  Entry& entry = mEntries.front();
+  entry.key = key;
+  entry.width = data.width;
+  entry.height = data.height;
+  entry.outlineOffsetX = data.outlineOffsetX;
+  entry.outlineOffsetY = data.outlineOffsetY;
+  entry.format = data.format;
+  entry.isColorEmoji = data.isColorEmoji;
+  entry.isColorBitmap = data.isColorBitmap;
+  entry.isEncoded = false;
+
+  if( 1u == bytesPerPixel )
+  {
+    // Coverage bitmaps are mostly runs of transparent or opaque pixels.
+    std::vector<unsigned char> encoded( TizenPlatform::DataCompression::GetMaximumRleCompressedSize( bufferSize ) );
+    size_t encodedSize = 0u;
+    TizenPlatform::DataCompression::EncodeRle( data.buffer, bufferSize, encoded.data(), encoded.size(), encodedSize );
+    if( encodedSize < bufferSize )
+    {
+      encoded.resize( encodedSize );
+      encoded.shrink_to_fit();
+      entry.pixels.swap( encoded );
+      entry.isEncoded = true;
+    }
+  }
+
+  if( !entry.isEncoded )
+  {
+    entry.pixels.assign( data.buffer, data.buffer + bufferSize );
+  }
+
+  entry.bytes = ENTRY_OVERHEAD + entry.pixels.size();
+
+  mIndex[key] = mEntries.begin();
+  mBytes += entry.bytes;
+  mUncompressedBytes += ENTRY_OVERHEAD + bufferSize;
+
+  Trim();
+}
+
+void GlyphBitmapCache::Clear()
+{
+  mEntries.clear();
+  mIndex.clear();
+  mBytes = 0u;
+  mUncompressedBytes = 0u;
+}
+
+void GlyphBitmapCache::GetStatistics( Statistics& statistics ) const
+{
+  statistics.hits = mHits;
+  statistics.misses = mMisses;
+  statistics.evictions = mEvictions;
+  statistics.entries = static_cast<uint32_t>( mIndex.size() );
+  statistics.bytes = mBytes;
+  statistics.uncompressedBytes = mUncompressedBytes;
+}
+
+void GlyphBitmapCache::ResetStatistics()
+{
+  mHits = 0u;
+  mMisses = 0u;
+  mEvictions = 0u;
+}
+
+void GlyphBitmapCache::Trim()
+{
+  while( ( mBytes > mMemoryBudget ) && !mEntries.empty() )
+  {
+    Remove( std::prev( mEntries.end() ) );
+    ++mEvictions;
+  }
+}
+
+void GlyphBitmapCache::Remove( EntryList::iterator entry )
+{
+  mBytes -= entry->bytes;
+  mUncompressedBytes -= ENTRY_OVERHEAD + entry->width * entry->height * Pixel::GetBytesPerPixel( entry->format );
+  mIndex.erase( entry->key );
+  mEntries.erase( entry );
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
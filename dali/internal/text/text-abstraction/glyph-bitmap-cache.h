@@ -0,0 +1,211 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_BITMAP_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_BITMAP_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/images/image-operations.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Caches the most recently rasterized glyph bitmaps within a memory budget.
+ *
+ * Glyphs are identified by their font, index, outline width, the software styles applied to them and,
+ * for the fixed size fonts whose bitmaps are downscaled, the requested size.
+ * Bitmaps with one byte per pixel are kept run length encoded when it makes them smaller, which is
+ * the case of most glyphs as they are mainly made of transparent pixels.
+ */
+class GlyphBitmapCache
+{
+public:
+
+  /**
+   * @brief Statistics about the use of the cache.
+   */
+  struct Statistics
+  {
+    uint32_t hits;              ///< The number of lookups which found a bitmap.
+    uint32_t misses;            ///< The number of lookups which didn't find a bitmap.
+    uint32_t evictions;         ///< The number of bitmaps removed to stay within the memory budget.
+    uint32_t entries;           ///< The number of cached bitmaps.
+    size_t   bytes;             ///< The approximate memory used by the cached bitmaps.
+    size_t   uncompressedBytes; ///< The memory the cached bitmaps would use without encoding.
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] memoryBudget The maximum number of bytes used by the cached bitmaps. Zero disables the cache.
+   */
+  explicit GlyphBitmapCache( size_t memoryBudget );
+
+  /**
+   * @brief Sets the maximum number of bytes used by the cached bitmaps, evicting bitmaps if needed.
+   *
+   * @param[in] memoryBudget The memory budget. Zero disables the cache.
+   */
+  void SetMemoryBudget( size_t memoryBudget );
+
+  /**
+   * @brief Retrieves the maximum number of bytes used by the cached bitmaps.
+   *
+   * @return The memory budget.
+   */
+  size_t GetMemoryBudget() const;
+
+  /**
+   * @brief Finds the bitmap of a glyph.
+   *
+   * @note The caller is responsible for deallocating the bitmap data using delete[].
+   *
+   * @param[in] fontId The font of the glyph.
+   * @param[in] glyphIndex The index of the glyph within the font.
+   * @param[in] outlineWidth The width of the glyph outline in pixels.
+   * @param[in] isItalicRequired Whether the glyph requires italic style.
+   * @param[in] isBoldRequired Whether the glyph requires bold style.
+   * @param[in] requestedSize The size the bitmap is downscaled to, or zero if it is not.
+   * @param[out] data The bitmap data, only set if the glyph is cached.
+   *
+   * @return @e true if the glyph is cached.
+   */
+  bool Find( FontId fontId, GlyphIndex glyphIndex, int outlineWidth, bool isItalicRequired, bool isBoldRequired, ImageDimensions requestedSize, TextAbstraction::FontClient::GlyphBufferData& data );
+
+  /**
+   * @brief Adds a copy of the bitmap of a glyph, replacing any bitmap previously cached for it.
+   *
+   * Bitmaps which would use more than a quarter of the memory budget are not cached.
+   *
+   * @param[in] fontId The font of the glyph.
+   * @param[in] glyphIndex The index of the glyph within the font.
+   * @param[in] outlineWidth The width of the glyph outline in pixels.
+   * @param[in] isItalicRequired Whether the glyph requires italic style.
+   * @param[in] isBoldRequired Whether the glyph requires bold style.
+   * @param[in] requestedSize The size the bitmap is downscaled to, or zero if it is not.
+   * @param[in] data The bitmap data.
+   */
+  void Add( FontId fontId, GlyphIndex glyphIndex, int outlineWidth, bool isItalicRequired, bool isBoldRequired, ImageDimensions requestedSize, const TextAbstraction::FontClient::GlyphBufferData& data );
+
+  /**
+   * @brief Removes all the cached bitmaps. The statistics are kept.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the statistics of the cache.
+   *
+   * @param[out] statistics The statistics.
+   */
+  void GetStatistics( Statistics& statistics ) const;
+
+  /**
+   * @brief Resets the hit, miss and eviction counters.
+   */
+  void ResetStatistics();
+
+private:
+
+  /**
+   * @brief Identifies a glyph bitmap.
+   */
+  struct Key
+  {
+    FontId          fontId;        ///< The font of the glyph.
+    GlyphIndex      glyphIndex;    ///< The index of the glyph within the font.
+    int             outlineWidth;  ///< The width of the glyph outline in pixels.
+    bool            isItalic;      ///< Whether the glyph requires italic style.
+    bool            isBold;        ///< Whether the glyph requires bold style.
+    ImageDimensions requestedSize; ///< The size the bitmap is downscaled to, or zero if it is not.
+
+    bool operator==( const Key& rhs ) const
+    {
+      return ( fontId == rhs.fontId ) &&
+             ( glyphIndex == rhs.glyphIndex ) &&
+             ( outlineWidth == rhs.outlineWidth ) &&
+             ( isItalic == rhs.isItalic ) &&
+             ( isBold == rhs.isBold ) &&
+             ( requestedSize == rhs.requestedSize );
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()( const Key& key ) const;
+  };
+
+  struct Entry
+  {
+    Key                        key;            ///< The glyph of the bitmap.
+    std::vector<unsigned char> pixels;         ///< The pixels, run length encoded if isEncoded is set.
+    unsigned int               width;          ///< The width of the bitmap.
+    unsigned int               height;         ///< The height of the bitmap.
+    int                        outlineOffsetX; ///< The additional horizontal offset of the outline.
+    int                        outlineOffsetY; ///< The additional vertical offset of the outline.
+    Pixel::Format              format;         ///< The pixel format of the bitmap.
+    bool                       isColorEmoji;   ///< Whether the glyph is an emoji.
+    bool                       isColorBitmap;  ///< Whether the glyph is a color bitmap.
+    bool                       isEncoded;      ///< Whether the pixels are run length encoded.
+    size_t                     bytes;          ///< The approximate memory used by the entry.
+  };
+
+  typedef std::list< Entry > EntryList;
+
+  /**
+   * @brief Removes the least recently used bitmaps until the memory used is within the budget.
+   */
+  void Trim();
+
+  /**
+   * @brief Removes the given entry.
+   */
+  void Remove( EntryList::iterator entry );
+
+private:
+
+  EntryList                                               mEntries;           ///< The cached bitmaps, most recently used first.
+  std::unordered_map< Key, EntryList::iterator, KeyHash > mIndex;             ///< The cached bitmaps indexed by their glyph.
+  size_t                                                  mMemoryBudget;      ///< The maximum number of bytes used by the cached bitmaps.
+  size_t                                                  mBytes;             ///< The number of bytes used by the cached bitmaps.
+  size_t                                                  mUncompressedBytes; ///< The number of bytes the cached bitmaps use once decoded.
+  uint32_t                                                mHits;              ///< The number of lookups which found a bitmap.
+  uint32_t                                                mMisses;            ///< The number of lookups which didn't find a bitmap.
+  uint32_t                                                mEvictions;         ///< The number of bitmaps removed to stay within the budget.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_BITMAP_CACHE_H
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/shaping-cache.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+namespace
+{
+const size_t ENTRY_OVERHEAD = 128u; ///< Rough size of the list node, the index node and the shaped run's bookkeeping.
+
+/**
+ * @brief Computes the FNV-1a hash of the key of a run.
+ */
+std::size_t CalculateHash( const Character* const text, Length numberOfCharacters, FontId fontId, Script script )
+{
+  uint64_t hash = 14695981039346656037ull;
+  auto combine = [&hash]( uint32_t value )
+  {
+    for( unsigned int byte = 0u; byte < 4u; ++byte )
+    {
+      hash ^= ( value >> ( byte * 8u ) ) & 0xffu;
+      hash *= 1099511628211ull;
+    }
+  };
+
+  combine( fontId );
+  combine( static_cast<uint32_t>( script ) );
+  for( Length index = 0u; index < numberOfCharacters; ++index )
+  {
+    combine( text[index] );
+  }
+
+  return static_cast<std::size_t>( hash );
+}
+
+/**
+ * @brief Calculates the approximate memory used to cache a run.
+ */
+size_t CalculateBytes( Length numberOfCharacters, const ShapedRun& run )
+{
+  return ENTRY_OVERHEAD +
+         numberOfCharacters * sizeof( Character ) +
+         run.indices.Count() * sizeof( CharacterIndex ) +
+         run.advance.Count() * sizeof( float ) +
+         run.offset.Count() * sizeof( float ) +
+         run.characterMap.Count() * sizeof( CharacterIndex );
+}
+
+} // unnamed namespace
+
+ShapingCache::ShapingCache( size_t memoryBudget )
+: mEntries(),
+  mIndex(),
+  mMemoryBudget( memoryBudget ),
+  mBytes( 0u ),
+  mHits( 0u ),
+  mMisses( 0u ),
+  mEvictions( 0u )
+{
+}
+
+void ShapingCache::SetMemoryBudget( size_t memoryBudget )
+{
+  mMemoryBudget = memoryBudget;
+  Trim();
+}
+
+size_t ShapingCache::GetMemoryBudget() const
+{
+  return mMemoryBudget;
+}
+
+ShapedRunPtr ShapingCache::Find( const Character* const text, Length numberOfCharacters, FontId fontId, Script script )
+{
+  if( 0u == mMemoryBudget )
+  {
+    return ShapedRunPtr();
+  }
+
+  auto indexIter = mIndex.find( CalculateHash( text, numberOfCharacters, fontId, script ) );
+  if( indexIter != mIndex.end() )
+  {
+    const Entry& entry = *indexIter->second;
+
+    // Different keys may have the same hash, the key needs to be compared as well.
+    if( ( entry.fontId == fontId ) &&
+        ( entry.script == script ) &&
+        ( entry.text.Count() == numberOfCharacters ) &&
+        ( 0 == memcmp( entry.text.Begin(), text, numberOfCharacters * sizeof( Character ) ) ) )
+    {
+      // Move the entry to the front of the list.
+      mEntries.splice( mEntries.begin(), mEntries, indexIter->second );
+      ++mHits;
+      return entry.run;
+    }
+  }
+
+  ++mMisses;
+  return ShapedRunPtr();
+}
+
+void ShapingCache::Add( const Character* const text, Length numberOfCharacters, FontId fontId, Script script, ShapedRunPtr run )
+{
+  if( !run )
+  {
+    return;
+  }
+
+  const size_t bytes = CalculateBytes( numberOfCharacters, *run );
+  if( bytes > mMemoryBudget / 4u )
+  {
+    // Long runs are unlikely to be shaped again and would evict many short ones.
+    return;
+  }
+
+  const std::size_t hash = CalculateHash( text, numberOfCharacters, fontId, script );
+  auto indexIter = mIndex.find( hash );
+  if( indexIter != mIndex.end() )
+  {
+    // Either the same run or a different run with the same hash; only the latest is kept.
+    Remove( indexIter->second );
+  }
+
+  mEntries.push_front( Entry() );
+  Entry& entry = mEntries.front();
+  entry.hash = hash;
+  entry.text.Resize( numberOfCharacters );
+  if( numberOfCharacters > 0u )
+  {
+    memcpy( entry.text.Begin(), text, numberOfCharacters * sizeof( Character ) );
+  }
+  entry.fontId = fontId;
+  entry.script = script;
+  entry.run = run;
+  entry.bytes = bytes;
+
+  mIndex[hash] = mEntries.begin();
+  mBytes += bytes;
+
+  Trim();
+}
+
+void ShapingCache::Clear()
+{
+  mEntries.clear();
+  mIndex.clear();
+  mBytes = 0u;
+}
+
+void ShapingCache::GetStatistics( Statistics& statistics ) const
+{
+  statistics.hits = mHits;
+  statistics.misses = mMisses;
+  statistics.evictions = mEvictions;
+  statistics.entries = static_cast<uint32_t>( mIndex.size() );
+  statistics.bytes = mBytes;
+}
+
+void ShapingCache::ResetStatistics()
+{
+  mHits = 0u;
+  mMisses = 0u;
+  mEvictions = 0u;
+}
+
+void ShapingCache::Trim()
+{
+  while( ( mBytes > mMemoryBudget ) && !mEntries.empty() )
+  {
+    Remove( std::prev( mEntries.end() ) );
+    ++mEvictions;
+  }
+}
+
+void ShapingCache::Remove( EntryList::iterator entry )
+{
+  mBytes -= entry->bytes;
+  mIndex.erase( entry->hash );
+  mEntries.erase( entry );
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
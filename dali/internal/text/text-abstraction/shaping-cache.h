@@ -0,0 +1,182 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_SHAPING_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_SHAPING_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <dali/public-api/common/dali-vector.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/script.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The output of shaping a run of text.
+ */
+struct ShapedRun
+{
+  Vector<CharacterIndex> indices;      ///< The glyph indices.
+  Vector<float>          advance;      ///< The advance of each glyph.
+  Vector<float>          offset;       ///< The x and y offsets of each glyph.
+  Vector<CharacterIndex> characterMap; ///< The first character of each glyph.
+};
+
+typedef std::shared_ptr< const ShapedRun > ShapedRunPtr;
+
+/**
+ * @brief A least recently used cache of shaped runs of text.
+ *
+ * Runs are identified by their characters, font and script (the direction is given by the script).
+ * The cache is bounded by an approximation of the memory used by the cached runs.
+ *
+ * The cache is not thread safe.
+ */
+class ShapingCache
+{
+public:
+
+  /**
+   * @brief Statistics about the use of the cache.
+   */
+  struct Statistics
+  {
+    uint32_t hits;      ///< The number of lookups which found a run.
+    uint32_t misses;    ///< The number of lookups which didn't find a run.
+    uint32_t evictions; ///< The number of runs removed to stay within the memory budget.
+    uint32_t entries;   ///< The number of cached runs.
+    size_t   bytes;     ///< The approximate memory used by the cached runs.
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] memoryBudget The maximum number of bytes used by the cached runs. Zero disables the cache.
+   */
+  explicit ShapingCache( size_t memoryBudget );
+
+  /**
+   * @brief Sets the maximum number of bytes used by the cached runs, evicting runs if needed.
+   *
+   * @param[in] memoryBudget The memory budget. Zero disables the cache.
+   */
+  void SetMemoryBudget( size_t memoryBudget );
+
+  /**
+   * @brief Retrieves the maximum number of bytes used by the cached runs.
+   *
+   * @return The memory budget.
+   */
+  size_t GetMemoryBudget() const;
+
+  /**
+   * @brief Finds the shaped run of the given text.
+   *
+   * @param[in] text Pointer to the first character of the text.
+   * @param[in] numberOfCharacters The number of characters.
+   * @param[in] fontId The font the text is shaped with.
+   * @param[in] script The script of the text.
+   *
+   * @return The shaped run, or an empty pointer if it's not cached.
+   */
+  ShapedRunPtr Find( const Character* const text, Length numberOfCharacters, FontId fontId, Script script );
+
+  /**
+   * @brief Adds the shaped run of the given text, replacing any run previously cached for it.
+   *
+   * Runs which would use more than a quarter of the memory budget are not cached.
+   *
+   * @param[in] text Pointer to the first character of the text.
+   * @param[in] numberOfCharacters The number of characters.
+   * @param[in] fontId The font the text is shaped with.
+   * @param[in] script The script of the text.
+   * @param[in] run The shaped run.
+   */
+  void Add( const Character* const text, Length numberOfCharacters, FontId fontId, Script script, ShapedRunPtr run );
+
+  /**
+   * @brief Removes all the cached runs. The statistics are kept.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the statistics of the cache.
+   *
+   * @param[out] statistics The statistics.
+   */
+  void GetStatistics( Statistics& statistics ) const;
+
+  /**
+   * @brief Resets the hit, miss and eviction counters.
+   */
+  void ResetStatistics();
+
+private:
+
+  struct Entry
+  {
+    std::size_t       hash;   ///< The hash of the key.
+    Vector<Character> text;   ///< The characters of the run.
+    FontId            fontId; ///< The font of the run.
+    Script            script; ///< The script of the run.
+    ShapedRunPtr      run;    ///< The shaped run.
+    size_t            bytes;  ///< The approximate memory used by the entry.
+  };
+
+  typedef std::list< Entry > EntryList;
+
+  /**
+   * @brief Removes the least recently used runs until the memory used is within the budget.
+   */
+  void Trim();
+
+  /**
+   * @brief Removes the given entry.
+   */
+  void Remove( EntryList::iterator entry );
+
+private:
+
+  EntryList                                              mEntries;      ///< The cached runs, most recently used first.
+  std::unordered_map< std::size_t, EntryList::iterator > mIndex;        ///< The cached runs indexed by the hash of their key.
+  size_t                                                 mMemoryBudget; ///< The maximum number of bytes used by the cached runs.
+  size_t                                                 mBytes;        ///< The number of bytes used by the cached runs.
+  uint32_t                                               mHits;         ///< The number of lookups which found a run.
+  uint32_t                                               mMisses;       ///< The number of lookups which didn't find a run.
+  uint32_t                                               mEvictions;    ///< The number of runs removed to stay within the budget.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_SHAPING_CACHE_H
@@ -19,14 +19,22 @@
 #include <dali/internal/text/text-abstraction/shaping-impl.h>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/statistics-log.h>
+#include <dali/internal/text/text-abstraction/shaping-cache.h>
 #include "font-client-impl.h"
 
 // EXTERNAL INCLUDES
 #include <harfbuzz/hb.h>
 #include <harfbuzz/hb-ft.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
 #include <dali/devel-api/common/singleton-service.h>
 
 namespace
@@ -36,6 +44,49 @@ namespace
 Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_FONT_CLIENT");
 #endif
 
+const size_t DEFAULT_SHAPING_CACHE_SIZE_KB = 256u;      ///< The default memory budget of the shaped run cache.
+const unsigned int STATISTICS_LOG_SIZE = 160u;
+
+/**
+ * @brief Reads the memory budget of the shaped run cache from DALI_SHAPING_CACHE_SIZE.
+ *
+ * @return The memory budget in bytes.
+ */
+size_t GetShapingCacheBudget()
+{
+  const char* environmentValue = Dali::EnvironmentVariable::GetEnvironmentVariable( DALI_ENV_SHAPING_CACHE_SIZE );
+  const long sizeKb = environmentValue ? std::strtol( environmentValue, nullptr, 10 ) : static_cast<long>( DEFAULT_SHAPING_CACHE_SIZE_KB );
+  return sizeKb > 0 ? static_cast<size_t>( sizeKb ) * 1024u : 0u;
+}
+
+/**
+ * @brief Owns a HarfBuzz buffer which is reused by all the Shape() calls made from the same thread.
+ */
+struct HarfBuzzThreadBuffer
+{
+  HarfBuzzThreadBuffer()
+  : buffer( hb_buffer_create() )
+  {
+  }
+
+  ~HarfBuzzThreadBuffer()
+  {
+    hb_buffer_destroy( buffer );
+  }
+
+  hb_buffer_t* buffer;
+};
+
+/**
+ * @brief Retrieves the calling thread's HarfBuzz buffer, emptied and ready to be filled.
+ */
+hb_buffer_t* GetHarfBuzzBuffer()
+{
+  static thread_local HarfBuzzThreadBuffer threadBuffer;
+  hb_buffer_reset( threadBuffer.buffer );
+  return threadBuffer.buffer;
+}
+
 }
 
 namespace Dali
@@ -122,15 +173,265 @@ const hb_script_t SCRIPT_TO_HARFBUZZ[] =
 struct Shaping::Plugin
 {
   Plugin()
-  : mIndices(),
-    mAdvance(),
-    mCharacterMap(),
-    mFontId( 0u )
+  : mRun(),
+    mFontId( 0u ),
+    mCache( GetShapingCacheBudget() ),
+    mHarfBuzzFonts(),
+    mFontCacheGeneration( 0u ),
+    mHorizontalDpi( 0u ),
+    mVerticalDpi( 0u ),
+    mLocale(),
+    mLanguage( HB_LANGUAGE_INVALID ),
+    mStatisticsLog()
   {
   }
 
   ~Plugin()
   {
+    ClearHarfBuzzFonts();
+  }
+
+  /**
+   * @brief Destroys all the cached HarfBuzz fonts.
+   */
+  void ClearHarfBuzzFonts()
+  {
+    for( auto&& item : mHarfBuzzFonts )
+    {
+      hb_font_destroy( item.second );
+    }
+    mHarfBuzzFonts.clear();
+  }
+
+  /**
+   * @brief Discards everything derived from the fonts if the font client's caches or the DPI have changed.
+   *
+   * @param[in] fontClient The font client.
+   */
+  void ValidateCaches( TextAbstraction::FontClient& fontClient )
+  {
+    // Font ids are reused for different faces once the font client's caches are cleared.
+    const uint32_t cacheGeneration = TextAbstraction::GetImplementation( fontClient ).GetCacheGeneration();
+
+    unsigned int horizontalDpi = 0u;
+    unsigned int verticalDpi = 0u;
+    fontClient.GetDpi( horizontalDpi, verticalDpi );
+
+    if( ( cacheGeneration != mFontCacheGeneration ) ||
+        ( horizontalDpi != mHorizontalDpi ) ||
+        ( verticalDpi != mVerticalDpi ) )
+    {
+      ClearHarfBuzzFonts();
+      mCache.Clear();
+      mFontCacheGeneration = cacheGeneration;
+      mHorizontalDpi = horizontalDpi;
+      mVerticalDpi = verticalDpi;
+    }
+  }
+
+  /**
+   * @brief Retrieves the HarfBuzz font for the given font id, creating it the first time it's requested.
+   *
+   * The HarfBuzz font keeps the shaping tables and plans of the face, so reusing it
+   * avoids loading them for every run of text.
+   *
+   * @param[in] fontId The font id.
+   * @param[in] face The FreeType face of the font, with its size already set.
+   *
+   * @return The HarfBuzz font.
+   */
+  hb_font_t* GetHarfBuzzFont( FontId fontId, FT_Face face )
+  {
+    auto iter = mHarfBuzzFonts.find( fontId );
+    if( iter != mHarfBuzzFonts.end() )
+    {
+      // The size of the FreeType face has been set again, update the scale of the HarfBuzz font.
+      hb_ft_font_changed( iter->second );
+      return iter->second;
+    }
+
+    hb_font_t* harfBuzzFont = hb_ft_font_create( face, NULL );
+    mHarfBuzzFonts[fontId] = harfBuzzFont;
+    return harfBuzzFont;
+  }
+
+  /**
+   * @brief Retrieves the HarfBuzz language of the current locale.
+   *
+   * The language is only parsed again if the locale changes, in which case
+   * the shaped runs are discarded as the language affects the shaping.
+   *
+   * @return The language.
+   */
+  hb_language_t GetLanguage()
+  {
+    const char* currentLocale = setlocale( LC_MESSAGES, NULL );
+    if( nullptr == currentLocale )
+    {
+      currentLocale = DEFAULT_LANGUAGE;
+    }
+
+    if( ( HB_LANGUAGE_INVALID == mLanguage ) || ( mLocale != currentLocale ) )
+    {
+      mLocale = currentLocale;
+
+      // The language is the part of the locale before the territory, i.e. 'en' in 'en_GB.UTF-8'.
+      const char* territory = strchr( currentLocale, '_' );
+      const int languageLength = ( nullptr != territory ) ? static_cast<int>( territory - currentLocale ) : static_cast<int>( mLocale.size() );
+      const hb_language_t language = hb_language_from_string( currentLocale, languageLength );
+
+      if( language != mLanguage )
+      {
+        mCache.Clear();
+        mLanguage = language;
+      }
+    }
+
+    return mLanguage;
+  }
+
+  /**
+   * @brief Logs the statistics of the shaped run cache through the performance interface, if the performance statistics are enabled.
+   */
+  void LogStatistics()
+  {
+    Dali::Internal::Adaptor::PerformanceInterface* performanceInterface = Dali::Internal::Adaptor::StatisticsLog::GetAdaptorPerformanceInterface();
+    if( !mStatisticsLog.IsDue( performanceInterface ) )
+    {
+      return;
+    }
+
+    ShapingCache::Statistics statistics;
+    mCache.GetStatistics( statistics );
+    mCache.ResetStatistics();
+
+    const uint32_t lookups = statistics.hits + statistics.misses;
+    char logBuffer[STATISTICS_LOG_SIZE];
+    snprintf( logBuffer, STATISTICS_LOG_SIZE, "ShapingCache, hits %u, misses %u, hit rate %0.1f%%, evictions %u, entries %u, size %zu / %zu bytes\n",
+              statistics.hits,
+              statistics.misses,
+              lookups > 0u ? 100.f * static_cast<float>( statistics.hits ) / static_cast<float>( lookups ) : 0.f,
+              statistics.evictions,
+              statistics.entries,
+              statistics.bytes,
+              mCache.GetMemoryBudget() );
+    performanceInterface->LogStatistics( logBuffer );
+  }
+
+  /**
+   * @brief Shapes the text with HarfBuzz.
+   *
+   * @param[in] fontClient The font client.
+   * @param[in] face The FreeType face of the font.
+   * @param[in] text The text.
+   * @param[in] numberOfCharacters The number of characters.
+   * @param[in] fontId The font id.
+   * @param[in] script The script of the text.
+   * @param[out] run The glyphs.
+   */
+  void ShapeWithHarfBuzz( TextAbstraction::FontClient& fontClient,
+                          FT_Face face,
+                          const Character* const text,
+                          Length numberOfCharacters,
+                          FontId fontId,
+                          Script script,
+                          ShapedRun& run )
+  {
+    // Reserve some space to avoid reallocations.
+    const Length numberOfGlyphs = static_cast<Length>( 1.3f * static_cast<float>( numberOfCharacters ) );
+    run.indices.Reserve( numberOfGlyphs );
+    run.advance.Reserve( numberOfGlyphs );
+    run.characterMap.Reserve( numberOfGlyphs );
+    run.offset.Reserve( 2u * numberOfGlyphs );
+
+    FT_Set_Char_Size( face,
+                      0u,
+                      fontClient.GetPointSize( fontId ),
+                      mHorizontalDpi,
+                      mVerticalDpi );
+
+    /* Get our harfbuzz font struct */
+    hb_font_t* harfBuzzFont = GetHarfBuzzFont( fontId, face );
+
+    /* Get this thread's buffer for harfbuzz to use */
+    hb_buffer_t* harfBuzzBuffer = GetHarfBuzzBuffer();
+
+    const bool rtlDirection = IsRightToLeftScript( script );
+    hb_buffer_set_direction( harfBuzzBuffer,
+                             rtlDirection ? HB_DIRECTION_RTL : HB_DIRECTION_LTR ); /* or LTR */
+
+    hb_buffer_set_script( harfBuzzBuffer,
+                          SCRIPT_TO_HARFBUZZ[ script ] ); /* see hb-unicode.h */
+
+    hb_buffer_set_language( harfBuzzBuffer, mLanguage );
+
+    /* Layout the text */
+    hb_buffer_add_utf32( harfBuzzBuffer, text, numberOfCharacters, 0u, numberOfCharacters );
+
+    hb_shape( harfBuzzFont, harfBuzzBuffer, NULL, 0u );
+
+    /* Get glyph data */
+    unsigned int glyphCount;
+    hb_glyph_info_t* glyphInfo = hb_buffer_get_glyph_infos( harfBuzzBuffer, &glyphCount );
+    hb_glyph_position_t *glyphPositions = hb_buffer_get_glyph_positions( harfBuzzBuffer, &glyphCount );
+    const GlyphIndex lastGlyphIndex = glyphCount - 1u;
+
+    for( GlyphIndex i = 0u; i < glyphCount; )
+    {
+      if( rtlDirection )
+      {
+        // If the direction is right to left, Harfbuzz retrieves the glyphs in the visual order.
+        // The glyphs are needed in the logical order to layout the text in lines.
+        // Do not change the order of the glyphs if they belong to the same cluster.
+        GlyphIndex rtlIndex = lastGlyphIndex - i;
+
+        unsigned int cluster = glyphInfo[rtlIndex].cluster;
+        unsigned int previousCluster = cluster;
+        Length numberOfGlyphsInCluster = 0u;
+
+        while( ( cluster == previousCluster ) )
+        {
+          ++numberOfGlyphsInCluster;
+          previousCluster = cluster;
+
+          if( rtlIndex > 0u )
+          {
+            --rtlIndex;
+
+            cluster = glyphInfo[rtlIndex].cluster;
+          }
+          else
+          {
+            break;
+          }
+        }
+
+        rtlIndex = lastGlyphIndex - ( i + ( numberOfGlyphsInCluster - 1u ) );
+
+        for( GlyphIndex j = 0u; j < numberOfGlyphsInCluster; ++j )
+        {
+          const GlyphIndex index = rtlIndex + j;
+
+          run.indices.PushBack( glyphInfo[index].codepoint );
+          run.advance.PushBack( glyphPositions[index].x_advance * FROM_266 );
+          run.characterMap.PushBack( glyphInfo[index].cluster );
+          run.offset.PushBack( glyphPositions[index].x_offset * FROM_266 );
+          run.offset.PushBack( glyphPositions[index].y_offset * FROM_266 );
+        }
+
+        i += numberOfGlyphsInCluster;
+      }
+      else
+      {
+        run.indices.PushBack( glyphInfo[i].codepoint );
+        run.advance.PushBack( glyphPositions[i].x_advance * FROM_266 );
+        run.characterMap.PushBack( glyphInfo[i].cluster );
+        run.offset.PushBack( glyphPositions[i].x_offset * FROM_266 );
+        run.offset.PushBack( glyphPositions[i].y_offset * FROM_266 );
+
+        ++i;
+      }
+    }
   }
 
   Length Shape( const Character* const text,
@@ -139,10 +440,7 @@ struct Shaping::Plugin
                 Script script )
   {
     // Clear previoursly shaped texts.
-    mIndices.Clear();
-    mAdvance.Clear();
-    mCharacterMap.Clear();
-    mOffset.Clear();
+    mRun.reset();
     mFontId = fontId;
 
     TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
@@ -154,13 +452,6 @@ struct Shaping::Plugin
     {
       case FontDescription::FACE_FONT:
       {
-        // Reserve some space to avoid reallocations.
-        const Length numberOfGlyphs = static_cast<Length>( 1.3f * static_cast<float>( numberOfCharacters ) );
-        mIndices.Reserve( numberOfGlyphs );
-        mAdvance.Reserve( numberOfGlyphs );
-        mCharacterMap.Reserve( numberOfGlyphs );
-        mOffset.Reserve( 2u * numberOfGlyphs );
-
         // Retrieve a FreeType font's face.
         FT_Face face = fontClientImpl.GetFreetypeFace( fontId );
         if( nullptr == face )
@@ -169,128 +460,42 @@ struct Shaping::Plugin
           return 0u;
         }
 
-        unsigned int horizontalDpi = 0u;
-        unsigned int verticalDpi = 0u;
-        fontClient.GetDpi( horizontalDpi, verticalDpi );
+        ValidateCaches( fontClient );
+        GetLanguage();
 
-        FT_Set_Char_Size( face,
-                          0u,
-                          fontClient.GetPointSize( fontId ),
-                          horizontalDpi,
-                          verticalDpi );
-
-        /* Get our harfbuzz font struct */
-        hb_font_t* harfBuzzFont;
-        harfBuzzFont = hb_ft_font_create( face, NULL );
-
-        /* Create a buffer for harfbuzz to use */
-        hb_buffer_t* harfBuzzBuffer = hb_buffer_create();
-
-        const bool rtlDirection = IsRightToLeftScript( script );
-        hb_buffer_set_direction( harfBuzzBuffer,
-                                 rtlDirection ? HB_DIRECTION_RTL : HB_DIRECTION_LTR ); /* or LTR */
-
-        hb_buffer_set_script( harfBuzzBuffer,
-                              SCRIPT_TO_HARFBUZZ[ script ] ); /* see hb-unicode.h */
-
-
-        char* currentLocale = setlocale(LC_MESSAGES,NULL);
-
-        std::istringstream stringStream( currentLocale );
-        std::string localeString;
-        std::getline(stringStream, localeString, '_');
-        hb_buffer_set_language( harfBuzzBuffer, hb_language_from_string( localeString.c_str(), localeString.size() ) );
-
-        /* Layout the text */
-        hb_buffer_add_utf32( harfBuzzBuffer, text, numberOfCharacters, 0u, numberOfCharacters );
-
-        hb_shape( harfBuzzFont, harfBuzzBuffer, NULL, 0u );
-
-        /* Get glyph data */
-        unsigned int glyphCount;
-        hb_glyph_info_t* glyphInfo = hb_buffer_get_glyph_infos( harfBuzzBuffer, &glyphCount );
-        hb_glyph_position_t *glyphPositions = hb_buffer_get_glyph_positions( harfBuzzBuffer, &glyphCount );
-        const GlyphIndex lastGlyphIndex = glyphCount - 1u;
-
-        for( GlyphIndex i = 0u; i < glyphCount; )
+        mRun = mCache.Find( text, numberOfCharacters, fontId, script );
+        if( !mRun )
         {
-          if( rtlDirection )
-          {
-            // If the direction is right to left, Harfbuzz retrieves the glyphs in the visual order.
-            // The glyphs are needed in the logical order to layout the text in lines.
-            // Do not change the order of the glyphs if they belong to the same cluster.
-            GlyphIndex rtlIndex = lastGlyphIndex - i;
-
-            unsigned int cluster = glyphInfo[rtlIndex].cluster;
-            unsigned int previousCluster = cluster;
-            Length numberOfGlyphsInCluster = 0u;
-
-            while( ( cluster == previousCluster ) )
-            {
-              ++numberOfGlyphsInCluster;
-              previousCluster = cluster;
-
-              if( rtlIndex > 0u )
-              {
-                --rtlIndex;
-
-                cluster = glyphInfo[rtlIndex].cluster;
-              }
-              else
-              {
-                break;
-              }
-            }
-
-            rtlIndex = lastGlyphIndex - ( i + ( numberOfGlyphsInCluster - 1u ) );
-
-            for( GlyphIndex j = 0u; j < numberOfGlyphsInCluster; ++j )
-            {
-              const GlyphIndex index = rtlIndex + j;
-
-              mIndices.PushBack( glyphInfo[index].codepoint );
-              mAdvance.PushBack( glyphPositions[index].x_advance * FROM_266 );
-              mCharacterMap.PushBack( glyphInfo[index].cluster );
-              mOffset.PushBack( glyphPositions[index].x_offset * FROM_266 );
-              mOffset.PushBack( glyphPositions[index].y_offset * FROM_266 );
-            }
-
-            i += numberOfGlyphsInCluster;
-          }
-          else
-          {
-            mIndices.PushBack( glyphInfo[i].codepoint );
-            mAdvance.PushBack( glyphPositions[i].x_advance * FROM_266 );
-            mCharacterMap.PushBack( glyphInfo[i].cluster );
-            mOffset.PushBack( glyphPositions[i].x_offset * FROM_266 );
-            mOffset.PushBack( glyphPositions[i].y_offset * FROM_266 );
-
-            ++i;
-          }
+          std::shared_ptr<ShapedRun> run( new ShapedRun );
+          ShapeWithHarfBuzz( fontClient, face, text, numberOfCharacters, fontId, script, *run );
+          mCache.Add( text, numberOfCharacters, fontId, script, run );
+          mRun = run;
         }
 
-        /* Cleanup */
-        hb_buffer_destroy( harfBuzzBuffer );
-        hb_font_destroy( harfBuzzFont );
+        LogStatistics();
         break;
       }
       case FontDescription::BITMAP_FONT:
       {
+        std::shared_ptr<ShapedRun> run( new ShapedRun );
+
         // Reserve some space to avoid reallocations.
         // The advance and offset tables can be initialized with zeros as it's not needed to get metrics from the bitmaps here.
-        mIndices.Resize( numberOfCharacters );
-        mAdvance.Resize( numberOfCharacters, 0u );
-        mCharacterMap.Reserve( numberOfCharacters );
-        mOffset.Resize( 2u * numberOfCharacters, 0.f );
+        run->indices.Resize( numberOfCharacters );
+        run->advance.Resize( numberOfCharacters, 0u );
+        run->characterMap.Reserve( numberOfCharacters );
+        run->offset.Resize( 2u * numberOfCharacters, 0.f );
 
         // The utf32 character can be used as the glyph's index.
-        std::copy( text, text + numberOfCharacters, mIndices.Begin() );
+        std::copy( text, text + numberOfCharacters, run->indices.Begin() );
 
         // The glyph to character map is 1 to 1.
         for( unsigned int index = 0u; index < numberOfCharacters; ++index )
         {
-          mCharacterMap.PushBack( index );
+          run->characterMap.PushBack( index );
         }
+
+        mRun = run;
         break;
       }
       default:
@@ -299,18 +504,23 @@ struct Shaping::Plugin
       }
     }
 
-    return mIndices.Count();
+    return mRun ? mRun->indices.Count() : 0u;
   }
 
   void GetGlyphs( GlyphInfo* glyphInfo,
                   CharacterIndex* glyphToCharacterMap )
   {
-    Vector<CharacterIndex>::ConstIterator indicesIt = mIndices.Begin();
-    Vector<float>::ConstIterator advanceIt = mAdvance.Begin();
-    Vector<float>::ConstIterator offsetIt = mOffset.Begin();
-    Vector<CharacterIndex>::ConstIterator characterMapIt = mCharacterMap.Begin();
+    if( !mRun )
+    {
+      return;
+    }
+
+    Vector<CharacterIndex>::ConstIterator indicesIt = mRun->indices.Begin();
+    Vector<float>::ConstIterator advanceIt = mRun->advance.Begin();
+    Vector<float>::ConstIterator offsetIt = mRun->offset.Begin();
+    Vector<CharacterIndex>::ConstIterator characterMapIt = mRun->characterMap.Begin();
 
-    for( GlyphIndex index = 0u, size = mIndices.Count(); index < size; ++index )
+    for( GlyphIndex index = 0u, size = mRun->indices.Count(); index < size; ++index )
     {
       GlyphInfo& glyph = *( glyphInfo + index );
       CharacterIndex& glyphToCharacter = *( glyphToCharacterMap + index );
@@ -327,11 +537,17 @@ struct Shaping::Plugin
     }
   }
 
-  Vector<CharacterIndex> mIndices;
-  Vector<float>          mAdvance;
-  Vector<float>          mOffset;
-  Vector<CharacterIndex> mCharacterMap;
-  FontId                 mFontId;
+  ShapedRunPtr                           mRun;                    ///< The glyphs of the last shaped text.
+  FontId                                 mFontId;                 ///< The font of the last shaped text.
+
+  ShapingCache                           mCache;                  ///< The most recently shaped runs.
+  std::unordered_map<FontId, hb_font_t*> mHarfBuzzFonts;          ///< HarfBuzz fonts indexed by font id.
+  uint32_t                               mFontCacheGeneration;    ///< The generation of the font client's caches the HarfBuzz fonts were created for.
+  unsigned int                           mHorizontalDpi;          ///< The horizontal DPI the cached runs were shaped with.
+  unsigned int                           mVerticalDpi;            ///< The vertical DPI the cached runs were shaped with.
+  std::string                            mLocale;                 ///< The locale the language was parsed from.
+  hb_language_t                          mLanguage;               ///< The HarfBuzz language of the current locale.
+  Dali::Internal::Adaptor::StatisticsLog mStatisticsLog;          ///< Paces the cache statistics log.
 };
 
 Shaping::Shaping()
@@ -391,6 +607,20 @@ void Shaping::GetGlyphs( GlyphInfo* glyphInfo,
                       glyphToCharacterMap );
 }
 
+void Shaping::SetCacheMemoryBudget( size_t memoryBudget )
+{
+  CreatePlugin();
+
+  mPlugin->mCache.SetMemoryBudget( memoryBudget );
+}
+
+void Shaping::GetCacheStatistics( ShapingCache::Statistics& statistics )
+{
+  CreatePlugin();
+
+  mPlugin->mCache.GetStatistics( statistics );
+}
+
 void Shaping::CreatePlugin()
 {
   if( !mPlugin )
@@ -19,11 +19,13 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstddef>
 #include <dali/public-api/object/base-object.h>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/devel-api/text-abstraction/shaping.h>
+#include <dali/internal/text/text-abstraction/shaping-cache.h>
 
 namespace Dali
 {
@@ -70,6 +72,22 @@ public:
   void GetGlyphs( GlyphInfo* glyphInfo,
                   CharacterIndex* glyphToCharacterMap );
 
+  /**
+   * @brief Sets the maximum memory used to cache the shaped runs of text.
+   *
+   * The default is 256KB and can be changed with the DALI_SHAPING_CACHE_SIZE environment variable (in KB).
+   *
+   * @param[in] memoryBudget The memory budget in bytes. Zero disables the cache.
+   */
+  void SetCacheMemoryBudget( size_t memoryBudget );
+
+  /**
+   * @brief Retrieves the counters of the shaped run cache.
+   *
+   * @param[out] statistics The counters.
+   */
+  void GetCacheStatistics( ShapingCache::Statistics& statistics );
+
 private:
 
   /**
@@ -46,16 +46,8 @@ Dali::Integration::Trace::LogContextFunction TraceManagerAndroid::GetLogContextF
 
 void TraceManagerAndroid::LogContext( bool start, const char* tag )
 {
-  if( start )
-  {
-    unsigned short contextId = traceManagerAndroid->mPerformanceInterface->AddContext( tag );
-    traceManagerAndroid->mPerformanceInterface->AddMarker( PerformanceInterface::START, contextId );
-  }
-  else
-  {
-    unsigned short contextId = traceManagerAndroid->mPerformanceInterface->AddContext( tag );
-    traceManagerAndroid->mPerformanceInterface->AddMarker( PerformanceInterface::END, contextId );
-  }
+  unsigned short contextId = traceManagerAndroid->GetContextId( tag );
+  traceManagerAndroid->mPerformanceInterface->AddMarker( start ? PerformanceInterface::START : PerformanceInterface::END, contextId );
 }
 
 } // namespace Adaptor
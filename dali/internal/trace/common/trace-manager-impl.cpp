@@ -19,6 +19,7 @@
 #include <dali/internal/trace/common/trace-manager-impl.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
 
 namespace Dali
 {
@@ -30,7 +31,9 @@ namespace Adaptor
 {
 
 TraceManager::TraceManager( PerformanceInterface* performanceInterface )
-: mPerformanceInterface( performanceInterface )
+: mPerformanceInterface( performanceInterface ),
+  mContextIdsMutex(),
+  mContextIds()
 {
 }
 
@@ -45,6 +48,18 @@ bool TraceManager::Initialise()
   return true;
 }
 
+unsigned short TraceManager::GetContextId( const char* tag )
+{
+  Mutex::ScopedLock lock( mContextIdsMutex );
+  auto result = mContextIds.emplace( tag, 0u );
+  if( result.second )
+  {
+    // the context keeps the name pointer, which the map's key outlives
+    result.first->second = mPerformanceInterface->AddContext( result.first->first.c_str() );
+  }
+  return result.first->second;
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
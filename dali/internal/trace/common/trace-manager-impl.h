@@ -19,7 +19,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
+#include <unordered_map>
 #include <dali/integration-api/trace.h>
+#include <dali/devel-api/threading/mutex.h>
 
 // INTERNAL INCLUDES
 
@@ -70,6 +73,14 @@ protected:
    */
   virtual Dali::Integration::Trace::LogContextFunction GetLogContextFunction() { return nullptr; };
 
+  /**
+   * Retrieves the performance context of a trace tag, which is added on first use,
+   * so tracing a scope doesn't add a context each time
+   * @param[in] tag The trace tag
+   * @return The context id
+   */
+  unsigned short GetContextId( const char* tag );
+
 private:
 
   /**
@@ -80,6 +91,9 @@ private:
 
   TraceManager( const TraceManager& ) = delete;
   TraceManager& operator=( TraceManager& )  = delete;
+
+  Dali::Mutex mContextIdsMutex;                                ///< Guards mContextIds, the tags are traced from several threads
+  std::unordered_map< std::string, unsigned short > mContextIds; ///< The performance context of each trace tag
 };
 
 } // namespace Adaptor
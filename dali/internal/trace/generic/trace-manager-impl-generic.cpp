@@ -45,16 +45,8 @@ Dali::Integration::Trace::LogContextFunction TraceManagerGeneric::GetLogContextF
 
 void TraceManagerGeneric::LogContext( bool start, const char* tag )
 {
-  if( start )
-  {
-    unsigned short contextId = traceManagerGeneric->mPerformanceInterface->AddContext( tag );
-    traceManagerGeneric->mPerformanceInterface->AddMarker( PerformanceInterface::START, contextId );
-  }
-  else
-  {
-    unsigned short contextId = traceManagerGeneric->mPerformanceInterface->AddContext( tag );
-    traceManagerGeneric->mPerformanceInterface->AddMarker( PerformanceInterface::END, contextId );
-  }
+  unsigned short contextId = traceManagerGeneric->GetContextId( tag );
+  traceManagerGeneric->mPerformanceInterface->AddMarker( start ? PerformanceInterface::START : PerformanceInterface::END, contextId );
 }
 
 } // namespace Adaptor
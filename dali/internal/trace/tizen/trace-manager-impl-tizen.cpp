@@ -20,6 +20,7 @@
 #include <dali/internal/trace/tizen/trace-manager-impl-tizen.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
 
 namespace Dali
 {
@@ -30,9 +31,24 @@ namespace Internal
 namespace Adaptor
 {
 
+TraceManagerTizen* TraceManagerTizen::traceManagerTizen = nullptr;
+
 TraceManagerTizen::TraceManagerTizen( PerformanceInterface* performanceInterface )
 : TraceManager( performanceInterface )
 {
+  // ttrace is always used, the performance interface only when the traces are recorded to a file
+  if( performanceInterface && performanceInterface->IsTraceFileEnabled() )
+  {
+    TraceManagerTizen::traceManagerTizen = this;
+  }
+}
+
+TraceManagerTizen::~TraceManagerTizen()
+{
+  if( TraceManagerTizen::traceManagerTizen == this )
+  {
+    TraceManagerTizen::traceManagerTizen = nullptr;
+  }
 }
 
 Dali::Integration::Trace::LogContextFunction TraceManagerTizen::GetLogContextFunction()
@@ -50,6 +66,12 @@ void TraceManagerTizen::LogContext( bool start, const char* tag )
   {
     traceEnd( TTRACE_TAG_GRAPHICS );
   }
+
+  if( traceManagerTizen )
+  {
+    unsigned short contextId = traceManagerTizen->GetContextId( tag );
+    traceManagerTizen->mPerformanceInterface->AddMarker( start ? PerformanceInterface::START : PerformanceInterface::END, contextId );
+  }
 }
 
 } // namespace Adaptor
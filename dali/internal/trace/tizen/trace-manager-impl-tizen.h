@@ -36,6 +36,12 @@ class PerformanceInterface;
 class TraceManagerTizen : public Dali::Internal::Adaptor::TraceManager
 {
 public:
+  /**
+   * Static member to hold TraceManagerTizen instance, when the traces are also
+   * recorded to the performance trace file through PerformanceInterface.
+   */
+  static TraceManagerTizen* traceManagerTizen;
+
   /**
    * Explicit Constructor
    */
@@ -46,7 +52,7 @@ protected:
   /**
    * Destructor
    */
-  ~TraceManagerTizen() override = default;
+  ~TraceManagerTizen() override;
 
   /**
    * Obtain the LogContextFunction method (Tizen specific) used for tracing
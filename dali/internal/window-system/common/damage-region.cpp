@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/window-system/common/damage-region.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <limits>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+int64_t Area( const Rect< int >& rect )
+{
+  return static_cast< int64_t >( rect.width ) * static_cast< int64_t >( rect.height );
+}
+
+int64_t IntersectionArea( const Rect< int >& lhs, const Rect< int >& rhs )
+{
+  const int64_t width = std::min( lhs.x + lhs.width, rhs.x + rhs.width ) - std::max( lhs.x, rhs.x );
+  const int64_t height = std::min( lhs.y + lhs.height, rhs.y + rhs.height ) - std::max( lhs.y, rhs.y );
+  return ( width > 0 && height > 0 ) ? width * height : 0;
+}
+
+bool Contains( const Rect< int >& outer, const Rect< int >& inner )
+{
+  return ( inner.x >= outer.x ) &&
+         ( inner.y >= outer.y ) &&
+         ( inner.x + inner.width <= outer.x + outer.width ) &&
+         ( inner.y + inner.height <= outer.y + outer.height );
+}
+
+Rect< int > BoundingBox( const Rect< int >& lhs, const Rect< int >& rhs )
+{
+  Rect< int > boundingBox( lhs );
+  boundingBox.Merge( rhs );
+  return boundingBox;
+}
+
+/**
+ * @brief Calculates the number of pixels the bounding box of two rectangles adds to the pixels they cover.
+ */
+int64_t MergeCost( const Rect< int >& lhs, const Rect< int >& rhs )
+{
+  return Area( BoundingBox( lhs, rhs ) ) - ( Area( lhs ) + Area( rhs ) - IntersectionArea( lhs, rhs ) );
+}
+
+} // unnamed namespace
+
+DamageRegion::DamageRegion( uint32_t maximumRects, uint32_t rectCost )
+: mRects(),
+  mMaximumRects( std::max( maximumRects, 1u ) ),
+  mRectCost( rectCost )
+{
+  mRects.reserve( mMaximumRects + 1u );
+}
+
+void DamageRegion::Add( const Rect< int >& rect )
+{
+  if( rect.IsEmpty() )
+  {
+    return;
+  }
+
+  Insert( rect );
+
+  while( mRects.size() > mMaximumRects )
+  {
+    // Merge the pair of rectangles which adds the fewest pixels.
+    uint32_t first = 0u;
+    uint32_t second = 1u;
+    int64_t minimumCost = std::numeric_limits< int64_t >::max();
+    for( uint32_t i = 0u; i < mRects.size() - 1u; ++i )
+    {
+      for( uint32_t j = i + 1u; j < mRects.size(); ++j )
+      {
+        const int64_t cost = MergeCost( mRects[i], mRects[j] );
+        if( cost < minimumCost )
+        {
+          minimumCost = cost;
+          first = i;
+          second = j;
+        }
+      }
+    }
+
+    const Rect< int > merged = BoundingBox( mRects[first], mRects[second] );
+    mRects.erase( mRects.begin() + second );
+    mRects.erase( mRects.begin() + first );
+    Insert( merged );
+  }
+}
+
+void DamageRegion::Add( const std::vector< Rect< int > >& rects )
+{
+  for( auto&& rect : rects )
+  {
+    Add( rect );
+  }
+}
+
+void DamageRegion::Clip( const Rect< int >& clip )
+{
+  auto last = std::remove_if( mRects.begin(), mRects.end(), [&clip]( Rect< int >& rect )
+                              {
+                                return !rect.Intersect( clip );
+                              } );
+  mRects.erase( last, mRects.end() );
+}
+
+void DamageRegion::Clear()
+{
+  mRects.clear();
+}
+
+uint64_t DamageRegion::GetArea() const
+{
+  uint64_t area = 0u;
+  for( auto&& rect : mRects )
+  {
+    area += static_cast< uint64_t >( Area( rect ) );
+  }
+  return area;
+}
+
+Rect< int > DamageRegion::GetBoundingBox() const
+{
+  if( mRects.empty() )
+  {
+    return Rect< int >();
+  }
+
+  Rect< int > boundingBox( mRects[0] );
+  for( auto&& rect : mRects )
+  {
+    boundingBox.Merge( rect );
+  }
+  return boundingBox;
+}
+
+void DamageRegion::Insert( Rect< int > rect )
+{
+  // A merged rectangle may become cheap to merge with the rectangles it didn't overlap before.
+  bool merged = true;
+  while( merged )
+  {
+    merged = false;
+    for( auto iter = mRects.begin(); iter != mRects.end(); ++iter )
+    {
+      if( Contains( *iter, rect ) )
+      {
+        return;
+      }
+
+      if( Contains( rect, *iter ) || ( MergeCost( rect, *iter ) <= static_cast< int64_t >( mRectCost ) ) )
+      {
+        rect.Merge( *iter );
+        mRects.erase( iter );
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  mRects.push_back( rect );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,138 @@
+#ifndef DALI_INTERNAL_WINDOWSYSTEM_COMMON_DAMAGE_REGION_H
+#define DALI_INTERNAL_WINDOWSYSTEM_COMMON_DAMAGE_REGION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <vector>
+#include <dali/public-api/math/rect.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief The damaged area of a surface, stored as a small list of rectangles.
+ *
+ * Unlike a single bounding box, two small updates far apart stay two small rectangles.
+ * Every rectangle has a fixed cost (e.g. a render pass or a scissor change) so a rectangle
+ * is merged with another one whenever their bounding box adds fewer pixels than that cost.
+ * When there are more rectangles than the maximum, the two rectangles whose bounding box
+ * adds the fewest pixels are merged.
+ */
+class DamageRegion
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] maximumRects The maximum number of rectangles kept. Must be at least one.
+   * @param[in] rectCost The cost of a rectangle, in pixels.
+   */
+  DamageRegion( uint32_t maximumRects, uint32_t rectCost );
+
+  /**
+   * @brief Adds a rectangle to the region. Empty rectangles are ignored.
+   *
+   * @param[in] rect The damaged rectangle.
+   */
+  void Add( const Rect< int >& rect );
+
+  /**
+   * @brief Adds a list of rectangles to the region.
+   *
+   * @param[in] rects The damaged rectangles.
+   */
+  void Add( const std::vector< Rect< int > >& rects );
+
+  /**
+   * @brief Clips the region, removing the rectangles outside the given one.
+   *
+   * @param[in] clip The clipping rectangle, usually the surface.
+   */
+  void Clip( const Rect< int >& clip );
+
+  /**
+   * @brief Removes all the rectangles.
+   */
+  void Clear();
+
+  /**
+   * @brief Whether the region has no rectangles.
+   */
+  bool IsEmpty() const
+  {
+    return mRects.empty();
+  }
+
+  /**
+   * @brief Retrieves the number of pixels covered by the rectangles.
+   *
+   * Overlapping pixels are counted once per rectangle, as they are when each rectangle is rendered.
+   *
+   * @return The area of the region.
+   */
+  uint64_t GetArea() const;
+
+  /**
+   * @brief Retrieves the bounding box of the region.
+   *
+   * @return The bounding box, or an empty rectangle if the region is empty.
+   */
+  Rect< int > GetBoundingBox() const;
+
+  /**
+   * @brief Retrieves the rectangles of the region.
+   *
+   * @return The rectangles.
+   */
+  const std::vector< Rect< int > >& GetRects() const
+  {
+    return mRects;
+  }
+
+private:
+
+  /**
+   * @brief Adds a rectangle, merging it with the rectangles it's cheaper to render together with.
+   *
+   * @param[in] rect The rectangle, not empty.
+   */
+  void Insert( Rect< int > rect );
+
+private:
+
+  std::vector< Rect< int > > mRects;        ///< The rectangles of the region.
+  uint32_t                   mMaximumRects; ///< The maximum number of rectangles.
+  uint32_t                   mRectCost;     ///< The cost of a rectangle, in pixels.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_WINDOWSYSTEM_COMMON_DAMAGE_REGION_H
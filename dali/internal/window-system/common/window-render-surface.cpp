@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/integration-api/debug.h>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/thread-synchronization-interface.h>
@@ -33,6 +36,7 @@
 #include <dali/internal/window-system/common/window-factory.h>
 #include <dali/internal/window-system/common/window-system.h>
 #include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/statistics-log.h>
 
 namespace Dali
 {
@@ -46,32 +50,16 @@ namespace
 
 const int MINIMUM_DIMENSION_CHANGE( 1 ); ///< Minimum change for window to be considered to have moved
 const float FULL_UPDATE_RATIO( 0.8f );   ///< Force full update when the dirty area is larget than this ratio
+const uint32_t MAXIMUM_CLIPPING_RECTS( 4u );       ///< Each clipping rect is a render pass of the scene
+const uint32_t CLIPPING_RECT_COST( 128u * 128u );  ///< Pixels it's worth rendering to save a render pass
+const float RENDER_PASS_COST_RATIO( 0.25f );      ///< A render pass re-runs every render instruction, so it must save this ratio of the surface
+const uint32_t MAXIMUM_SWAP_RECTS( 16u );          ///< The compositor only needs a close enough damage
+const uint32_t SWAP_RECT_COST( 32u * 32u );        ///< Pixels it's worth presenting to save a rect
 
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gWindowRenderSurfaceLogFilter = Debug::Filter::New(Debug::Verbose, false, "LOG_WINDOW_RENDER_SURFACE");
 #endif
 
-void MergeRects( Rect< int >& mergingRect, const std::vector< Rect< int > >& rects )
-{
-  uint32_t i = 0;
-  if( mergingRect.IsEmpty() )
-  {
-    for( ; i < rects.size(); i++ )
-    {
-      if( !rects[i].IsEmpty() )
-      {
-        mergingRect = rects[i];
-        break;
-      }
-    }
-  }
-
-  for( ; i < rects.size(); i++ )
-  {
-    mergingRect.Merge( rects[i] );
-  }
-}
-
 void InsertRects( WindowRenderSurface::DamagedRectsContainer& damagedRectsList, const std::vector< Rect< int > >& damagedRects )
 {
   damagedRectsList.push_front( damagedRects );
@@ -99,6 +87,12 @@ WindowRenderSurface::WindowRenderSurface( Dali::PositionSize positionSize, Any s
   mOutputTransformedSignal(),
   mFrameCallbackInfoContainer(),
   mBufferDamagedRects(),
+  mClippingRegion( MAXIMUM_CLIPPING_RECTS, CLIPPING_RECT_COST ),
+  mSwapRegion( MAXIMUM_SWAP_RECTS, SWAP_RECT_COST ),
+  mRepaintedPixels( 0u ),
+  mSurfacePixels( 0u ),
+  mRepaintedFrames( 0u ),
+  mStatisticsLog(),
   mMutex(),
   mRotationAngle( 0 ),
   mScreenRotationAngle( 0 ),
@@ -494,6 +488,15 @@ bool WindowRenderSurface::PreRender( bool resizingSurface, const std::vector<Rec
   return true;
 }
 
+void WindowRenderSurface::GetClippingRects( std::vector<Rect<int>>& clippingRects ) const
+{
+  clippingRects.clear();
+  if( mClippingRegion.GetRects().size() > 1u )
+  {
+    clippingRects = mClippingRegion.GetRects();
+  }
+}
+
 void WindowRenderSurface::PostRender( bool renderToFbo, bool replacingSurface, bool resizingSurface, const std::vector<Rect<int>>& damagedRects )
 {
   // Inform the gl implementation that rendering has finished before informing the surface
@@ -669,21 +672,26 @@ void WindowRenderSurface::OnFileDescriptorEventDispatched( FileDescriptorMonitor
 
 void WindowRenderSurface::SetBufferDamagedRects( const std::vector< Rect< int > >& damagedRects, Rect< int >& clippingRect )
 {
+  mClippingRegion.Clear();
+
+  Rect< int > surfaceRect( 0, 0, mPositionSize.width, mPositionSize.height );
+  const uint64_t surfaceArea = static_cast< uint64_t >( surfaceRect.width ) * static_cast< uint64_t >( surfaceRect.height );
+
   auto eglGraphics = static_cast< EglGraphics* >( mGraphics );
   if ( eglGraphics )
   {
     Internal::Adaptor::EglImplementation& eglImpl = eglGraphics->GetEglImplementation();
     if( !eglImpl.IsPartialUpdateRequired() )
     {
+      UpdateRepaintStatistics( surfaceArea );
       return;
     }
 
-    Rect< int > surfaceRect( 0, 0, mPositionSize.width, mPositionSize.height );
-
     if( mFullSwapNextFrame )
     {
       InsertRects( mBufferDamagedRects, std::vector< Rect< int > >( 1, surfaceRect ) );
       clippingRect = Rect< int >();
+      UpdateRepaintStatistics( surfaceArea );
       return;
     }
 
@@ -694,31 +702,46 @@ void WindowRenderSurface::SetBufferDamagedRects( const std::vector< Rect< int >
     {
       InsertRects( mBufferDamagedRects, std::vector< Rect< int > >( 1, surfaceRect ) );
       clippingRect = Rect< int >();
+      UpdateRepaintStatistics( surfaceArea );
       return;
     }
 
     // We push current frame damaged rects here, zero index for current frame
     InsertRects( mBufferDamagedRects, damagedRects );
 
-    // Merge damaged rects into clipping rect
+    // Merge the damaged rects of the frames the back buffer missed into a region
     auto bufferDamagedRects = mBufferDamagedRects.begin();
     while( bufferAge-- >= 0 && bufferDamagedRects != mBufferDamagedRects.end() )
     {
-      const std::vector< Rect< int > >& rects = *bufferDamagedRects++;
-      MergeRects( clippingRect, rects );
+      mClippingRegion.Add( *bufferDamagedRects++ );
     }
 
-    if( !clippingRect.Intersect( surfaceRect ) || clippingRect.Area() > surfaceRect.Area() * FULL_UPDATE_RATIO )
+    mClippingRegion.Clip( surfaceRect );
+
+    if( mClippingRegion.IsEmpty() || mClippingRegion.GetArea() > surfaceArea * FULL_UPDATE_RATIO )
     {
       // clipping area too big or doesn't intersect surface rect
+      mClippingRegion.Clear();
       clippingRect = Rect< int >();
+      UpdateRepaintStatistics( surfaceArea );
       return;
     }
 
-    std::vector< Rect< int > > damagedRegion;
-    damagedRegion.push_back( clippingRect );
+    clippingRect = mClippingRegion.GetBoundingBox();
 
-    eglImpl.SetDamageRegion( mEGLSurface, damagedRegion );
+    // Rendering the rects separately only pays off when they save much more filling than the extra passes cost
+    const uint64_t boundingArea = static_cast< uint64_t >( clippingRect.width ) * static_cast< uint64_t >( clippingRect.height );
+    const uint64_t extraPassesCost = static_cast< uint64_t >( surfaceArea * RENDER_PASS_COST_RATIO ) * ( mClippingRegion.GetRects().size() - 1u );
+    if( boundingArea <= mClippingRegion.GetArea() + extraPassesCost )
+    {
+      // the damage region must cover every pixel rendered
+      mClippingRegion.Clear();
+      mClippingRegion.Add( clippingRect );
+    }
+
+    UpdateRepaintStatistics( mClippingRegion.GetArea() );
+
+    eglImpl.SetDamageRegion( mEGLSurface, mClippingRegion.GetRects() );
   }
 }
 
@@ -731,7 +754,7 @@ void WindowRenderSurface::SwapBuffers( const std::vector<Rect<int>>& damagedRect
 
     Internal::Adaptor::EglImplementation& eglImpl = eglGraphics->GetEglImplementation();
 
-    if( !eglImpl.IsPartialUpdateRequired() || mFullSwapNextFrame || !damagedRects.size() || (damagedRects[0].Area() > surfaceRect.Area() * FULL_UPDATE_RATIO) )
+    if( !eglImpl.IsPartialUpdateRequired() || mFullSwapNextFrame || !damagedRects.size() )
     {
       mFullSwapNextFrame = false;
       eglImpl.SwapBuffers( mEGLSurface );
@@ -740,59 +763,52 @@ void WindowRenderSurface::SwapBuffers( const std::vector<Rect<int>>& damagedRect
 
     mFullSwapNextFrame = false;
 
-    std::vector< Rect< int > > mergedRects = damagedRects;
-
-    // Merge intersecting rects, form an array of non intersecting rects to help driver a bit
-    // Could be optional and can be removed, needs to be checked with and without on platform
-    const int n = mergedRects.size();
-    for( int i = 0; i < n - 1; i++ )
-    {
-      if( mergedRects[i].IsEmpty() )
-      {
-        continue;
-      }
-
-      for( int j = i + 1; j < n; j++ )
-      {
-        if( mergedRects[j].IsEmpty() )
-        {
-          continue;
-        }
-
-        if( mergedRects[i].Intersects( mergedRects[j] ) )
-        {
-          mergedRects[i].Merge( mergedRects[j] );
-          mergedRects[j].width = 0;
-          mergedRects[j].height = 0;
-        }
-      }
-    }
-
-    int j = 0;
-    for( int i = 0; i < n; i++ )
-    {
-      if( !mergedRects[i].IsEmpty() )
-      {
-        mergedRects[j++] = mergedRects[i];
-      }
-    }
-
-    if( j != 0 )
-    {
-      mergedRects.resize( j );
-    }
+    // Give the compositor a few non redundant rects rather than every damaged render item
+    mSwapRegion.Clear();
+    mSwapRegion.Add( damagedRects );
+    mSwapRegion.Clip( surfaceRect );
 
-    if( !mergedRects.size() || ( mergedRects[0].Area() > surfaceRect.Area() * FULL_UPDATE_RATIO ) )
+    if( mSwapRegion.IsEmpty() || ( mSwapRegion.GetArea() > surfaceRect.Area() * FULL_UPDATE_RATIO ) )
     {
       eglImpl.SwapBuffers( mEGLSurface );
     }
     else
     {
-      eglImpl.SwapBuffers( mEGLSurface, mergedRects );
+      eglImpl.SwapBuffers( mEGLSurface, mSwapRegion.GetRects() );
     }
   }
 }
 
+void WindowRenderSurface::UpdateRepaintStatistics( uint64_t repaintedPixels )
+{
+  PerformanceInterface* performanceInterface = mAdaptor ? mAdaptor->GetPerformanceInterface() : nullptr;
+  if( !StatisticsLog::IsEnabled( performanceInterface ) )
+  {
+    return;
+  }
+
+  mRepaintedPixels += repaintedPixels;
+  mSurfacePixels += static_cast< uint64_t >( mPositionSize.width ) * static_cast< uint64_t >( mPositionSize.height );
+  ++mRepaintedFrames;
+
+  if( !mStatisticsLog.IsDue( performanceInterface ) )
+  {
+    return;
+  }
+
+  char logBuffer[256];
+  snprintf( logBuffer, sizeof( logBuffer ), "Surface %dx%d repainted %" PRIu64 " pixels per frame (%.1f%% of the surface) over %u frames\n",
+            mPositionSize.width, mPositionSize.height,
+            mRepaintedPixels / mRepaintedFrames,
+            mSurfacePixels > 0u ? 100.0 * static_cast< double >( mRepaintedPixels ) / static_cast< double >( mSurfacePixels ) : 0.0,
+            mRepaintedFrames );
+  performanceInterface->LogStatistics( logBuffer );
+
+  mRepaintedPixels = 0u;
+  mSurfacePixels = 0u;
+  mRepaintedFrames = 0u;
+}
+
 } // namespace Adaptor
 
 } // namespace internal
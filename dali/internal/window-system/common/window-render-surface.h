@@ -30,6 +30,8 @@
 #include <dali/integration-api/adaptor-framework/render-surface-interface.h>
 #include <dali/internal/graphics/common/graphics-interface.h>
 #include <dali/internal/system/common/file-descriptor-monitor.h>
+#include <dali/internal/system/common/statistics-log.h>
+#include <dali/internal/window-system/common/damage-region.h>
 
 namespace Dali
 {
@@ -163,6 +165,11 @@ public: // from Dali::RenderSurfaceInterface
    */
   bool PreRender( bool resizingSurface, const std::vector<Rect<int>>& damagedRects, Rect<int>& clippingRect ) override;
 
+  /**
+   * @copydoc Dali::RenderSurfaceInterface::GetClippingRects()
+   */
+  void GetClippingRects( std::vector<Rect<int>>& clippingRects ) const override;
+
   /**
    * @copydoc Dali::RenderSurfaceInterface::PostRender()
    */
@@ -235,7 +242,7 @@ private:
   /**
    * @brief Set the buffer damage rects.
    * @param[in] damagedRects List of damaged rects
-   * @param[in] clippingRect The rect to clip rendered scene
+   * @param[out] clippingRect The bounding box of the region to render, empty for a full update
    */
   void SetBufferDamagedRects( const std::vector< Rect< int > >& damagedRects, Rect< int >& clippingRect );
 
@@ -245,6 +252,12 @@ private:
    */
   void SwapBuffers( const std::vector<Rect<int>>& damagedRects );
 
+  /**
+   * @brief Accumulates the number of pixels rendered and logs them periodically.
+   * @param[in] repaintedPixels The number of pixels rendered in this frame
+   */
+  void UpdateRepaintStatistics( uint64_t repaintedPixels );
+
 protected:
 
   // Undefined
@@ -300,6 +313,12 @@ private: // Data
   OutputSignalType                mOutputTransformedSignal;
   FrameCallbackInfoContainer      mFrameCallbackInfoContainer;
   DamagedRectsContainer           mBufferDamagedRects;
+  DamageRegion                    mClippingRegion;     ///< The areas to render in the current frame
+  DamageRegion                    mSwapRegion;         ///< The areas of the current frame to present
+  uint64_t                        mRepaintedPixels;    ///< The number of pixels rendered since the statistics were last logged
+  uint64_t                        mSurfacePixels;      ///< The number of pixels of the surface since the statistics were last logged
+  uint32_t                        mRepaintedFrames;    ///< The number of frames since the statistics were last logged
+  StatisticsLog                   mStatisticsLog;      ///< Paces the repaint statistics log
   Dali::Mutex                     mMutex;
   int                             mRotationAngle;
   int                             mScreenRotationAngle;